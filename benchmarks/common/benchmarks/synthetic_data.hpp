@@ -0,0 +1,414 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+
+// Detray include(s).
+#include "detray/geometry/barcode.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+/// Generators of synthetic input data for the (stage) benchmarks
+///
+/// They allow benchmarking the individual reconstruction stages without
+/// having to read or simulate any event data beforehand. All generators are
+/// deterministic for a given random seed.
+///
+namespace traccc::benchmarks {
+
+/// Cells and modules of a synthetic event
+struct synthetic_cells {
+    /// The cells of all modules, sorted the way clusterization expects them
+    cell_collection_types::host cells;
+    /// The modules that the cells belong to
+    cell_module_collection_types::host modules;
+};
+
+/// Generate random pixel clusters on a number of detector modules
+///
+/// Every module receives (about) @c cells_per_module cells, grouped into
+/// compact clusters of 1-9 cells, on a 50x50 um pixel matrix.
+///
+/// @param mr The memory resource to create the collections with
+/// @param n_modules The number of detector modules to generate
+/// @param cells_per_module The number of cells to generate on every module
+/// @param seed The seed of the random number generator
+///
+inline synthetic_cells generate_cells(vecmem::memory_resource& mr,
+                                      std::size_t n_modules,
+                                      std::size_t cells_per_module,
+                                      unsigned int seed = 42u) {
+
+    // Pixel matrix layout of the modules.
+    static constexpr channel_id n_channels = 1000u;
+    static constexpr scalar pitch = 0.05f * unit<scalar>::mm;
+
+    std::mt19937 gen{seed};
+    std::uniform_int_distribution<channel_id> channel_dist{0u,
+                                                           n_channels - 3u};
+    std::uniform_int_distribution<channel_id> size_dist{1u, 3u};
+    std::uniform_real_distribution<scalar> activation_dist{0.1f, 1.f};
+
+    synthetic_cells result{cell_collection_types::host{&mr},
+                           cell_module_collection_types::host{&mr}};
+    result.modules.reserve(n_modules);
+    result.cells.reserve(n_modules * cells_per_module);
+
+    for (std::size_t i = 0; i < n_modules; ++i) {
+
+        // Set up the module.
+        cell_module module;
+        module.surface_link = detray::geometry::barcode{i};
+        module.threshold = 0.f;
+        module.pixel = {-0.5f * n_channels * pitch,
+                        -0.5f * n_channels * pitch, pitch, pitch};
+        result.modules.push_back(module);
+        const auto module_link =
+            static_cast<cell::link_type>(result.modules.size() - 1);
+
+        // Generate clusters on it, until enough (unique) cells were made.
+        std::set<std::pair<channel_id, channel_id> > channels;
+        while (channels.size() < cells_per_module) {
+            const channel_id c0 = channel_dist(gen);
+            const channel_id c1 = channel_dist(gen);
+            const channel_id size0 = size_dist(gen);
+            const channel_id size1 = size_dist(gen);
+            for (channel_id d0 = 0; d0 < size0; ++d0) {
+                for (channel_id d1 = 0; d1 < size1; ++d1) {
+                    if (channels.size() < cells_per_module) {
+                        channels.insert({c0 + d0, c1 + d1});
+                    }
+                }
+            }
+        }
+
+        // Add the cells in column-major order.
+        std::vector<std::pair<channel_id, channel_id> > sorted(
+            channels.begin(), channels.end());
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const auto& lhs, const auto& rhs) {
+                      return std::make_pair(lhs.second, lhs.first) <
+                             std::make_pair(rhs.second, rhs.first);
+                  });
+        for (const auto& [c0, c1] : sorted) {
+            result.cells.push_back(
+                {c0, c1, activation_dist(gen), 0.f, module_link});
+        }
+    }
+
+    return result;
+}
+
+/// Parameters of the synthetic (barrel) spacepoint generation
+struct spacepoint_generator_config {
+    /// Number of charged particles per pileup vertex within the acceptance
+    std::size_t particles_per_vertex = 10u;
+    /// Radii of the barrel layers
+    std::vector<scalar> layer_radii{
+        34.f * unit<scalar>::mm,  70.f * unit<scalar>::mm,
+        116.f * unit<scalar>::mm, 172.f * unit<scalar>::mm,
+        260.f * unit<scalar>::mm, 310.f * unit<scalar>::mm};
+    /// Magnetic field strength along the beam axis
+    scalar bfield = 2.f * unit<scalar>::T;
+    /// Transverse momentum range of the particles
+    std::pair<scalar, scalar> pt_range{1.f * unit<scalar>::GeV,
+                                       10.f * unit<scalar>::GeV};
+    /// Pseudorapidity range of the particles
+    std::pair<scalar, scalar> eta_range{-2.5f, 2.5f};
+    /// Standard deviation of the vertex z positions
+    scalar vertex_z_stddev = 50.f * unit<scalar>::mm;
+    /// Transverse resolution of the spacepoints
+    scalar resolution_rphi = 0.01f * unit<scalar>::mm;
+    /// Longitudinal resolution of the spacepoints
+    scalar resolution_z = 0.05f * unit<scalar>::mm;
+    /// Fraction of noise spacepoints, relative to the signal spacepoints
+    scalar noise_fraction = 0.05f;
+};
+
+/// Generate the spacepoints of helical particles in a barrel-only detector
+///
+/// @param mr The memory resource to create the collection with
+/// @param pileup The number of pileup vertices in the event
+/// @param cfg The configuration of the generator
+/// @param seed The seed of the random number generator
+///
+inline spacepoint_collection_types::host generate_spacepoints(
+    vecmem::memory_resource& mr, std::size_t pileup,
+    const spacepoint_generator_config& cfg = {}, unsigned int seed = 42u) {
+
+    std::mt19937 gen{seed};
+    std::uniform_real_distribution<scalar> phi_dist{-constant<scalar>::pi,
+                                                    constant<scalar>::pi};
+    std::uniform_real_distribution<scalar> eta_dist{cfg.eta_range.first,
+                                                    cfg.eta_range.second};
+    // Uniform in 1/pT, like the bulk of the particles in a collision.
+    std::uniform_real_distribution<scalar> inv_pt_dist{
+        1.f / cfg.pt_range.second, 1.f / cfg.pt_range.first};
+    std::normal_distribution<scalar> vertex_dist{0.f, cfg.vertex_z_stddev};
+    std::normal_distribution<scalar> rphi_dist{0.f, cfg.resolution_rphi};
+    std::normal_distribution<scalar> z_dist{0.f, cfg.resolution_z};
+    std::bernoulli_distribution charge_dist{0.5};
+
+    spacepoint_collection_types::host result{&mr};
+    const std::size_t n_particles = pileup * cfg.particles_per_vertex;
+    result.reserve(n_particles * cfg.layer_radii.size());
+
+    // Helper function adding one spacepoint.
+    auto add_spacepoint = [&](scalar r, scalar phi, scalar z,
+                              std::size_t layer) {
+        spacepoint sp;
+        sp.global = {r * std::cos(phi), r * std::sin(phi), z};
+        sp.meas.local = {r * phi, z};
+        sp.meas.variance = {cfg.resolution_rphi * cfg.resolution_rphi,
+                            cfg.resolution_z * cfg.resolution_z};
+        sp.meas.surface_link = detray::geometry::barcode{layer};
+        sp.meas.measurement_id = result.size();
+        result.push_back(sp);
+    };
+
+    // Generate the signal spacepoints.
+    for (std::size_t i = 0; i < n_particles; ++i) {
+
+        const scalar z0 = vertex_dist(gen);
+        const scalar phi0 = phi_dist(gen);
+        const scalar cot_theta = std::sinh(eta_dist(gen));
+        const scalar pt = 1.f / inv_pt_dist(gen);
+        const scalar charge = charge_dist(gen) ? 1.f : -1.f;
+
+        // Radius of the helix in the transverse plane. (pT [GeV] = 0.3 B [T]
+        // R [m])
+        const scalar radius = (pt / unit<scalar>::GeV) /
+                              (0.299792458f * cfg.bfield / unit<scalar>::T) *
+                              unit<scalar>::m;
+
+        for (std::size_t layer = 0; layer < cfg.layer_radii.size(); ++layer) {
+
+            const scalar r = cfg.layer_radii[layer];
+            if (r >= 2.f * radius) {
+                // The particle curls up before reaching this layer.
+                break;
+            }
+            const scalar half_angle = std::asin(r / (2.f * radius));
+            const scalar phi =
+                phi0 - charge * half_angle + rphi_dist(gen) / r;
+            const scalar z =
+                z0 + cot_theta * 2.f * radius * half_angle + z_dist(gen);
+            add_spacepoint(r, phi, z, layer);
+        }
+    }
+
+    // Generate the noise spacepoints.
+    const auto n_noise =
+        static_cast<std::size_t>(cfg.noise_fraction *
+                                 static_cast<scalar>(result.size()));
+    std::uniform_int_distribution<std::size_t> layer_dist{
+        0u, cfg.layer_radii.size() - 1u};
+    for (std::size_t i = 0; i < n_noise; ++i) {
+        const std::size_t layer = layer_dist(gen);
+        const scalar r = cfg.layer_radii[layer];
+        const scalar z = r * std::sinh(eta_dist(gen));
+        add_spacepoint(r, phi_dist(gen), z, layer);
+    }
+
+    return result;
+}
+
+/// Generate a random, but physically sensible set of bound track parameters
+///
+/// @param gen The random number generator to use
+/// @return Parameters with a diagonal covariance of realistic magnitude
+///
+template <typename generator_t>
+inline bound_track_parameters generate_bound_parameters(generator_t& gen) {
+
+    using matrix_operator = detray::dmatrix_operator<default_algebra>;
+
+    std::uniform_real_distribution<scalar> loc_dist{-10.f * unit<scalar>::mm,
+                                                    10.f * unit<scalar>::mm};
+    std::uniform_real_distribution<scalar> phi_dist{-constant<scalar>::pi,
+                                                    constant<scalar>::pi};
+    std::uniform_real_distribution<scalar> theta_dist{0.2f, 2.9f};
+    std::uniform_real_distribution<scalar> qop_dist{
+        -1.f / unit<scalar>::GeV, 1.f / unit<scalar>::GeV};
+
+    bound_track_parameters params;
+    auto& vec = params.vector();
+    matrix_operator().element(vec, e_bound_loc0, 0) = loc_dist(gen);
+    matrix_operator().element(vec, e_bound_loc1, 0) = loc_dist(gen);
+    matrix_operator().element(vec, e_bound_phi, 0) = phi_dist(gen);
+    matrix_operator().element(vec, e_bound_theta, 0) = theta_dist(gen);
+    matrix_operator().element(vec, e_bound_qoverp, 0) = qop_dist(gen);
+    matrix_operator().element(vec, e_bound_time, 0) = 0.f;
+
+    static constexpr std::array<scalar, e_bound_size> stddevs = {
+        0.1f * unit<scalar>::mm,
+        0.1f * unit<scalar>::mm,
+        0.01f,
+        0.01f,
+        0.01f / unit<scalar>::GeV,
+        1.f * unit<scalar>::ns};
+    params.covariance() =
+        matrix_operator().template zero<e_bound_size, e_bound_size>();
+    for (std::size_t i = 0; i < e_bound_size; ++i) {
+        matrix_operator().element(params.covariance(), i, i) =
+            stddevs[i] * stddevs[i];
+    }
+    return params;
+}
+
+/// Generate track states for benchmarking the Kalman filter primitives
+///
+/// Every state receives a 2D measurement, and predicted/filtered/smoothed
+/// parameters that are consistent enough for the gain matrix updater and
+/// smoother to operate on them.
+///
+/// @param n_states The number of track states to generate
+/// @param seed The seed of the random number generator
+///
+inline std::vector<track_state<default_algebra> > generate_track_states(
+    std::size_t n_states, unsigned int seed = 42u) {
+
+    using matrix_operator = detray::dmatrix_operator<default_algebra>;
+
+    std::mt19937 gen{seed};
+    std::normal_distribution<scalar> offset_dist{0.f,
+                                                 0.05f * unit<scalar>::mm};
+    std::normal_distribution<scalar> jacobian_dist{0.f, 0.01f};
+
+    std::vector<track_state<default_algebra> > result;
+    result.reserve(n_states);
+    for (std::size_t i = 0; i < n_states; ++i) {
+
+        // Predicted parameters.
+        bound_track_parameters predicted = generate_bound_parameters(gen);
+        predicted.set_surface_link(detray::geometry::barcode{i});
+
+        // Measurement close to the predicted position.
+        measurement meas;
+        meas.local = {
+            matrix_operator().element(predicted.vector(), e_bound_loc0, 0) +
+                offset_dist(gen),
+            matrix_operator().element(predicted.vector(), e_bound_loc1, 0) +
+                offset_dist(gen)};
+        const scalar variance =
+            0.05f * unit<scalar>::mm * 0.05f * unit<scalar>::mm;
+        meas.variance = {variance, variance};
+        meas.surface_link = detray::geometry::barcode{i};
+        meas.measurement_id = i;
+
+        track_state<default_algebra> state{meas};
+
+        // A transport jacobian close to unity.
+        state.jacobian() =
+            matrix_operator().template identity<e_bound_size, e_bound_size>();
+        for (std::size_t row = 0; row < e_bound_size; ++row) {
+            for (std::size_t col = 0; col < e_bound_size; ++col) {
+                matrix_operator().element(state.jacobian(), row, col) +=
+                    jacobian_dist(gen);
+            }
+        }
+
+        // Filter the state once, so that it has valid filtered parameters,
+        // and use those as the smoothed parameters as well.
+        bound_track_parameters params = predicted;
+        gain_matrix_updater<default_algebra>{}
+            .template update<2u, detray::rectangle2D>(state, params);
+        state.smoothed() = state.filtered();
+        state.is_hole = false;
+
+        result.push_back(state);
+    }
+
+    return result;
+}
+
+/// Generate fitted tracks sharing some of their measurements
+///
+/// Meant for benchmarking the ambiguity resolution. Tracks are drawn from a
+/// pool of measurements, such that the requested fraction of them ends up
+/// being a "duplicate" of another track, sharing most of its measurements.
+///
+/// @param mr The memory resource to create the container with
+/// @param n_tracks The number of track candidates to generate
+/// @param states_per_track The number of measurements on every track
+/// @param duplicate_fraction The fraction of tracks to make duplicates
+/// @param seed The seed of the random number generator
+///
+inline track_state_container_types::host generate_ambiguous_tracks(
+    vecmem::memory_resource& mr, std::size_t n_tracks,
+    std::size_t states_per_track = 10u, double duplicate_fraction = 0.3,
+    unsigned int seed = 42u) {
+
+    std::mt19937 gen{seed};
+    std::uniform_real_distribution<scalar> chi2_dist{0.5f, 2.f};
+    std::bernoulli_distribution duplicate_dist{duplicate_fraction};
+    std::uniform_int_distribution<std::size_t> state_dist{
+        0u, states_per_track - 1u};
+
+    track_state_container_types::host result{&mr};
+    std::size_t next_measurement_id = 0u;
+    for (std::size_t i = 0; i < n_tracks; ++i) {
+
+        vecmem::vector<track_state<default_algebra> > states{&mr};
+        states.reserve(states_per_track);
+
+        if ((result.size() > 0u) && duplicate_dist(gen)) {
+            // Copy an existing track, replacing one of its measurements.
+            std::uniform_int_distribution<std::size_t> track_dist{
+                0u, result.size() - 1u};
+            const std::size_t original = track_dist(gen);
+            const std::size_t replaced = state_dist(gen);
+            for (std::size_t j = 0; j < states_per_track; ++j) {
+                measurement meas =
+                    result.get_items()[original][j].get_measurement();
+                if (j == replaced) {
+                    meas.measurement_id = next_measurement_id++;
+                }
+                states.push_back(track_state<default_algebra>{meas});
+            }
+        } else {
+            // Create a new track with new measurements.
+            for (std::size_t j = 0; j < states_per_track; ++j) {
+                measurement meas;
+                meas.surface_link = detray::geometry::barcode{j};
+                meas.measurement_id = next_measurement_id++;
+                states.push_back(track_state<default_algebra>{meas});
+            }
+        }
+
+        fitting_result<default_algebra> fit_res;
+        fit_res.ndf = static_cast<scalar>(2u * states_per_track - 5u);
+        fit_res.chi2 = chi2_dist(gen) * fit_res.ndf;
+        result.push_back(std::move(fit_res), std::move(states));
+    }
+
+    return result;
+}
+
+}  // namespace traccc::benchmarks
@@ -0,0 +1,278 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/utils/seed_generator.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace traccc::benchmarks {
+
+/// In-memory telescope detector, with truth tracks propagated through it
+///
+/// Used for benchmarking the track finding and fitting without having to
+/// simulate and read back event files.
+///
+class telescope_tracks {
+
+    public:
+    /// @name Type declarations
+    /// @{
+    using detector_type =
+        detray::detector<detray::telescope_metadata<detray::rectangle2D>>;
+    using algebra_type = typename detector_type::algebra_type;
+    using b_field_type = covfie::field<detray::bfield::const_bknd_t>;
+    using rk_stepper_type =
+        detray::rk_stepper<b_field_type::view_t, algebra_type,
+                           detray::constrained_step<>>;
+    using navigator_type = detray::navigator<const detector_type>;
+    /// @}
+
+    /// B field of the setup
+    static constexpr vector3 B{2.f * detray::unit<scalar>::T, 0.f, 0.f};
+    /// Measurement smearing of the telescope planes
+    static constexpr std::array<scalar, 2u> smearing{
+        50.f * detray::unit<scalar>::um, 50.f * detray::unit<scalar>::um};
+    /// Standard deviations of the (smeared truth) seed parameters
+    static constexpr std::array<scalar, e_bound_size> seed_stddevs = {
+        0.03f * detray::unit<scalar>::mm,
+        0.03f * detray::unit<scalar>::mm,
+        0.017f,
+        0.017f,
+        0.001f / detray::unit<scalar>::GeV,
+        1.f * detray::unit<scalar>::ns};
+
+    /// Actor recording (smeared) measurements on the sensitive surfaces
+    struct measurement_recorder : detray::actor {
+
+        struct state {
+            /// Random number generator for the smearing
+            std::mt19937 generator{42u};
+            /// The measurements of all tracks
+            std::vector<measurement> measurements;
+            /// The measurements of the current track
+            std::vector<measurement> track_measurements;
+            /// The free parameters of the track on its first surface
+            free_track_parameters first_params;
+            /// The surface of the first measurement of the track
+            detray::geometry::barcode first_surface;
+        };
+
+        template <typename propagator_state_t>
+        void operator()(state& recorder_state,
+                        propagator_state_t& propagation) const {
+
+            auto& navigation = propagation._navigation;
+            auto& stepping = propagation._stepping;
+
+            // Only consider sensitive surfaces.
+            if (!navigation.is_on_sensitive()) {
+                return;
+            }
+
+            // Remember where the track started.
+            if (recorder_state.track_measurements.empty()) {
+                recorder_state.first_params = stepping();
+                recorder_state.first_surface =
+                    navigation.get_surface().barcode();
+            }
+
+            // Create a smeared measurement.
+            const auto& bound_params = stepping._bound_params;
+            measurement meas;
+            meas.local = {
+                bound_params.bound_local()[0] +
+                    std::normal_distribution<scalar>(
+                        0.f, smearing[0])(recorder_state.generator),
+                bound_params.bound_local()[1] +
+                    std::normal_distribution<scalar>(
+                        0.f, smearing[1])(recorder_state.generator)};
+            meas.variance = {smearing[0] * smearing[0],
+                             smearing[1] * smearing[1]};
+            meas.surface_link = navigation.get_surface().barcode();
+            meas.measurement_id = recorder_state.measurements.size() +
+                                  recorder_state.track_measurements.size();
+            recorder_state.track_measurements.push_back(meas);
+        }
+    };
+
+    /// Constructor, building the detector
+    ///
+    /// @param mr The memory resource to build the detector with
+    /// @param n_planes The number of telescope planes
+    ///
+    explicit telescope_tracks(vecmem::memory_resource& mr,
+                              std::size_t n_planes = 9u)
+        : m_mr(mr), m_field(detray::bfield::create_const_field(B)) {
+
+        // Plane positions, along the x-axis.
+        std::vector<scalar> plane_positions;
+        for (std::size_t i = 0; i < n_planes; ++i) {
+            plane_positions.push_back(static_cast<scalar>(i) * 20.f *
+                                      detray::unit<scalar>::mm);
+        }
+
+        detray::tel_det_config<> tel_cfg{
+            detray::mask<detray::rectangle2D>{0u, 100000.f, 100000.f}};
+        tel_cfg.positions(plane_positions);
+        tel_cfg.module_material(detray::silicon_tml<scalar>{});
+        tel_cfg.mat_thickness(0.5f * detray::unit<scalar>::mm);
+        tel_cfg.pilot_track(detray::detail::ray<traccc::default_algebra>{
+            {0, 0, 0}, 0, {1, 0, 0}, -1});
+
+        auto [det, names] = detray::build_telescope_detector(mr, tel_cfg);
+        m_detector = std::make_unique<detector_type>(std::move(det));
+    }
+
+    /// Propagate a number of truth tracks through the telescope
+    ///
+    /// @param n_tracks The number of tracks to generate
+    /// @param seed The seed of the random number generators
+    ///
+    void generate(std::size_t n_tracks, unsigned int seed = 42u) {
+
+        using uniform_gen_t = detray::detail::random_numbers<
+            scalar, std::uniform_real_distribution<scalar>>;
+        using generator_type =
+            detray::random_track_generator<free_track_parameters,
+                                           uniform_gen_t>;
+        using actor_chain_type = detray::actor_chain<
+            detray::dtuple, detray::parameter_transporter<algebra_type>,
+            detray::parameter_resetter<algebra_type>, measurement_recorder>;
+        using propagator_type =
+            detray::propagator<rk_stepper_type, navigator_type,
+                               actor_chain_type>;
+
+        // Generate tracks along the telescope axis.
+        generator_type::configuration gen_cfg{};
+        gen_cfg.n_tracks(n_tracks);
+        gen_cfg.origin({0.f, 0.f, 0.f});
+        gen_cfg.origin_stddev({0.f, 200.f * detray::unit<scalar>::mm,
+                               200.f * detray::unit<scalar>::mm});
+        gen_cfg.phi_range(0.f, 0.f);
+        gen_cfg.theta_range(constant<scalar>::pi_2, constant<scalar>::pi_2);
+        gen_cfg.mom_range(1.f * detray::unit<scalar>::GeV,
+                          10.f * detray::unit<scalar>::GeV);
+        gen_cfg.charge(-1.f);
+        gen_cfg.seed(seed);
+        generator_type generator(gen_cfg);
+
+        // Seed generator.
+        seed_generator<detector_type> sg(*m_detector, seed_stddevs, seed);
+
+        m_measurements.clear();
+        m_seeds.clear();
+        m_candidates.clear();
+
+        typename detray::parameter_transporter<algebra_type>::state
+            transporter{};
+        typename detray::parameter_resetter<algebra_type>::state resetter{};
+        typename measurement_recorder::state recorder{};
+        recorder.generator.seed(seed);
+        auto actor_states = std::tie(transporter, resetter, recorder);
+
+        propagator_type p{detray::propagation::config{}};
+        for (auto track : generator) {
+
+            recorder.track_measurements.clear();
+            typename propagator_type::state propagation(track, m_field,
+                                                        *m_detector);
+            p.propagate(propagation, actor_states);
+            if (recorder.track_measurements.empty()) {
+                continue;
+            }
+
+            // Save the truth information of the track.
+            const bound_track_parameters seed_params =
+                sg(recorder.first_surface, recorder.first_params);
+            m_seeds.push_back(seed_params);
+            m_candidates.push_back(
+                seed_params,
+                vecmem::vector<track_candidate>(
+                    recorder.track_measurements.begin(),
+                    recorder.track_measurements.end(), &m_mr.get()));
+            recorder.measurements.insert(recorder.measurements.end(),
+                                         recorder.track_measurements.begin(),
+                                         recorder.track_measurements.end());
+        }
+
+        // The track finding expects the measurements sorted by surface.
+        std::sort(recorder.measurements.begin(), recorder.measurements.end(),
+                  measurement_sort_comp());
+        m_measurements.assign(recorder.measurements.begin(),
+                              recorder.measurements.end());
+    }
+
+    /// The telescope detector
+    const detector_type& detector() const { return *m_detector; }
+    /// The magnetic field
+    const b_field_type& field() const { return m_field; }
+    /// All measurements of the generated tracks, sorted by surface
+    const measurement_collection_types::host& measurements() const {
+        return m_measurements;
+    }
+    /// (Smeared) truth seeds of the generated tracks
+    const bound_track_parameters_collection_types::host& seeds() const {
+        return m_seeds;
+    }
+    /// Truth track candidates of the generated tracks
+    const track_candidate_container_types::host& candidates() const {
+        return m_candidates;
+    }
+
+    private:
+    /// Memory resource used for the data
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// The detector
+    std::unique_ptr<detector_type> m_detector;
+    /// The magnetic field
+    b_field_type m_field;
+
+    /// @name Generated data
+    /// @{
+    measurement_collection_types::host m_measurements{&m_mr.get()};
+    bound_track_parameters_collection_types::host m_seeds{&m_mr.get()};
+    track_candidate_container_types::host m_candidates{&m_mr.get()};
+    /// @}
+
+};  // class telescope_tracks
+
+}  // namespace traccc::benchmarks
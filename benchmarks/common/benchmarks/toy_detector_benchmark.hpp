@@ -9,7 +9,12 @@
 #include "traccc/definitions/common.hpp"
 #include "traccc/finding/finding_algorithm.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/io/data_format.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/read_spacepoints.hpp"
 #include "traccc/io/utils.hpp"
+#include "traccc/io/write.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 #include "traccc/simulation/measurement_smearer.hpp"
@@ -34,19 +39,44 @@
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
 
-// Boost include(s).
-#include <boost/filesystem.hpp>
-
 // Google Benchmark include(s).
 #include <benchmark/benchmark.h>
 
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// Fixture running the full chain on simulated toy detector events
+///
+/// The simulated events are cached on disk, in the binary event format, in a
+/// directory named after a hash of everything that the simulation depends on.
+/// So the (slow) simulation only needs to be run once per configuration,
+/// while every subsequent benchmark run (and every benchmark case of the same
+/// run) uses the same, reproducible input.
+///
 class ToyDetectorBenchmark : public benchmark::Fixture {
     public:
     static const int n_events = 100u;
     static const int n_tracks = 5000u;
+    /// Seed of the track generator (the simulation seeds by event ID)
+    static const unsigned int seed = 42u;
 
-    std::vector<traccc::spacepoint_collection_types::host> spacepoints;
-    std::vector<traccc::measurement_collection_types::host> measurements;
+    /// Input data of the benchmarks, shared by all benchmark cases
+    struct input_data {
+        /// Spacepoints of all events
+        std::vector<traccc::spacepoint_collection_types::host> spacepoints;
+        /// Measurements of all events
+        std::vector<traccc::measurement_collection_types::host> measurements;
+    };
 
     // Configs
     traccc::seedfinder_config seeding_cfg;
@@ -62,6 +92,18 @@ class ToyDetectorBenchmark : public benchmark::Fixture {
     static constexpr std::array<float, 2> mom_range{
         10.f * traccc::unit<float>::GeV, 100.f * traccc::unit<float>::GeV};
 
+    /// Toy detector layout
+    static constexpr unsigned int n_brl_layers = 4u;
+    static constexpr unsigned int n_edc_layers = 7u;
+    // @TODO: Increase the material budget again
+    static constexpr traccc::scalar module_mat_thickness =
+        0.11f * detray::unit<traccc::scalar>::mm;
+
+    /// Smearing of the simulated measurements
+    static constexpr traccc::scalar smearing =
+        50.f * detray::unit<traccc::scalar>::um;
+
+    /// Directory holding the cached data of all configurations
     static inline const std::string sim_dir = "toy_detector_benchmark/";
 
     // Detector type
@@ -74,7 +116,85 @@ class ToyDetectorBenchmark : public benchmark::Fixture {
     static constexpr traccc::vector3 B{0, 0,
                                        2 * detray::unit<traccc::scalar>::T};
 
-    ToyDetectorBenchmark() {
+    static detray::toy_det_config get_toy_config() {
+
+        // Create the toy geometry
+        detray::toy_det_config toy_cfg{};
+        toy_cfg.n_brl_layers(n_brl_layers)
+            .n_edc_layers(n_edc_layers)
+            .do_check(false);
+        toy_cfg.module_mat_thickness(module_mat_thickness);
+
+        return toy_cfg;
+    }
+
+    /// Description of everything that the simulated data depends on
+    static std::string cache_description() {
+
+        std::ostringstream desc;
+        desc << std::setprecision(9);
+        desc << "n_events = " << n_events << "\n"
+             << "n_tracks = " << n_tracks << "\n"
+             << "seed = " << seed << "\n"
+             << "n_brl_layers = " << n_brl_layers << "\n"
+             << "n_edc_layers = " << n_edc_layers << "\n"
+             << "module_mat_thickness = " << module_mat_thickness << "\n"
+             << "phi_range = " << phi_range[0] << ", " << phi_range[1] << "\n"
+             << "theta_range = " << theta_range[0] << ", " << theta_range[1]
+             << "\n"
+             << "mom_range = " << mom_range[0] << ", " << mom_range[1] << "\n"
+             << "smearing = " << smearing << "\n"
+             << "B = " << B[0] << ", " << B[1] << ", " << B[2] << "\n";
+        return desc.str();
+    }
+
+    /// Directory (relative to the data directory) of the cached data
+    ///
+    /// It is named after the (64-bit FNV-1a) hash of @c cache_description(),
+    /// which is stable across platforms and compilers, unlike @c std::hash.
+    ///
+    static std::string cache_directory() {
+
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char c : cache_description()) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3ull;
+        }
+        std::ostringstream dir;
+        dir << sim_dir << std::hex << std::setw(16) << std::setfill('0')
+            << hash << "/";
+        return dir.str();
+    }
+
+    /// Absolute path of the directory holding the detector description files
+    static std::string detector_directory() {
+        return traccc::io::data_directory() + cache_directory();
+    }
+
+    /// Access the (cached) input data of the benchmarks
+    ///
+    /// The data is simulated the first time it is needed (if it is not found
+    /// in the cache), and is only read into memory once per process.
+    ///
+    static const input_data& input() {
+
+        static const input_data data = [] {
+            const std::filesystem::path cache_path =
+                std::filesystem::path(detector_directory()).parent_path();
+            if (!std::filesystem::exists(cache_path / manifest_file)) {
+                simulate(cache_path);
+            }
+            return read_input();
+        }();
+        return data;
+    }
+
+    private:
+    /// Name of the file marking a complete cache entry
+    static inline const std::string manifest_file = "manifest.txt";
+
+    /// Simulate the events, and put them into the cache
+    static void simulate(const std::filesystem::path& cache_path) {
 
         std::cout << "Please be patient. It may take some time to generate "
                      "the simulation data."
@@ -103,12 +223,12 @@ class ToyDetectorBenchmark : public benchmark::Fixture {
         gen_cfg.phi_range(phi_range);
         gen_cfg.theta_range(theta_range);
         gen_cfg.mom_range(mom_range);
+        gen_cfg.seed(seed);
         generator_type generator(gen_cfg);
 
         // Smearing value for measurements
         traccc::measurement_smearer<traccc::default_algebra> meas_smearer(
-            50 * detray::unit<traccc::scalar>::um,
-            50 * detray::unit<traccc::scalar>::um);
+            smearing, smearing);
 
         // Type declarations
         using writer_type = traccc::smearing_writer<
@@ -117,15 +237,17 @@ class ToyDetectorBenchmark : public benchmark::Fixture {
         // Writer config
         typename writer_type::config smearer_writer_cfg{meas_smearer};
 
-        // Run simulator
-        const std::string full_path = traccc::io::data_directory() + sim_dir;
-
-        boost::filesystem::create_directories(full_path);
+        // Simulate into a private directory first, so that concurrently
+        // running benchmarks would never see a half-written cache entry.
+        std::filesystem::path tmp_path = cache_path;
+        tmp_path += ".tmp" + std::to_string(std::random_device{}());
+        std::filesystem::create_directories(tmp_path);
+        const std::string tmp_dir = tmp_path.native() + "/";
 
         auto sim = traccc::simulator<detector_type, b_field_t, generator_type,
                                      writer_type>(
             n_events, det, field, std::move(generator),
-            std::move(smearer_writer_cfg), full_path);
+            std::move(smearer_writer_cfg), tmp_dir);
 
         // Set constrained step size to 1 mm
         sim.get_config().propagation.stepping.step_constraint =
@@ -133,54 +255,74 @@ class ToyDetectorBenchmark : public benchmark::Fixture {
 
         sim.run();
 
+        // Convert the events to the binary format.
+        const traccc::geometry surface_transforms =
+            traccc::io::alt_read_geometry(det);
+        for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
+
+            traccc::io::spacepoint_reader_output readOut(&host_mr);
+            traccc::io::read_spacepoints(readOut, i_evt, tmp_dir,
+                                         surface_transforms);
+            traccc::io::write(i_evt, tmp_dir, traccc::data_format::binary,
+                              vecmem::get_data(readOut.spacepoints),
+                              vecmem::get_data(readOut.modules));
+
+            traccc::io::measurement_reader_output meas_read_out(&host_mr);
+            traccc::io::read_measurements(meas_read_out, i_evt, tmp_dir);
+            traccc::io::write(i_evt, tmp_dir, traccc::data_format::binary,
+                              vecmem::get_data(meas_read_out.measurements),
+                              vecmem::get_data(meas_read_out.modules));
+        }
+
         // Write detector file
         auto writer_cfg = detray::io::detector_writer_config{}
                               .format(detray::io::format::json)
                               .replace_files(true)
                               .write_grids(true)
                               .write_material(true)
-                              .path(sim_dir);
+                              .path(tmp_dir);
         detray::io::write_detector(det, name_map, writer_cfg);
-    }
-
-    detray::toy_det_config get_toy_config() const {
-
-        // Create the toy geometry
-        detray::toy_det_config toy_cfg{};
-        toy_cfg.n_brl_layers(4u).n_edc_layers(7u).do_check(false);
 
-        // @TODO: Increase the material budget again
-        toy_cfg.module_mat_thickness(0.11f * detray::unit<traccc::scalar>::mm);
-
-        return toy_cfg;
+        // Mark the entry as complete, and move it into place. If another
+        // process got there first, just use its (identical) data.
+        std::ofstream(tmp_path / manifest_file) << cache_description();
+        std::error_code ec;
+        std::filesystem::rename(tmp_path, cache_path, ec);
+        if (ec) {
+            std::filesystem::remove_all(tmp_path);
+        }
+        if (!std::filesystem::exists(cache_path / manifest_file)) {
+            throw std::runtime_error("Could not create cache entry " +
+                                     cache_path.native());
+        }
     }
 
-    void SetUp(::benchmark::State& /*state*/) {
+    /// Read the events from the cache
+    static input_data read_input() {
 
         // VecMem memory resource(s)
-        vecmem::host_memory_resource host_mr;
+        static vecmem::host_memory_resource host_mr;
 
-        // Build the detector
-        auto [det, name_map] =
-            detray::build_toy_detector(host_mr, get_toy_config());
+        input_data result;
+        result.spacepoints.reserve(n_events);
+        result.measurements.reserve(n_events);
 
-        // Read geometry
-        traccc::geometry surface_transforms =
-            traccc::io::alt_read_geometry(det);
-
-        // Read events
+        const std::string dir = cache_directory();
         for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
 
             // Read the hits from the relevant event file
             traccc::io::spacepoint_reader_output readOut(&host_mr);
-            traccc::io::read_spacepoints(readOut, i_evt, sim_dir,
-                                         surface_transforms);
-            spacepoints.push_back(readOut.spacepoints);
+            traccc::io::read_spacepoints(readOut, i_evt, dir, {},
+                                         traccc::data_format::binary);
+            result.spacepoints.push_back(std::move(readOut.spacepoints));
 
             // Read measurements
             traccc::io::measurement_reader_output meas_read_out(&host_mr);
-            traccc::io::read_measurements(meas_read_out, i_evt, sim_dir);
-            measurements.push_back(meas_read_out.measurements);
+            traccc::io::read_measurements(meas_read_out, i_evt, dir,
+                                          traccc::data_format::binary);
+            result.measurements.push_back(
+                std::move(meas_read_out.measurements));
         }
+        return result;
     }
 };
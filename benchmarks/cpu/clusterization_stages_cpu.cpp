@@ -0,0 +1,104 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Traccc algorithm include(s).
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/measurement_creation_algorithm.hpp"
+#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
+
+// Local include(s).
+#include "benchmarks/synthetic_data.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstddef>
+#include <optional>
+
+/// Fixture providing the cells of a synthetic event
+///
+/// The arguments of the benchmarks are the number of modules and the number
+/// of cells per module.
+///
+class ClusterizationStageBenchmark : public benchmark::Fixture {
+    public:
+    // Memory resource
+    vecmem::host_memory_resource host_mr;
+
+    /// Cells and modules of the event
+    std::optional<traccc::benchmarks::synthetic_cells> input;
+
+    void SetUp(::benchmark::State& state) override {
+        input.emplace(traccc::benchmarks::generate_cells(
+            host_mr, static_cast<std::size_t>(state.range(0)),
+            static_cast<std::size_t>(state.range(1))));
+    }
+
+    void TearDown(::benchmark::State&) override { input.reset(); }
+};
+
+BENCHMARK_DEFINE_F(ClusterizationStageBenchmark, SparseCCL)
+(benchmark::State& state) {
+
+    traccc::host::sparse_ccl_algorithm cc(host_mr);
+    const auto cells_data = vecmem::get_data(input->cells);
+
+    for (auto _ : state) {
+        const auto clusters = cc(cells_data);
+        benchmark::DoNotOptimize(clusters.size());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(input->cells.size()));
+}
+
+BENCHMARK_DEFINE_F(ClusterizationStageBenchmark, MeasurementCreation)
+(benchmark::State& state) {
+
+    traccc::host::sparse_ccl_algorithm cc(host_mr);
+    traccc::host::measurement_creation_algorithm mc(host_mr);
+    const auto clusters = cc(vecmem::get_data(input->cells));
+    const auto clusters_data = traccc::get_data(clusters);
+    const auto modules_data = vecmem::get_data(input->modules);
+
+    for (auto _ : state) {
+        const auto measurements = mc(clusters_data, modules_data);
+        benchmark::DoNotOptimize(measurements.size());
+    }
+    // Items are the clusters.
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(clusters.size()));
+}
+
+BENCHMARK_DEFINE_F(ClusterizationStageBenchmark, Clusterization)
+(benchmark::State& state) {
+
+    traccc::host::clusterization_algorithm ca(host_mr);
+    const auto cells_data = vecmem::get_data(input->cells);
+    const auto modules_data = vecmem::get_data(input->modules);
+
+    for (auto _ : state) {
+        const auto measurements = ca(cells_data, modules_data);
+        benchmark::DoNotOptimize(measurements.size());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(input->cells.size()));
+}
+
+/// Register a clusterization stage benchmark for a range of occupancies
+#define TRACCC_CLUSTERIZATION_STAGE_BENCHMARK(NAME)                   \
+    BENCHMARK_REGISTER_F(ClusterizationStageBenchmark, NAME)          \
+        ->ArgNames({"modules", "cells_per_module"})                   \
+        ->ArgsProduct({{1000, 5000}, {16, 64, 256}})                  \
+        ->Unit(benchmark::kMillisecond)
+
+TRACCC_CLUSTERIZATION_STAGE_BENCHMARK(SparseCCL);
+TRACCC_CLUSTERIZATION_STAGE_BENCHMARK(MeasurementCreation);
+TRACCC_CLUSTERIZATION_STAGE_BENCHMARK(Clusterization);
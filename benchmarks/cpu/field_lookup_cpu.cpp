@@ -0,0 +1,169 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Traccc algorithm include(s).
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/utils/cached_field_view.hpp"
+#include "traccc/utils/field_map.hpp"
+
+// Local include(s).
+#include "benchmarks/synthetic_tracks.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace {
+
+/// Type of the tracks used in the benchmarks
+using tracks_type = traccc::benchmarks::telescope_tracks;
+
+/// Stepper type using a given magnetic field (view) type
+template <typename field_t>
+using stepper_type = detray::rk_stepper<field_t, tracks_type::algebra_type,
+                                        detray::constrained_step<>>;
+
+/// Run the track finding with a given magnetic field
+template <typename field_t>
+void run_finding(benchmark::State& state, const tracks_type& tracks,
+                 const field_t& field) {
+
+    using finding_algorithm_type =
+        traccc::finding_algorithm<stepper_type<field_t>,
+                                  tracks_type::navigator_type>;
+    typename finding_algorithm_type::config_type cfg;
+    finding_algorithm_type finding(cfg);
+
+    for (auto _ : state) {
+        const auto candidates = finding(tracks.detector(), field,
+                                        tracks.measurements(), tracks.seeds());
+        benchmark::DoNotOptimize(candidates.size());
+    }
+    // Items are the seeds.
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(tracks.seeds().size()));
+}
+
+/// Run the track fitting with a given magnetic field
+template <typename field_t>
+void run_fitting(benchmark::State& state, const tracks_type& tracks,
+                 const field_t& field) {
+
+    using fitting_algorithm_type =
+        traccc::fitting_algorithm<traccc::kalman_fitter<
+            stepper_type<field_t>, tracks_type::navigator_type>>;
+    typename fitting_algorithm_type::config_type cfg;
+    fitting_algorithm_type fitting(cfg);
+
+    for (auto _ : state) {
+        const auto track_states =
+            fitting(tracks.detector(), field, tracks.candidates());
+        benchmark::DoNotOptimize(track_states.size());
+    }
+    // Items are the track candidates.
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(tracks.candidates().size()));
+}
+
+}  // namespace
+
+/// Fixture providing truth tracks in an in-memory telescope detector, and a
+/// field map describing the same (constant) field that the tracks were
+/// generated with
+///
+/// The first argument of the benchmarks is the number of tracks.
+///
+class FieldLookupBenchmark : public benchmark::Fixture {
+    public:
+    // Memory resource
+    vecmem::host_memory_resource host_mr;
+
+    /// The detector and the tracks propagated through it
+    std::optional<tracks_type> tracks;
+    /// Field map around the telescope
+    traccc::field_map map;
+
+    void SetUp(::benchmark::State& state) override {
+        tracks.emplace(host_mr);
+        tracks->generate(static_cast<std::size_t>(state.range(0)));
+
+        // Use a 2 cm grid, as a realistic map of a solenoid would.
+        static constexpr traccc::scalar spacing =
+            20.f * detray::unit<traccc::scalar>::mm;
+        const traccc::darray<traccc::field_map::index_type, 3> n_nodes{
+            21u, 101u, 101u};
+        const std::size_t n_total =
+            static_cast<std::size_t>(n_nodes[0]) * n_nodes[1] * n_nodes[2];
+        map = traccc::field_map{
+            {-100.f * detray::unit<traccc::scalar>::mm,
+             -1000.f * detray::unit<traccc::scalar>::mm,
+             -1000.f * detray::unit<traccc::scalar>::mm},
+            {spacing, spacing, spacing},
+            n_nodes,
+            std::vector<traccc::scalar>(n_total, tracks_type::B[0]),
+            std::vector<traccc::scalar>(n_total, tracks_type::B[1]),
+            std::vector<traccc::scalar>(n_total, tracks_type::B[2])};
+    }
+
+    void TearDown(::benchmark::State&) override { tracks.reset(); }
+};
+
+BENCHMARK_DEFINE_F(FieldLookupBenchmark, FindingConstantField)
+(benchmark::State& state) {
+    run_finding<tracks_type::b_field_type::view_t>(state, *tracks,
+                                                   tracks->field());
+}
+
+BENCHMARK_DEFINE_F(FieldLookupBenchmark, FindingRawMap)
+(benchmark::State& state) {
+    run_finding(state, *tracks, traccc::field_map_view{map});
+}
+
+BENCHMARK_DEFINE_F(FieldLookupBenchmark, FindingCachedMap)
+(benchmark::State& state) {
+    run_finding(state, *tracks, traccc::cached_field_view{map});
+}
+
+BENCHMARK_DEFINE_F(FieldLookupBenchmark, FittingConstantField)
+(benchmark::State& state) {
+    run_fitting<tracks_type::b_field_type::view_t>(state, *tracks,
+                                                   tracks->field());
+}
+
+BENCHMARK_DEFINE_F(FieldLookupBenchmark, FittingRawMap)
+(benchmark::State& state) {
+    run_fitting(state, *tracks, traccc::field_map_view{map});
+}
+
+BENCHMARK_DEFINE_F(FieldLookupBenchmark, FittingCachedMap)
+(benchmark::State& state) {
+    run_fitting(state, *tracks, traccc::cached_field_view{map});
+}
+
+/// Register a field lookup benchmark for a range of track multiplicities
+#define TRACCC_FIELD_LOOKUP_BENCHMARK(NAME)          \
+    BENCHMARK_REGISTER_F(FieldLookupBenchmark, NAME) \
+        ->ArgName("tracks")                          \
+        ->Arg(100)                                   \
+        ->Arg(1000)                                  \
+        ->Unit(benchmark::kMillisecond)
+
+TRACCC_FIELD_LOOKUP_BENCHMARK(FindingConstantField);
+TRACCC_FIELD_LOOKUP_BENCHMARK(FindingRawMap);
+TRACCC_FIELD_LOOKUP_BENCHMARK(FindingCachedMap);
+TRACCC_FIELD_LOOKUP_BENCHMARK(FittingConstantField);
+TRACCC_FIELD_LOOKUP_BENCHMARK(FittingRawMap);
+TRACCC_FIELD_LOOKUP_BENCHMARK(FittingCachedMap);
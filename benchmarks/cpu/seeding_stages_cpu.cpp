@@ -0,0 +1,281 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Traccc algorithm include(s).
+#include "traccc/seeding/doublet_finding.hpp"
+#include "traccc/seeding/seed_filtering.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+#include "traccc/seeding/triplet_finding.hpp"
+
+// Local include(s).
+#include "benchmarks/synthetic_data.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/// Fixture providing the (intermediate) seeding data of a synthetic event
+///
+/// The first argument of the benchmarks is the pileup of the event.
+///
+class SeedingStageBenchmark : public benchmark::Fixture {
+    public:
+    // Configs
+    traccc::seedfinder_config finder_cfg;
+    traccc::seedfilter_config filter_cfg;
+    traccc::spacepoint_grid_config grid_cfg{finder_cfg};
+
+    // Memory resource
+    vecmem::host_memory_resource host_mr;
+
+    /// Spacepoints of the event
+    std::optional<traccc::spacepoint_collection_types::host> spacepoints;
+    /// Spacepoint grid of the event
+    std::optional<traccc::sp_grid> grid;
+
+    /// Location of all middle spacepoint candidates
+    std::vector<traccc::sp_location> middles;
+    /// Doublets (and their line transforms) of the middle spacepoints
+    std::vector<std::pair<traccc::doublet_collection_types::host,
+                          traccc::lin_circle_collection_types::host> >
+        mid_bot, mid_top;
+    /// Triplets of the middle spacepoints
+    std::vector<traccc::triplet_collection_types::host> triplets;
+
+    void SetUp(::benchmark::State& state) override {
+
+        // Generate the spacepoints.
+        spacepoints.emplace(traccc::benchmarks::generate_spacepoints(
+            host_mr, static_cast<std::size_t>(state.range(0))));
+
+        // Bin them.
+        traccc::spacepoint_binning binning(finder_cfg, grid_cfg, host_mr);
+        grid.emplace(binning(*spacepoints));
+
+        // Find all doublets and triplets.
+        traccc::doublet_finding<traccc::details::spacepoint_type::bottom>
+            mid_bot_finding(finder_cfg);
+        traccc::doublet_finding<traccc::details::spacepoint_type::top>
+            mid_top_finding(finder_cfg);
+        traccc::triplet_finding triplet_finding(finder_cfg);
+        for (unsigned int i = 0; i < grid->nbins(); ++i) {
+            for (unsigned int j = 0; j < grid->bin(i).size(); ++j) {
+
+                const traccc::sp_location spM{i, j};
+                auto bot = mid_bot_finding(*grid, spM);
+                auto top = mid_top_finding(*grid, spM);
+                if (bot.first.empty() || top.first.empty()) {
+                    continue;
+                }
+
+                // Find the triplets of every bottom doublet separately, as
+                // traccc::seed_finding does.
+                traccc::triplet_collection_types::host triplets_per_spM,
+                    triplets_per_doublet;
+                for (unsigned int k = 0; k < bot.first.size(); ++k) {
+                    triplets_per_doublet.clear();
+                    triplet_finding(*grid, bot.first[k], bot.second[k],
+                                    top.first, top.second,
+                                    triplets_per_doublet);
+                    triplets_per_spM.insert(triplets_per_spM.end(),
+                                            triplets_per_doublet.begin(),
+                                            triplets_per_doublet.end());
+                }
+
+                middles.push_back(spM);
+                mid_bot.push_back(std::move(bot));
+                mid_top.push_back(std::move(top));
+                triplets.push_back(std::move(triplets_per_spM));
+            }
+        }
+    }
+
+    void TearDown(::benchmark::State&) override {
+
+        triplets.clear();
+        mid_top.clear();
+        mid_bot.clear();
+        middles.clear();
+        grid.reset();
+        spacepoints.reset();
+    }
+};
+
+BENCHMARK_DEFINE_F(SeedingStageBenchmark, SpacepointBinning)
+(benchmark::State& state) {
+
+    traccc::spacepoint_binning binning(finder_cfg, grid_cfg, host_mr);
+
+    for (auto _ : state) {
+        traccc::sp_grid g = binning(*spacepoints);
+        benchmark::DoNotOptimize(g.nbins());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(spacepoints->size()));
+}
+
+BENCHMARK_DEFINE_F(SeedingStageBenchmark, FlatSpacepointBinning)
+(benchmark::State& state) {
+
+    traccc::spacepoint_binning binning(finder_cfg, grid_cfg, host_mr);
+    traccc::flat_sp_grid g(binning.axes(), host_mr);
+
+    for (auto _ : state) {
+        binning(*spacepoints, g);
+        benchmark::DoNotOptimize(g.spacepoints().data());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(spacepoints->size()));
+}
+
+BENCHMARK_DEFINE_F(SeedingStageBenchmark, DoubletFinding)
+(benchmark::State& state) {
+
+    traccc::doublet_finding<traccc::details::spacepoint_type::bottom>
+        mid_bot_finding(finder_cfg);
+    traccc::doublet_finding<traccc::details::spacepoint_type::top>
+        mid_top_finding(finder_cfg);
+
+    std::size_t n_doublets = 0;
+    for (auto _ : state) {
+        n_doublets = 0;
+        for (unsigned int i = 0; i < grid->nbins(); ++i) {
+            for (unsigned int j = 0; j < grid->bin(i).size(); ++j) {
+                const traccc::sp_location spM{i, j};
+                n_doublets += mid_bot_finding(*grid, spM).first.size();
+                n_doublets += mid_top_finding(*grid, spM).first.size();
+            }
+        }
+        benchmark::DoNotOptimize(n_doublets);
+    }
+    // Items are the middle spacepoint candidates.
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(spacepoints->size()));
+    state.counters["doublets"] = static_cast<double>(n_doublets);
+}
+
+BENCHMARK_DEFINE_F(SeedingStageBenchmark, TripletFinding)
+(benchmark::State& state) {
+
+    traccc::triplet_finding triplet_finding(finder_cfg);
+    traccc::triplet_collection_types::host triplets_per_doublet;
+
+    std::size_t n_triplets = 0;
+    for (auto _ : state) {
+        n_triplets = 0;
+        for (std::size_t i = 0; i < middles.size(); ++i) {
+            const auto& [bot_doublets, bot_lines] = mid_bot[i];
+            const auto& [top_doublets, top_lines] = mid_top[i];
+            for (std::size_t k = 0; k < bot_doublets.size(); ++k) {
+                triplets_per_doublet.clear();
+                triplet_finding(*grid, bot_doublets[k], bot_lines[k],
+                                top_doublets, top_lines, triplets_per_doublet);
+                n_triplets += triplets_per_doublet.size();
+            }
+        }
+        benchmark::DoNotOptimize(n_triplets);
+    }
+    // Items are the middle-bottom doublets.
+    std::size_t n_doublets = 0;
+    for (const auto& bot : mid_bot) {
+        n_doublets += bot.first.size();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(n_doublets));
+    state.counters["triplets"] = static_cast<double>(n_triplets);
+}
+
+BENCHMARK_DEFINE_F(SeedingStageBenchmark, SortedTripletFinding)
+(benchmark::State& state) {
+
+    traccc::triplet_finding triplet_finding(finder_cfg);
+    traccc::sorted_top_doublets sorted_tops;
+    traccc::triplet_collection_types::host triplets_per_doublet;
+
+    std::size_t n_triplets = 0;
+    for (auto _ : state) {
+        n_triplets = 0;
+        for (std::size_t i = 0; i < middles.size(); ++i) {
+            const auto& [bot_doublets, bot_lines] = mid_bot[i];
+            const auto& [top_doublets, top_lines] = mid_top[i];
+            sorted_tops.fill(top_lines);
+            for (std::size_t k = 0; k < bot_doublets.size(); ++k) {
+                triplets_per_doublet.clear();
+                triplet_finding(*grid, bot_doublets[k], bot_lines[k],
+                                top_doublets, top_lines, sorted_tops,
+                                triplets_per_doublet);
+                n_triplets += triplets_per_doublet.size();
+            }
+        }
+        benchmark::DoNotOptimize(n_triplets);
+    }
+    // Items are the middle-bottom doublets.
+    std::size_t n_doublets = 0;
+    for (const auto& bot : mid_bot) {
+        n_doublets += bot.first.size();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(n_doublets));
+    state.counters["triplets"] = static_cast<double>(n_triplets);
+}
+
+BENCHMARK_DEFINE_F(SeedingStageBenchmark, SeedFiltering)
+(benchmark::State& state) {
+
+    traccc::seed_filtering seed_filtering(filter_cfg);
+    traccc::seed_filtering::scratch_type scratch;
+
+    std::size_t n_seeds = 0;
+    for (auto _ : state) {
+
+        // The filter modifies the triplets, so give it a fresh copy every
+        // time.
+        state.PauseTiming();
+        std::vector<traccc::triplet_collection_types::host> input = triplets;
+        state.ResumeTiming();
+
+        traccc::seed_collection_types::host seeds;
+        for (auto& triplets_per_spM : input) {
+            seed_filtering(*spacepoints, *grid, triplets_per_spM, seeds,
+                           scratch);
+        }
+        n_seeds = seeds.size();
+        benchmark::DoNotOptimize(n_seeds);
+    }
+    // Items are the triplets.
+    std::size_t n_triplets = 0;
+    for (const auto& triplets_per_spM : triplets) {
+        n_triplets += triplets_per_spM.size();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(n_triplets));
+    state.counters["seeds"] = static_cast<double>(n_seeds);
+}
+
+/// Register a seeding stage benchmark for a range of pileup values
+#define TRACCC_SEEDING_STAGE_BENCHMARK(NAME)               \
+    BENCHMARK_REGISTER_F(SeedingStageBenchmark, NAME)      \
+        ->ArgName("pileup")                                \
+        ->Arg(50)                                          \
+        ->Arg(100)                                         \
+        ->Arg(200)                                         \
+        ->Unit(benchmark::kMillisecond)
+
+TRACCC_SEEDING_STAGE_BENCHMARK(SpacepointBinning);
+TRACCC_SEEDING_STAGE_BENCHMARK(FlatSpacepointBinning);
+TRACCC_SEEDING_STAGE_BENCHMARK(DoubletFinding);
+TRACCC_SEEDING_STAGE_BENCHMARK(TripletFinding);
+TRACCC_SEEDING_STAGE_BENCHMARK(SortedTripletFinding);
+TRACCC_SEEDING_STAGE_BENCHMARK(SeedFiltering);
@@ -49,8 +49,12 @@ BENCHMARK_F(ToyDetectorBenchmark, CPU)(benchmark::State& state) {
     // VecMem memory resource(s)
     vecmem::host_memory_resource host_mr;
 
+    // (Cached) input data
+    const auto& spacepoints = input().spacepoints;
+    const auto& measurements = input().measurements;
+
     // Read back detector file
-    const std::string path = sim_dir;
+    const std::string path = detector_directory();
     detray::io::detector_reader_config reader_cfg{};
     reader_cfg.add_file(path + "toy_detector_geometry.json")
         .add_file(path + "toy_detector_homogeneous_material.json")
@@ -0,0 +1,334 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Traccc algorithm include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_smoother.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+
+// Local include(s).
+#include "benchmarks/synthetic_data.hpp"
+#include "benchmarks/synthetic_tracks.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+/// @return the name of the scalar type of an algebra
+template <typename algebra_t>
+std::string scalar_name() {
+    return std::is_same_v<detray::dscalar<algebra_t>, double> ? "double"
+                                                              : "float";
+}
+
+/// Set the precision of a fit as the label of a benchmark
+template <typename fitter_t>
+void set_precision_label(benchmark::State& state) {
+    state.SetLabel(
+        "storage:" + scalar_name<typename fitter_t::algebra_type>() +
+        ",kalman:" +
+        scalar_name<typename fitter_t::precision_algebra_type>());
+}
+
+/// Set counters describing the quality of fitted tracks
+///
+/// The mean chi2/NDoF of the tracks, and the RMS of the residuals between
+/// the smoothed parameters and the measurements, in the first local
+/// coordinate.
+///
+void set_fit_quality_counters(
+    benchmark::State& state,
+    const traccc::track_state_container_types::host& track_states) {
+
+    double chi2_sum = 0.;
+    double residual2_sum = 0.;
+    std::size_t n_residuals = 0;
+    for (std::size_t i = 0; i < track_states.size(); ++i) {
+        const auto& fit_res = track_states[i].header;
+        chi2_sum += static_cast<double>(fit_res.chi2 / fit_res.ndf);
+        for (const auto& trk_state : track_states[i].items) {
+            if (trk_state.is_hole) {
+                continue;
+            }
+            const double residual =
+                static_cast<double>(trk_state.get_measurement().local[0]) -
+                static_cast<double>(traccc::getter::element(
+                    trk_state.smoothed().vector(), traccc::e_bound_loc0, 0u));
+            residual2_sum += residual * residual;
+            ++n_residuals;
+        }
+    }
+    if (track_states.size() > 0) {
+        state.counters["chi2_per_ndf"] =
+            chi2_sum / static_cast<double>(track_states.size());
+    }
+    if (n_residuals > 0) {
+        state.counters["residual_rms"] =
+            std::sqrt(residual2_sum / static_cast<double>(n_residuals));
+    }
+}
+
+/// Benchmark the track fitting with a given fitter type
+///
+/// Labels the benchmark with the precision of the fit, and reports the
+/// quality of the fitted tracks, for comparing the fits done in different
+/// precisions.
+///
+template <typename fitter_t>
+void fitting_benchmark(benchmark::State& state,
+                       const traccc::benchmarks::telescope_tracks& tracks) {
+
+    using fitting_algorithm_t = traccc::fitting_algorithm<fitter_t>;
+    typename fitting_algorithm_t::config_type cfg;
+    fitting_algorithm_t fitting(cfg);
+
+    std::optional<typename fitting_algorithm_t::output_type> track_states;
+    for (auto _ : state) {
+        track_states.emplace(
+            fitting(tracks.detector(), tracks.field(), tracks.candidates()));
+        benchmark::DoNotOptimize(track_states->size());
+    }
+    // Items are the track candidates.
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(tracks.candidates().size()));
+    state.counters["time_per_track"] = benchmark::Counter(
+        static_cast<double>(tracks.candidates().size()),
+        benchmark::Counter::kIsIterationInvariantRate |
+            benchmark::Counter::kInvert);
+    set_precision_label<fitter_t>(state);
+    if (track_states) {
+        set_fit_quality_counters(state, *track_states);
+    }
+}
+
+}  // namespace
+
+/// Fixture providing truth tracks in an in-memory telescope detector
+///
+/// The first argument of the benchmarks is the number of tracks.
+///
+class TelescopeTrackingBenchmark : public benchmark::Fixture {
+    public:
+    // Type declarations
+    using tracks_type = traccc::benchmarks::telescope_tracks;
+    using finding_algorithm_type =
+        traccc::finding_algorithm<tracks_type::rk_stepper_type,
+                                  tracks_type::navigator_type>;
+    using fitter_type =
+        traccc::kalman_fitter<tracks_type::rk_stepper_type,
+                              tracks_type::navigator_type>;
+    using fitting_algorithm_type = traccc::fitting_algorithm<fitter_type>;
+    /// Fitter doing the Kalman updates and smoothing with a given algebra
+    template <typename precision_algebra_t>
+    using precision_fitter_type =
+        traccc::kalman_fitter<tracks_type::rk_stepper_type,
+                              tracks_type::navigator_type,
+                              precision_algebra_t>;
+
+    // Memory resource
+    vecmem::host_memory_resource host_mr;
+
+    /// The detector and the tracks propagated through it
+    std::optional<tracks_type> tracks;
+
+    void SetUp(::benchmark::State& state) override {
+        tracks.emplace(host_mr);
+        tracks->generate(static_cast<std::size_t>(state.range(0)));
+    }
+
+    void TearDown(::benchmark::State&) override { tracks.reset(); }
+};
+
+BENCHMARK_DEFINE_F(TelescopeTrackingBenchmark, CombinatorialKalmanFilter)
+(benchmark::State& state) {
+
+    finding_algorithm_type::config_type cfg;
+    finding_algorithm_type finding(cfg);
+
+    std::size_t n_candidates = 0;
+    for (auto _ : state) {
+        const auto candidates =
+            finding(tracks->detector(), tracks->field(),
+                    tracks->measurements(), tracks->seeds());
+        n_candidates = candidates.size();
+        benchmark::DoNotOptimize(n_candidates);
+    }
+    // Items are the seeds.
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(tracks->seeds().size()));
+    state.counters["candidates"] = static_cast<double>(n_candidates);
+}
+
+BENCHMARK_DEFINE_F(TelescopeTrackingBenchmark, KalmanFitter)
+(benchmark::State& state) {
+    fitting_benchmark<fitter_type>(state, *tracks);
+}
+
+/// The fit with the Kalman updates and smoothing in the storage precision
+BENCHMARK_DEFINE_F(TelescopeTrackingBenchmark, KalmanFitterStoragePrecision)
+(benchmark::State& state) {
+    fitting_benchmark<precision_fitter_type<traccc::default_algebra>>(
+        state, *tracks);
+}
+
+/// The fit with the Kalman updates and smoothing in double precision
+BENCHMARK_DEFINE_F(TelescopeTrackingBenchmark, KalmanFitterDoublePrecision)
+(benchmark::State& state) {
+    fitting_benchmark<precision_fitter_type<traccc::double_precision_algebra>>(
+        state, *tracks);
+}
+
+BENCHMARK_DEFINE_F(TelescopeTrackingBenchmark, KalmanFilterOnly)
+(benchmark::State& state) {
+
+    fitting_algorithm_type::config_type cfg;
+    cfg.filter_only = true;
+    cfg.output_level = traccc::fitting_output_level::perigee;
+    fitting_algorithm_type fitting(cfg);
+
+    for (auto _ : state) {
+        const auto track_states =
+            fitting(tracks->detector(), tracks->field(), tracks->candidates());
+        benchmark::DoNotOptimize(track_states.size());
+    }
+    // Items are the track candidates.
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<int64_t>(tracks->candidates().size()));
+    state.counters["time_per_track"] = benchmark::Counter(
+        static_cast<double>(tracks->candidates().size()),
+        benchmark::Counter::kIsIterationInvariantRate |
+            benchmark::Counter::kInvert);
+}
+
+/// Register a tracking benchmark for a range of track multiplicities
+#define TRACCC_TRACKING_STAGE_BENCHMARK(NAME)              \
+    BENCHMARK_REGISTER_F(TelescopeTrackingBenchmark, NAME) \
+        ->ArgName("tracks")                                \
+        ->Arg(10)                                          \
+        ->Arg(100)                                         \
+        ->Arg(1000)                                        \
+        ->Unit(benchmark::kMillisecond)
+
+TRACCC_TRACKING_STAGE_BENCHMARK(CombinatorialKalmanFilter);
+TRACCC_TRACKING_STAGE_BENCHMARK(KalmanFitter);
+TRACCC_TRACKING_STAGE_BENCHMARK(KalmanFitterStoragePrecision);
+TRACCC_TRACKING_STAGE_BENCHMARK(KalmanFitterDoublePrecision);
+TRACCC_TRACKING_STAGE_BENCHMARK(KalmanFilterOnly);
+
+/// Benchmark of the gain matrix update of individual track states
+///
+/// The update being calculated with @c precision_algebra_t.
+///
+template <typename precision_algebra_t>
+static void BM_KalmanUpdate(benchmark::State& state) {
+
+    auto states = traccc::benchmarks::generate_track_states(
+        static_cast<std::size_t>(state.range(0)));
+    const traccc::gain_matrix_updater<traccc::default_algebra,
+                                      precision_algebra_t>
+        updater{};
+
+    for (auto _ : state) {
+        for (auto& trk_state : states) {
+            traccc::bound_track_parameters params = trk_state.predicted();
+            updater.template update<2u, detray::rectangle2D>(trk_state,
+                                                              params);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(states.size()));
+}
+BENCHMARK_TEMPLATE(BM_KalmanUpdate, traccc::default_algebra)
+    ->ArgName("states")
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_KalmanUpdate, traccc::double_precision_algebra)
+    ->ArgName("states")
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+
+/// Benchmark of the (backward) smoothing of track states
+///
+/// The smoothing being calculated with @c precision_algebra_t.
+///
+template <typename precision_algebra_t>
+static void BM_KalmanSmoother(benchmark::State& state) {
+
+    auto states = traccc::benchmarks::generate_track_states(
+        static_cast<std::size_t>(state.range(0)));
+    const traccc::gain_matrix_smoother<traccc::default_algebra,
+                                       precision_algebra_t>
+        smoother{};
+
+    for (auto _ : state) {
+        // Smooth the states as if they all belonged to a single track.
+        for (std::size_t i = states.size() - 1; i > 0; --i) {
+            smoother.template smoothe<2u, detray::rectangle2D>(states[i - 1],
+                                                               states[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(states.size() - 1));
+}
+BENCHMARK_TEMPLATE(BM_KalmanSmoother, traccc::default_algebra)
+    ->ArgName("states")
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_KalmanSmoother, traccc::double_precision_algebra)
+    ->ArgName("states")
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+
+/// Benchmark of the greedy ambiguity resolution
+static void BM_AmbiguityResolution(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto track_states = traccc::benchmarks::generate_ambiguous_tracks(
+        host_mr, static_cast<std::size_t>(state.range(0)));
+
+    traccc::greedy_ambiguity_resolution_algorithm::config_t cfg;
+    cfg.verbose_warning = false;
+    traccc::greedy_ambiguity_resolution_algorithm resolution(cfg);
+
+    std::size_t n_resolved = 0;
+    for (auto _ : state) {
+        const auto resolved = resolution(track_states);
+        n_resolved = resolved.size();
+        benchmark::DoNotOptimize(n_resolved);
+    }
+    // Items are the track candidates.
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(track_states.size()));
+    state.counters["resolved"] = static_cast<double>(n_resolved);
+}
+BENCHMARK(BM_AmbiguityResolution)
+    ->ArgName("candidates")
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Arg(20000)
+    ->Unit(benchmark::kMillisecond);
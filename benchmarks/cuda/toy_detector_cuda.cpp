@@ -66,8 +66,12 @@ BENCHMARK_F(ToyDetectorBenchmark, CUDA)(benchmark::State& state) {
     traccc::cuda::stream stream;
     vecmem::cuda::async_copy async_copy{stream.cudaStream()};
 
+    // (Cached) input data
+    const auto& spacepoints = input().spacepoints;
+    const auto& measurements = input().measurements;
+
     // Read back detector file
-    const std::string path = sim_dir;
+    const std::string path = detector_directory();
     detray::io::detector_reader_config reader_cfg{};
     reader_cfg.add_file(path + "toy_detector_geometry.json")
         .add_file(path + "toy_detector_homogeneous_material.json")
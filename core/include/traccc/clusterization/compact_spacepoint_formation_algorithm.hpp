@@ -0,0 +1,59 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/compact_spacepoint.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc::host {
+
+/// Algorithm forming compact space points out of measurements
+///
+/// The same as @c traccc::host::spacepoint_formation_algorithm, but the
+/// spacepoints refer to the measurements by their index in the measurement
+/// collection, instead of holding a copy of them.
+///
+class compact_spacepoint_formation_algorithm
+    : public algorithm<compact_spacepoint_collection_types::host(
+          const measurement_collection_types::const_view&,
+          const cell_module_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for compact_spacepoint_formation
+    ///
+    /// @param mr is the memory resource
+    ///
+    compact_spacepoint_formation_algorithm(vecmem::memory_resource& mr);
+
+    /// Callable operator for the formation of compact space points
+    ///
+    /// @param measurements_view A collection of measurements
+    /// @param modules_view A collection of modules the measurements link to
+    /// @return A compact spacepoint collection, with one spacepoint for every
+    ///         measurement
+    ///
+    output_type operator()(
+        const measurement_collection_types::const_view& measurements_view,
+        const cell_module_collection_types::const_view& modules_view)
+        const override;
+
+    private:
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+
+};  // class compact_spacepoint_formation_algorithm
+
+}  // namespace traccc::host
@@ -10,6 +10,7 @@
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/cell.hpp"
+#include "traccc/edm/compact_spacepoint.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/spacepoint.hpp"
 
@@ -25,6 +26,17 @@ TRACCC_HOST_DEVICE inline void fill_spacepoint(spacepoint& sp,
                                                const measurement& meas,
                                                const cell_module& mod);
 
+/// Function helping with filling/setting up a compact spacepoint object
+///
+/// @param sp The compact spacepoint to fill / set up
+/// @param meas The measurement to create the spacepoint out of
+/// @param meas_index The index of the measurement in its collection
+/// @param mod The module that the measurement belongs to
+///
+TRACCC_HOST_DEVICE inline void fill_spacepoint(
+    compact_spacepoint& sp, const measurement& meas,
+    compact_spacepoint::link_type meas_index, const cell_module& mod);
+
 }  // namespace traccc::details
 
 // Include the implementation.
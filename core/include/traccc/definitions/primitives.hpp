@@ -22,6 +22,11 @@
 // System include(s)
 #include <cstdint>
 
+// Do the Kalman updates in the default precision, unless specified otherwise
+#ifndef TRACCC_KALMAN_SCALARTYPE
+#define TRACCC_KALMAN_SCALARTYPE TRACCC_CUSTOM_SCALARTYPE
+#endif
+
 namespace traccc {
 
 using geometry_id = std::uint64_t;
@@ -30,6 +35,12 @@ using channel_id = unsigned int;
 // Default algebra type
 using default_algebra = ALGEBRA_PLUGIN<traccc::scalar>;
 
+// Double precision algebra type, for numerically sensitive calculations
+using double_precision_algebra = ALGEBRA_PLUGIN<double>;
+
+// Algebra type of the Kalman updates and smoothing of the track fit
+using kalman_algebra = ALGEBRA_PLUGIN<TRACCC_KALMAN_SCALARTYPE>;
+
 using scalar = detray::dscalar<default_algebra>;
 using point2 = detray::dpoint2D<default_algebra>;
 using vector2 = point2;
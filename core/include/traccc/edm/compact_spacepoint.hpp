@@ -0,0 +1,66 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/math.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+/// A compact spacepoint expressed in global coordinates
+///
+/// Unlike @c traccc::spacepoint, it does not hold a copy of the measurement
+/// that it was created from. Only the index of that measurement in the
+/// event's measurement collection. Making it a much smaller object to read
+/// during the spacepoint binning and the seeding.
+///
+struct compact_spacepoint {
+
+    /// Type used for the measurement index
+    using link_type = unsigned int;
+
+    /// The global position of the spacepoint in 3D space
+    point3 global{0., 0., 0.};
+    /// The index of the measurement that the spacepoint was created from
+    link_type measurement_index = 0;
+
+    TRACCC_HOST_DEVICE
+    const scalar& x() const { return global[0]; }
+    TRACCC_HOST_DEVICE
+    const scalar& y() const { return global[1]; }
+    TRACCC_HOST_DEVICE
+    const scalar& z() const { return global[2]; }
+    TRACCC_HOST_DEVICE
+    scalar radius() const {
+        return std::sqrt(global[0] * global[0] + global[1] * global[1]);
+    }
+};
+
+/// Equality operator for compact spacepoints
+TRACCC_HOST_DEVICE
+inline bool operator==(const compact_spacepoint& lhs,
+                       const compact_spacepoint& rhs) {
+
+    return ((math::fabs(lhs.x() - rhs.x()) < float_epsilon) &&
+            (math::fabs(lhs.y() - rhs.y()) < float_epsilon) &&
+            (math::fabs(lhs.z() - rhs.z()) < float_epsilon) &&
+            (lhs.measurement_index == rhs.measurement_index));
+}
+
+/// Declare all compact spacepoint collection types
+using compact_spacepoint_collection_types =
+    collection_types<compact_spacepoint>;
+
+}  // namespace traccc
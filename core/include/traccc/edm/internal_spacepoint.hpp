@@ -34,7 +34,10 @@ struct internal_spacepoint {
 
     internal_spacepoint() = default;
 
-    TRACCC_HOST_DEVICE internal_spacepoint(const spacepoint_t& sp,
+    /// Constructor from a spacepoint of any type with a global position
+    /// (@c spacepoint_t itself, or a compact version of it)
+    template <typename input_spacepoint_t>
+    TRACCC_HOST_DEVICE internal_spacepoint(const input_spacepoint_t& sp,
                                            const link_type sp_link,
                                            const vector2& offsetXY)
         : m_link(sp_link) {
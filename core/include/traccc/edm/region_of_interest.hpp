@@ -0,0 +1,56 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+/// A region of interest in the detector
+///
+/// It describes the tracks coming from a z range on the beam line, going in
+/// an eta-phi window. Allowing the reconstruction to only look at the parts of
+/// the detector that such tracks would cross.
+///
+/// The phi window may wrap around at phi = +-pi, in which case @c phi_min is
+/// larger than @c phi_max.
+///
+struct region_of_interest {
+
+    /// The pseudorapidity window of the region
+    scalar eta_min = -4.f;
+    scalar eta_max = 4.f;
+    /// The azimuthal window of the region
+    scalar phi_min = -static_cast<scalar>(M_PI);
+    scalar phi_max = static_cast<scalar>(M_PI);
+    /// The z range on the beam line that the region's tracks come from
+    scalar z_min = -250.f * unit<scalar>::mm;
+    scalar z_max = 250.f * unit<scalar>::mm;
+
+    /// Check whether an azimuthal angle is inside the window of the region
+    TRACCC_HOST_DEVICE
+    bool contains_phi(scalar phi) const {
+        if (phi_min <= phi_max) {
+            return ((phi >= phi_min) && (phi <= phi_max));
+        }
+        return ((phi >= phi_min) || (phi <= phi_max));
+    }
+};
+
+/// Declare all region of interest collection types
+using region_of_interest_collection_types =
+    collection_types<region_of_interest>;
+
+}  // namespace traccc
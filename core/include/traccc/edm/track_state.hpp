@@ -197,6 +197,10 @@ struct track_state {
 
     public:
     bool is_hole{true};
+    /// Whether the surface of the state is a line surface, as found by the
+    /// forward filtering (so that the smoother would not need to look up
+    /// the surface again)
+    bool is_line{false};
 
     private:
     detray::geometry::barcode m_surface_link;
@@ -210,6 +214,57 @@ struct track_state {
     bound_track_parameters_type m_smoothed;
 };
 
+/// Compact fitting result per measurement
+///
+/// Holds only the smoothed track parameters of a @c traccc::track_state,
+/// without the predicted and filtered parameters, and the transport jacobian.
+///
+template <typename algebra_t>
+struct smoothed_track_state {
+
+    using scalar_type = detray::dscalar<algebra_t>;
+
+    using bound_track_parameters_type =
+        detray::bound_track_parameters<algebra_t>;
+
+    smoothed_track_state() = default;
+
+    /// Construction from a (full) track state
+    TRACCC_HOST_DEVICE
+    explicit smoothed_track_state(const track_state<algebra_t>& state)
+        : is_hole(state.is_hole),
+          m_measurement(state.get_measurement()),
+          m_smoothed_chi2(state.smoothed_chi2()),
+          m_smoothed(state.smoothed()) {}
+
+    /// @return the surface link
+    TRACCC_HOST_DEVICE
+    inline detray::geometry::barcode surface_link() const {
+        return m_smoothed.surface_link();
+    }
+
+    /// @return the measurement
+    TRACCC_HOST_DEVICE
+    inline const measurement& get_measurement() const { return m_measurement; }
+
+    /// @return the chi square of smoothed parameter
+    TRACCC_HOST_DEVICE
+    inline const scalar_type& smoothed_chi2() const { return m_smoothed_chi2; }
+
+    /// @return the smoothed parameter
+    TRACCC_HOST_DEVICE
+    inline const bound_track_parameters_type& smoothed() const {
+        return m_smoothed;
+    }
+
+    bool is_hole{true};
+
+    private:
+    measurement m_measurement;
+    scalar_type m_smoothed_chi2 = 0.f;
+    bound_track_parameters_type m_smoothed;
+};
+
 /// Declare all track_state collection types
 using track_state_collection_types =
     collection_types<track_state<default_algebra>>;
@@ -219,4 +274,13 @@ using track_state_container_types =
     container_types<fitting_result<default_algebra>,
                     track_state<default_algebra>>;
 
+/// Declare all smoothed_track_state collection types
+using smoothed_track_state_collection_types =
+    collection_types<smoothed_track_state<default_algebra>>;
+
+/// Declare all smoothed_track_state container types
+using smoothed_track_state_container_types =
+    container_types<fitting_result<default_algebra>,
+                    smoothed_track_state<default_algebra>>;
+
 }  // namespace traccc
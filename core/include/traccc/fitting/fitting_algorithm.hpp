@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -15,6 +15,9 @@
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <stdexcept>
+
 namespace traccc {
 
 /// Fitting algorithm for a set of tracks
@@ -34,7 +37,18 @@ class fitting_algorithm
     /// Constructor for the fitting algorithm
     ///
     /// @param cfg  Configuration object
-    fitting_algorithm(const config_type& cfg) : m_cfg(cfg) {}
+    ///
+    /// @throws std::invalid_argument if the smoothed output level is
+    ///         requested
+    ///
+    fitting_algorithm(const config_type& cfg) : m_cfg(cfg) {
+        if (m_cfg.output_level == fitting_output_level::smoothed) {
+            throw std::invalid_argument(
+                "The smoothed output level is not supported by "
+                "traccc::fitting_algorithm, use "
+                "traccc::smoothed_fitting_algorithm for it");
+        }
+    }
 
     /// Run the algorithm
     ///
@@ -73,9 +87,16 @@ class fitting_algorithm
             // Run fitter
             fitter.fit(seed_param, fitter_state);
 
-            output_states.push_back(
-                std::move(fitter_state.m_fit_res),
-                std::move(fitter_state.m_fit_actor_state.m_track_states));
+            // Only keep the track states if they were asked for.
+            if (m_cfg.output_level == fitting_output_level::perigee) {
+                output_states.push_back(
+                    std::move(fitter_state.m_fit_res),
+                    vecmem::vector<track_state<algebra_type>>{});
+            } else {
+                output_states.push_back(
+                    std::move(fitter_state.m_fit_res),
+                    std::move(fitter_state.m_fit_actor_state.m_track_states));
+            }
         }
 
         return output_states;
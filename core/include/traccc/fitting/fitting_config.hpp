@@ -13,11 +13,35 @@
 
 namespace traccc {
 
+/// Level of detail of the track states produced by the track fitting
+enum class fitting_output_level {
+    /// Predicted, filtered and smoothed parameters, and the transport jacobian
+    /// on every surface
+    full,
+    /// Only the smoothed parameters on every surface
+    smoothed,
+    /// Only the fitted parameters at the first surface of the track
+    perigee
+};
+
 /// Configuration struct for track fitting
 struct fitting_config {
 
     std::size_t n_iterations = 1;
 
+    /// The track states to store in the output of the fit
+    fitting_output_level output_level = fitting_output_level::full;
+
+    /// Only run the forward filtering, without smoothing the tracks
+    ///
+    /// The chi2 and NDoF of the tracks are accumulated from the filtered
+    /// chi2 values during the filtering, and the fitted parameters are the
+    /// filtered parameters on the last measurement of the tracks. The
+    /// smoothed parameters of the track states are not set, and only a
+    /// single iteration is run, irrespective of @c n_iterations. (So
+    /// @c traccc::smoothed_fitting_algorithm does not accept it.)
+    bool filter_only = false;
+
     /// Propagation configuration
     detray::propagation::config propagation{};
 };
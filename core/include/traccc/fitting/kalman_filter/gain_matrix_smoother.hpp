@@ -11,20 +11,29 @@
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/track_parameters.hpp"
 #include "traccc/edm/track_state.hpp"
+#include "traccc/utils/matrix_conversion.hpp"
+
+// Detray include(s).
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
 
 namespace traccc {
 
 /// Type unrolling functor to smooth the track parameters after the Kalman
 /// filtering
-template <typename algebra_t>
+///
+/// The track states are stored with @c algebra_t, while the smoothing itself
+/// is calculated with @c precision_algebra_t.
+///
+template <typename algebra_t, typename precision_algebra_t = algebra_t>
 struct gain_matrix_smoother {
 
     // Type declarations
-    using scalar_type = detray::dscalar<algebra_t>;
-    using matrix_operator = detray::dmatrix_operator<algebra_t>;
-    using size_type = detray::dsize_type<algebra_t>;
+    using scalar_type = detray::dscalar<precision_algebra_t>;
+    using matrix_operator = detray::dmatrix_operator<precision_algebra_t>;
+    using size_type = detray::dsize_type<precision_algebra_t>;
     template <size_type ROWS, size_type COLS>
-    using matrix_type = detray::dmatrix<algebra_t, ROWS, COLS>;
+    using matrix_type = detray::dmatrix<precision_algebra_t, ROWS, COLS>;
 
     /// Gain matrix smoother operation
     ///
@@ -55,6 +64,36 @@ struct gain_matrix_smoother {
         }
     }
 
+    /// Gain matrix smoother operation, without visiting the detector
+    ///
+    /// Uses the kind of the surface cached in the current track state by the
+    /// forward filtering, instead of the mask of the surface. (The smoothed
+    /// chi2 of holes, which are not updated during the filtering, is
+    /// calculated as if they were not on line surfaces.)
+    ///
+    /// @param cur_state track state of the current surface
+    /// @param next_state track state of the next surface
+    TRACCC_HOST_DEVICE inline void operator()(
+        track_state<algebra_t>& cur_state,
+        const track_state<algebra_t>& next_state) const {
+
+        const auto D = cur_state.get_measurement().meas_dim;
+        assert(D == 1u || D == 2u);
+        if (cur_state.is_line) {
+            if (D == 1u) {
+                smoothe<1u, detray::line<false>>(cur_state, next_state);
+            } else if (D == 2u) {
+                smoothe<2u, detray::line<false>>(cur_state, next_state);
+            }
+        } else {
+            if (D == 1u) {
+                smoothe<1u, detray::rectangle2D>(cur_state, next_state);
+            } else if (D == 2u) {
+                smoothe<2u, detray::rectangle2D>(cur_state, next_state);
+            }
+        }
+    }
+
     template <size_type D, typename shape_t>
     TRACCC_HOST_DEVICE inline void smoothe(
         track_state<algebra_t>& cur_state,
@@ -69,22 +108,25 @@ struct gain_matrix_smoother {
         const auto& cur_filtered = cur_state.filtered();
 
         // Next track state parameters
-        const matrix_type<e_bound_size, e_bound_size>& next_jacobian =
-            next_state.jacobian();
-        const matrix_type<e_bound_size, 1>& next_smoothed_vec =
-            next_smoothed.vector();
-        const matrix_type<e_bound_size, e_bound_size>& next_smoothed_cov =
-            next_smoothed.covariance();
-        const matrix_type<e_bound_size, 1>& next_predicted_vec =
-            next_predicted.vector();
-        const matrix_type<e_bound_size, e_bound_size>& next_predicted_cov =
-            next_predicted.covariance();
+        const matrix_type<e_bound_size, e_bound_size> next_jacobian =
+            to_precision<e_bound_size, e_bound_size>(next_state.jacobian());
+        const matrix_type<e_bound_size, 1> next_smoothed_vec =
+            to_precision<e_bound_size, 1>(next_smoothed.vector());
+        const matrix_type<e_bound_size, e_bound_size> next_smoothed_cov =
+            to_precision<e_bound_size, e_bound_size>(
+                next_smoothed.covariance());
+        const matrix_type<e_bound_size, 1> next_predicted_vec =
+            to_precision<e_bound_size, 1>(next_predicted.vector());
+        const matrix_type<e_bound_size, e_bound_size> next_predicted_cov =
+            to_precision<e_bound_size, e_bound_size>(
+                next_predicted.covariance());
 
         // Current track state parameters
-        const matrix_type<e_bound_size, 1>& cur_filtered_vec =
-            cur_filtered.vector();
-        const matrix_type<e_bound_size, e_bound_size>& cur_filtered_cov =
-            cur_filtered.covariance();
+        const matrix_type<e_bound_size, 1> cur_filtered_vec =
+            to_precision<e_bound_size, 1>(cur_filtered.vector());
+        const matrix_type<e_bound_size, e_bound_size> cur_filtered_cov =
+            to_precision<e_bound_size, e_bound_size>(
+                cur_filtered.covariance());
 
         // Regularization matrix for numerical stability
         static constexpr scalar_type epsilon = 1e-13f;
@@ -105,10 +147,13 @@ struct gain_matrix_smoother {
             cur_filtered_cov + A * (next_smoothed_cov - next_predicted_cov) *
                                    matrix_operator().transpose(A);
 
-        cur_state.smoothed().set_vector(smt_vec);
-        cur_state.smoothed().set_covariance(smt_cov);
+        cur_state.smoothed().set_vector(
+            convert_matrix<algebra_t, e_bound_size, 1>(smt_vec));
+        cur_state.smoothed().set_covariance(
+            convert_matrix<algebra_t, e_bound_size, e_bound_size>(smt_cov));
 
-        matrix_type<D, e_bound_size> H = meas.subs.template projector<D>();
+        matrix_type<D, e_bound_size> H =
+            to_precision<D, e_bound_size>(meas.subs.template projector<D>());
 
         // Correct sign for line detector
         if constexpr (std::is_same_v<shape_t, detray::line<true>> ||
@@ -120,20 +165,29 @@ struct gain_matrix_smoother {
         }
 
         // Calculate smoothed chi square
-        const matrix_type<D, 1>& meas_local =
-            cur_state.template measurement_local<D>();
-        const matrix_type<D, D>& V =
-            cur_state.template measurement_covariance<D>();
+        const matrix_type<D, 1> meas_local =
+            to_precision<D, 1>(cur_state.template measurement_local<D>());
+        const matrix_type<D, D> V =
+            to_precision<D, D>(cur_state.template measurement_covariance<D>());
         const matrix_type<D, 1> residual = meas_local - H * smt_vec;
         const matrix_type<D, D> R =
             V - H * smt_cov * matrix_operator().transpose(H);
         const matrix_type<1, 1> chi2 = matrix_operator().transpose(residual) *
                                        matrix_operator().inverse(R) * residual;
 
-        cur_state.smoothed_chi2() = matrix_operator().element(chi2, 0, 0);
+        cur_state.smoothed_chi2() = static_cast<detray::dscalar<algebra_t>>(
+            matrix_operator().element(chi2, 0, 0));
 
         return;
     }
+
+    private:
+    /// Convert a matrix of the track states to the calculation's precision
+    template <size_type ROWS, size_type COLS, typename matrix_t>
+    TRACCC_HOST_DEVICE static inline matrix_type<ROWS, COLS> to_precision(
+        const matrix_t& m) {
+        return convert_matrix<precision_algebra_t, ROWS, COLS>(m);
+    }
 };
 
 }  // namespace traccc
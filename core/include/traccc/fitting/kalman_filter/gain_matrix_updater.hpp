@@ -11,18 +11,26 @@
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/definitions/track_parametrization.hpp"
 #include "traccc/edm/track_state.hpp"
+#include "traccc/utils/matrix_conversion.hpp"
 
 namespace traccc {
 
 /// Type unrolling functor for Kalman updating
-template <typename algebra_t>
+///
+/// The track states are stored with @c algebra_t, while the update itself
+/// is calculated with @c precision_algebra_t. Allowing the covariances to be
+/// updated in double precision, for the track states of a single precision
+/// chain.
+///
+template <typename algebra_t, typename precision_algebra_t = algebra_t>
 struct gain_matrix_updater {
 
     // Type declarations
-    using matrix_operator = detray::dmatrix_operator<algebra_t>;
-    using size_type = detray::dsize_type<algebra_t>;
+    using scalar_type = detray::dscalar<algebra_t>;
+    using matrix_operator = detray::dmatrix_operator<precision_algebra_t>;
+    using size_type = detray::dsize_type<precision_algebra_t>;
     template <size_type ROWS, size_type COLS>
-    using matrix_type = detray::dmatrix<algebra_t, ROWS, COLS>;
+    using matrix_type = detray::dmatrix<precision_algebra_t, ROWS, COLS>;
 
     /// Gain matrix updater operation
     ///
@@ -43,6 +51,10 @@ struct gain_matrix_updater {
 
         using shape_type = typename mask_group_t::value_type::shape;
 
+        // Remember the kind of the surface for the smoother
+        trk_state.is_line = (std::is_same_v<shape_type, detray::line<true>> ||
+                             std::is_same_v<shape_type, detray::line<false>>);
+
         const auto D = trk_state.get_measurement().meas_dim;
         assert(D == 1u || D == 2u);
         if (D == 1u) {
@@ -70,23 +82,25 @@ struct gain_matrix_updater {
         const matrix_type<D, D> I_m =
             matrix_operator().template identity<D, D>();
 
-        matrix_type<D, e_bound_size> H = meas.subs.template projector<D>();
+        matrix_type<D, e_bound_size> H =
+            to_precision<D, e_bound_size>(meas.subs.template projector<D>());
 
         // Measurement data on surface
-        const matrix_type<D, 1>& meas_local =
-            trk_state.template measurement_local<D>();
+        const matrix_type<D, 1> meas_local =
+            to_precision<D, 1>(trk_state.template measurement_local<D>());
+
+        // Set track state parameters
+        trk_state.predicted().set_vector(bound_params.vector());
+        trk_state.predicted().set_covariance(bound_params.covariance());
 
         // Predicted vector of bound track parameters
-        const matrix_type<e_bound_size, 1>& predicted_vec =
-            bound_params.vector();
+        const matrix_type<e_bound_size, 1> predicted_vec =
+            to_precision<e_bound_size, 1>(bound_params.vector());
 
         // Predicted covaraince of bound track parameters
-        const matrix_type<e_bound_size, e_bound_size>& predicted_cov =
-            bound_params.covariance();
-
-        // Set track state parameters
-        trk_state.predicted().set_vector(predicted_vec);
-        trk_state.predicted().set_covariance(predicted_cov);
+        const matrix_type<e_bound_size, e_bound_size> predicted_cov =
+            to_precision<e_bound_size, e_bound_size>(
+                bound_params.covariance());
 
         if constexpr (std::is_same_v<shape_t, detray::line<true>> ||
                       std::is_same_v<shape_t, detray::line<false>>) {
@@ -98,7 +112,7 @@ struct gain_matrix_updater {
 
         // Spatial resolution (Measurement covariance)
         const matrix_type<D, D> V =
-            trk_state.template measurement_covariance<D>();
+            to_precision<D, D>(trk_state.template measurement_covariance<D>());
 
         const matrix_type<D, D> M =
             H * predicted_cov * matrix_operator().transpose(H) + V;
@@ -122,16 +136,28 @@ struct gain_matrix_updater {
                                        matrix_operator().inverse(R) * residual;
 
         // Set the stepper parameter
-        bound_params.set_vector(filtered_vec);
-        bound_params.set_covariance(filtered_cov);
+        bound_params.set_vector(
+            convert_matrix<algebra_t, e_bound_size, 1>(filtered_vec));
+        bound_params.set_covariance(
+            convert_matrix<algebra_t, e_bound_size, e_bound_size>(
+                filtered_cov));
 
         // Set the track state parameters
-        trk_state.filtered().set_vector(filtered_vec);
-        trk_state.filtered().set_covariance(filtered_cov);
-        trk_state.filtered_chi2() = matrix_operator().element(chi2, 0, 0);
+        trk_state.filtered().set_vector(bound_params.vector());
+        trk_state.filtered().set_covariance(bound_params.covariance());
+        trk_state.filtered_chi2() =
+            static_cast<scalar_type>(matrix_operator().element(chi2, 0, 0));
 
         return;
     }
+
+    private:
+    /// Convert a matrix of the track states to the calculation's precision
+    template <size_type ROWS, size_type COLS, typename matrix_t>
+    TRACCC_HOST_DEVICE static inline matrix_type<ROWS, COLS> to_precision(
+        const matrix_t& m) {
+        return convert_matrix<precision_algebra_t, ROWS, COLS>(m);
+    }
 };
 
 }  // namespace traccc
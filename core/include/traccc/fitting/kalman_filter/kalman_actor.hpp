@@ -18,11 +18,17 @@
 namespace traccc {
 
 /// Detray actor for Kalman filtering
-template <typename algebra_t, template <typename...> class vector_t>
+///
+/// The Kalman updates are calculated with @c precision_algebra_t, while the
+/// track states are stored with @c algebra_t.
+///
+template <typename algebra_t, template <typename...> class vector_t,
+          typename precision_algebra_t = algebra_t>
 struct kalman_actor : detray::actor {
 
     // Type declarations
     using track_state_type = track_state<algebra_t>;
+    using scalar_type = detray::dscalar<algebra_t>;
 
     // Actor state
     struct state {
@@ -45,9 +51,13 @@ struct kalman_actor : detray::actor {
         TRACCC_HOST_DEVICE
         track_state_type& operator()() { return *m_it; }
 
-        /// Reset the iterator
+        /// Reset the iterator, and the fit quality
         TRACCC_HOST_DEVICE
-        void reset() { m_it = m_track_states.begin(); }
+        void reset() {
+            m_it = m_track_states.begin();
+            m_filtered_chi2 = 0.f;
+            m_ndf = 0.f;
+        }
 
         /// Advance the iterator
         TRACCC_HOST_DEVICE
@@ -67,6 +77,12 @@ struct kalman_actor : detray::actor {
 
         // iterator for forward filtering
         typename vector_t<track_state_type>::iterator m_it;
+
+        // sum of the filtered chi2 of the updated track states
+        scalar_type m_filtered_chi2{0};
+
+        // sum of the measurement dimensions of the updated track states
+        scalar_type m_ndf{0};
     };
 
     /// Actor operation to perform the Kalman filtering
@@ -105,9 +121,15 @@ struct kalman_actor : detray::actor {
 
             // Run Kalman Gain Updater
             const auto sf = navigation.get_surface();
-            sf.template visit_mask<gain_matrix_updater<algebra_t>>(
+            sf.template visit_mask<
+                gain_matrix_updater<algebra_t, precision_algebra_t>>(
                 trk_state, propagation._stepping._bound_params);
 
+            // Accumulate the fit quality on the fly
+            actor_state.m_filtered_chi2 += trk_state.filtered_chi2();
+            actor_state.m_ndf +=
+                static_cast<scalar_type>(trk_state.get_measurement().meas_dim);
+
             // Update iterator
             actor_state.next();
 
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/definitions/primitives.hpp"
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/track_candidate.hpp"
 #include "traccc/edm/track_parameters.hpp"
@@ -32,7 +33,15 @@
 namespace traccc {
 
 /// Kalman fitter algorithm to fit a single track
-template <typename stepper_t, typename navigator_t>
+///
+/// The Kalman updates and the smoothing are calculated with
+/// @c precision_algebra_t, which may be more precise than the algebra of the
+/// detector, used for the propagation and for storing the track states. By
+/// default it is the algebra selected with @c TRACCC_KALMAN_SCALARTYPE at
+/// build time.
+///
+template <typename stepper_t, typename navigator_t,
+          typename precision_algebra_t = kalman_algebra>
 class kalman_fitter {
 
     public:
@@ -42,6 +51,9 @@ class kalman_fitter {
     // Algebra type
     using algebra_type = typename detector_type::algebra_type;
 
+    // Algebra type of the Kalman updates and the smoothing
+    using precision_algebra_type = precision_algebra_t;
+
     // scalar type
     using scalar_type = detray::dscalar<algebra_type>;
 
@@ -62,7 +74,8 @@ class kalman_fitter {
     using aborter = detray::pathlimit_aborter;
     using transporter = detray::parameter_transporter<algebra_type>;
     using interactor = detray::pointwise_material_interactor<algebra_type>;
-    using fit_actor = traccc::kalman_actor<algebra_type, vector_type>;
+    using fit_actor = traccc::kalman_actor<algebra_type, vector_type,
+                                           precision_algebra_type>;
     using resetter = detray::parameter_resetter<algebra_type>;
 
     using actor_chain_type =
@@ -124,13 +137,22 @@ class kalman_fitter {
     ///
     /// @param seed_params seed track parameter
     /// @param fitter_state the state of kalman fitter
+    /// @param nav_candidates storage for the navigation candidates of the
+    ///        propagation. The navigator clears it, and re-fills it with its
+    ///        own surface search, on entering every volume. So it can not
+    ///        be used to hand the surfaces found by the track finding over
+    ///        to the fit.
     template <typename seed_parameters_t>
     TRACCC_HOST_DEVICE void fit(
         const seed_parameters_t& seed_params, state& fitter_state,
         vector_type<intersection_type>&& nav_candidates = {}) {
 
-        // Run the kalman filtering for a given number of iterations
-        for (std::size_t i = 0; i < m_cfg.n_iterations; i++) {
+        // Run the kalman filtering for a given number of iterations. (The
+        // iterations are seeded with the smoothed parameters, so the
+        // filter-only mode can only run one.)
+        const std::size_t n_iterations =
+            m_cfg.filter_only ? 1u : m_cfg.n_iterations;
+        for (std::size_t i = 0; i < n_iterations; i++) {
 
             // Reset the iterator of kalman actor
             fitter_state.m_fit_actor_state.reset();
@@ -156,6 +178,8 @@ class kalman_fitter {
     ///
     /// @param seed_params seed track parameter
     /// @param fitter_state the state of kalman fitter
+    /// @param nav_candidates storage for the navigation candidates of the
+    ///        propagation (see @c fit)
     template <typename seed_parameters_t>
     TRACCC_HOST_DEVICE void filter(
         const seed_parameters_t& seed_params, state& fitter_state,
@@ -184,6 +208,12 @@ class kalman_fitter {
         // Run forward filtering
         propagator.propagate(propagation, fitter_state());
 
+        // Take the fit result from the filtering alone, if requested
+        if (m_cfg.filter_only) {
+            update_filtered_statistics(fitter_state);
+            return;
+        }
+
         // Run smoothing
         smooth(fitter_state);
 
@@ -213,14 +243,16 @@ class kalman_fitter {
         last.smoothed().set_covariance(last.filtered().covariance());
         last.smoothed_chi2() = last.filtered_chi2();
 
+        // The surface kinds were cached in the track states during the
+        // filtering, so the smoother does not need to visit the detector.
+        const gain_matrix_smoother<algebra_type, precision_algebra_type>
+            smoother{};
         for (typename vector_type<track_state<algebra_type>>::reverse_iterator
                  it = track_states.rbegin() + 1;
              it != track_states.rend(); ++it) {
 
             // Run kalman smoother
-            const detray::tracking_surface sf{m_detector, it->surface_link()};
-            sf.template visit_mask<gain_matrix_smoother<algebra_type>>(
-                *it, *(it - 1));
+            smoother(*it, *(it - 1));
         }
     }
 
@@ -232,18 +264,38 @@ class kalman_fitter {
         // Fit parameter = smoothed track parameter at the first surface
         fit_res.fit_params = track_states[0].smoothed();
 
+        const statistics_updater<algebra_type> updater{};
         for (const auto& trk_state : track_states) {
-
-            const detray::tracking_surface sf{m_detector,
-                                              trk_state.surface_link()};
-            sf.template visit_mask<statistics_updater<algebra_type>>(fit_res,
-                                                                     trk_state);
+            updater(fit_res, trk_state);
         }
 
         // Subtract the NDoF with the degree of freedom of the bound track (=5)
         fit_res.ndf = fit_res.ndf - 5.f;
     }
 
+    /// Update the track fitting qualities from the forward filtering alone
+    ///
+    /// @param fitter_state the state of kalman fitter
+    TRACCC_HOST_DEVICE
+    void update_filtered_statistics(state& fitter_state) {
+        auto& fit_res = fitter_state.m_fit_res;
+        const auto& actor_state = fitter_state.m_fit_actor_state;
+        const auto& track_states = actor_state.m_track_states;
+
+        // Fit parameter = filtered track parameter at the last measurement
+        for (auto it = track_states.rbegin(); it != track_states.rend();
+             ++it) {
+            if (!it->is_hole) {
+                fit_res.fit_params = it->filtered();
+                break;
+            }
+        }
+
+        // The chi2 and NDoF were accumulated during the filtering
+        fit_res.chi2 = actor_state.m_filtered_chi2;
+        fit_res.ndf = actor_state.m_ndf - 5.f;
+    }
+
     private:
     // Detector object
     const detector_type& m_detector;
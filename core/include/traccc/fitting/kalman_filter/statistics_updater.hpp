@@ -32,6 +32,18 @@ struct statistics_updater {
         fitting_result<algebra_t>& fit_res,
         const track_state<algebra_t>& trk_state) {
 
+        (*this)(fit_res, trk_state);
+    }
+
+    /// Update track fitting qualities (NDoF and Chi2), without visiting the
+    /// detector
+    ///
+    /// @param fit_res fitting information such as NDoF or Chi2
+    /// @param trk_state track state of the current surface
+    TRACCC_HOST_DEVICE inline void operator()(
+        fitting_result<algebra_t>& fit_res,
+        const track_state<algebra_t>& trk_state) const {
+
         if (!trk_state.is_hole) {
 
             // Measurement dimension
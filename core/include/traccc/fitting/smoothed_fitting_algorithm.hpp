@@ -0,0 +1,131 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// System include(s).
+#include <stdexcept>
+
+namespace traccc {
+
+/// Fitting algorithm for a set of tracks, producing compact track states
+///
+/// The fitter needs the full track states (with the transport jacobians) of
+/// a track for smoothing it. But once a track is fitted, this algorithm
+/// only keeps the smoothed parameters of its states, or with
+/// @c traccc::fitting_output_level::perigee, only the fitted parameters of
+/// the track itself. @c traccc::fitting_output_level::full can not be
+/// produced by this algorithm, use @c traccc::fitting_algorithm for it.
+///
+template <typename fitter_t>
+class smoothed_fitting_algorithm
+    : public algorithm<smoothed_track_state_container_types::host(
+          const typename fitter_t::detector_type&,
+          const typename fitter_t::bfield_type&,
+          const typename track_candidate_container_types::host&)> {
+
+    public:
+    using algebra_type = typename fitter_t::algebra_type;
+    using bfield_type = typename fitter_t::bfield_type;
+    /// Configuration type
+    using config_type = typename fitter_t::config_type;
+
+    /// Constructor for the fitting algorithm
+    ///
+    /// @param cfg  Configuration object
+    ///
+    /// @throws std::invalid_argument if the full output level, or a
+    ///         filter-only fit (which has no smoothed states) is requested
+    ///
+    smoothed_fitting_algorithm(const config_type& cfg) : m_cfg(cfg) {
+        if (m_cfg.output_level == fitting_output_level::full) {
+            throw std::invalid_argument(
+                "The full output level is not supported by "
+                "traccc::smoothed_fitting_algorithm");
+        }
+        if (m_cfg.filter_only) {
+            throw std::invalid_argument(
+                "Filter-only fits are not supported by "
+                "traccc::smoothed_fitting_algorithm");
+        }
+    }
+
+    /// Run the algorithm
+    ///
+    /// @param track_candidates the candidate measurements from track finding
+    /// @return the container of the fitted track parameters
+    smoothed_track_state_container_types::host operator()(
+        const typename fitter_t::detector_type& det,
+        const typename fitter_t::bfield_type& field,
+        const typename track_candidate_container_types::host& track_candidates)
+        const override {
+
+        fitter_t fitter(det, field, m_cfg);
+
+        smoothed_track_state_container_types::host output_states;
+
+        // The number of tracks
+        std::size_t n_tracks = track_candidates.size();
+
+        // The (full) track states of the current track, reused between the
+        // tracks.
+        vecmem::vector<track_state<algebra_type>> input_states;
+
+        // Iterate over tracks
+        for (std::size_t i = 0; i < n_tracks; i++) {
+
+            // Seed parameter
+            const auto& seed_param = track_candidates[i].header;
+
+            // Make a vector of track state
+            auto& cands = track_candidates[i].items;
+            input_states.clear();
+            input_states.reserve(cands.size());
+            for (auto& cand : cands) {
+                input_states.emplace_back(cand);
+            }
+
+            // Make a fitter state
+            typename fitter_t::state fitter_state(std::move(input_states));
+
+            // Run fitter
+            fitter.fit(seed_param, fitter_state);
+
+            // Keep only the smoothed parameters of the track states.
+            vecmem::vector<smoothed_track_state<algebra_type>> smoothed_states;
+            if (m_cfg.output_level != fitting_output_level::perigee) {
+                const auto& fitted_states =
+                    fitter_state.m_fit_actor_state.m_track_states;
+                smoothed_states.reserve(fitted_states.size());
+                for (const auto& st : fitted_states) {
+                    smoothed_states.emplace_back(st);
+                }
+            }
+            output_states.push_back(std::move(fitter_state.m_fit_res),
+                                    std::move(smoothed_states));
+
+            // Take back the memory of the full track states.
+            input_states =
+                std::move(fitter_state.m_fit_actor_state.m_track_states);
+        }
+
+        return output_states;
+    }
+
+    /// Config object
+    config_type m_cfg;
+};
+
+}  // namespace traccc
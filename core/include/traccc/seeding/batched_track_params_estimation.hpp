@@ -0,0 +1,105 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <functional>
+
+namespace traccc {
+
+/// Track parameter estimation algorithm, processing the seeds in batches
+///
+/// Produces the same parameters as @c traccc::track_params_estimation. But
+/// instead of estimating the parameters of the seeds one by one, it gathers
+/// the spacepoint coordinates of fixed size blocks of seeds into
+/// structure-of-arrays buffers, and performs the circle fits of a block in
+/// loops that the compiler can vectorise. The covariance, which is the same
+/// for all seeds, is only set up once per call.
+///
+/// Large numbers of seeds can be processed in parallel, through an executor
+/// provided by the user. (For instance by a function calling
+/// @c traccc::host_parallel::thread_pool::launch_range.)
+///
+class batched_track_params_estimation
+    : public algorithm<bound_track_parameters_collection_types::host(
+          const spacepoint_collection_types::host&,
+          const seed_collection_types::host&, const vector3&,
+          const std::array<traccc::scalar, traccc::e_bound_size>&)> {
+
+    public:
+    /// Function processing a range of seeds, with indices [begin, end)
+    using range_function_type = std::function<void(std::size_t, std::size_t)>;
+    /// Function executing a range function for a given number of seeds
+    ///
+    /// It may split the seeds into multiple ranges, and process those in
+    /// parallel.
+    ///
+    using executor_type =
+        std::function<void(std::size_t, const range_function_type&)>;
+
+    /// Configuration for the algorithm
+    struct config_type {
+        /// The minimum number of seeds for which the executor is used
+        std::size_t parallel_threshold = 4096;
+    };
+
+    /// The number of seeds processed together in one block
+    static constexpr std::size_t block_size = 64;
+
+    /// Constructor for batched_track_params_estimation
+    ///
+    /// @param mr is the memory resource
+    /// @param config is the configuration of the algorithm
+    /// @param executor is the (optional) executor for large seed counts
+    ///
+    batched_track_params_estimation(vecmem::memory_resource& mr,
+                                    const config_type& config = {},
+                                    executor_type executor = {});
+
+    /// Callable operator for batched_track_params_estimation
+    ///
+    /// @param spacepoints All spacepoints of the event
+    /// @param seeds The reconstructed track seeds of the event
+    /// @param bfield (Temporary) Magnetic field vector
+    /// @param stddev standard deviation for setting the covariance (Default
+    /// value from arXiv:2112.09470v1)
+    /// @return A vector of bound track parameters
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::host& spacepoints,
+        const seed_collection_types::host& seeds, const vector3& bfield,
+        const std::array<traccc::scalar, traccc::e_bound_size>& stddev = {
+            0.02f * detray::unit<traccc::scalar>::mm,
+            0.03f * detray::unit<traccc::scalar>::mm,
+            1.f * detray::unit<traccc::scalar>::degree,
+            1.f * detray::unit<traccc::scalar>::degree,
+            0.01f / detray::unit<traccc::scalar>::GeV,
+            1.f * detray::unit<traccc::scalar>::ns}) const override;
+
+    private:
+    /// The memory resource to use in the algorithm
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// The configuration of the algorithm
+    config_type m_config;
+    /// The executor used for large seed counts
+    executor_type m_executor;
+
+};  // class batched_track_params_estimation
+
+}  // namespace traccc
@@ -0,0 +1,139 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/internal_spacepoint.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/layer_link_table.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cassert>
+#include <span>
+#include <utility>
+
+namespace traccc {
+
+// Forward declaration(s).
+class spacepoint_binning;
+
+/// Spacepoint grid with all of its bins stored in one flat array
+///
+/// The spacepoints of all bins are held in a single array, with the bins
+/// described by the offsets of their first spacepoints in it (in a CSR-like
+/// layout). The memory of the arrays is kept when the grid is re-filled, so
+/// a grid re-used across events stops allocating memory once it has seen
+/// its largest event.
+///
+/// It provides the same (host) interface as @c traccc::sp_grid that the
+/// doublet and triplet finding, and the seed filtering make use of. With
+/// the spacepoints of every bin in the same order as in @c traccc::sp_grid.
+///
+/// When filled using a @c traccc::layer_link_table, the spacepoints of every
+/// bin are ordered by their layers instead, with the layer of each spacepoint
+/// stored alongside it. Allowing the doublet finding to skip the spacepoints
+/// of incompatible layers together.
+///
+class flat_sp_grid {
+
+    public:
+    /// @name Type declarations
+    /// @{
+    using axis_p0_type = sp_grid::axis_p0_type;
+    using axis_p1_type = sp_grid::axis_p1_type;
+    using value_type = internal_spacepoint<spacepoint>;
+    /// The spacepoints of one bin
+    using bin_type = std::span<const value_type>;
+    /// @}
+
+    /// Constructor with the axes of the grid
+    ///
+    /// @param axes The phi and z axes of the grid
+    /// @param mr The memory resource to use for the spacepoints
+    ///
+    flat_sp_grid(const std::pair<axis_p0_type, axis_p1_type>& axes,
+                 vecmem::memory_resource& mr)
+        : m_axis_p0(axes.first),
+          m_axis_p1(axes.second),
+          m_offsets(m_axis_p0.bins() * m_axis_p1.bins() + 1u, 0u, &mr),
+          m_spacepoints(&mr),
+          m_layers(&mr),
+          m_scratch_spacepoints(&mr),
+          m_scratch_bins(&mr) {}
+
+    /// @return the phi axis of the grid
+    const axis_p0_type& axis_p0() const { return m_axis_p0; }
+    /// @return the z axis of the grid
+    const axis_p1_type& axis_p1() const { return m_axis_p1; }
+
+    /// @return the number of bins in the grid
+    unsigned int nbins() const {
+        return static_cast<unsigned int>(m_offsets.size() - 1u);
+    }
+
+    /// @return the spacepoints of a bin, with a global bin index
+    bin_type bin(unsigned int bin_idx) const {
+        assert(bin_idx + 1u < m_offsets.size());
+        return {m_spacepoints.data() + m_offsets[bin_idx],
+                m_spacepoints.data() + m_offsets[bin_idx + 1u]};
+    }
+
+    /// @return the spacepoints of a bin, with phi and z bin indices
+    bin_type bin(unsigned int phi_bin, unsigned int z_bin) const {
+        return bin(phi_bin + z_bin * m_axis_p0.bins());
+    }
+
+    /// @return the layer link table that the grid was filled with, if any
+    const layer_link_table* layer_links() const { return m_layer_links; }
+
+    /// @return the layers of the spacepoints of a bin, with a global bin
+    ///         index (only available when filled with a layer link table)
+    std::span<const unsigned int> bin_layers(unsigned int bin_idx) const {
+        assert(m_layer_links != nullptr);
+        assert(bin_idx + 1u < m_offsets.size());
+        return {m_layers.data() + m_offsets[bin_idx],
+                m_layers.data() + m_offsets[bin_idx + 1u]};
+    }
+
+    /// @return the offsets of the bins in @c spacepoints()
+    const vecmem::vector<unsigned int>& offsets() const { return m_offsets; }
+    /// @return the spacepoints of all bins
+    const vecmem::vector<value_type>& spacepoints() const {
+        return m_spacepoints;
+    }
+
+    private:
+    /// The binning algorithm fills the grid directly
+    friend class spacepoint_binning;
+
+    /// The phi axis of the grid
+    axis_p0_type m_axis_p0;
+    /// The z axis of the grid
+    axis_p1_type m_axis_p1;
+    /// Offsets of the bins in @c m_spacepoints, with one extra element at the
+    /// end
+    vecmem::vector<unsigned int> m_offsets;
+    /// The spacepoints of all bins
+    vecmem::vector<value_type> m_spacepoints;
+    /// The layers of the spacepoints in @c m_spacepoints (if known)
+    vecmem::vector<unsigned int> m_layers;
+    /// The layer link table that the grid was filled with
+    const layer_link_table* m_layer_links = nullptr;
+    /// Spacepoints, in their input order, used during the filling
+    vecmem::vector<value_type> m_scratch_spacepoints;
+    /// Bins of @c m_scratch_spacepoints, used during the filling
+    vecmem::vector<unsigned int> m_scratch_bins;
+
+};  // class flat_sp_grid
+
+}  // namespace traccc
@@ -105,6 +105,23 @@ struct seedfinder_config {
     // (and you want to cover the full phi-range of minPT), leave this at 1.
     int phiBinDeflectionCoverage = 1;
 
+    // Width of the z bins of the spacepoint grid. If not positive, it is
+    // derived from cotThetaMax * deltaRMax.
+    scalar zBinSize = 0.f * unit<scalar>::mm;
+
+    // Maximal number of edges of variable width z bins
+    static constexpr unsigned int max_z_bin_edges = 32;
+    // Edges of variable width z bins of the spacepoint grid, in increasing
+    // order. Only the first nZBinEdges of them are used, and with fewer than
+    // two, the z bins are uniform (see zBinSize).
+    darray<scalar, max_z_bin_edges> zBinEdges{};
+    unsigned int nZBinEdges = 0;
+    // Neighbour scopes along z for every variable width z bin, used instead
+    // of neighbor_scope along z if useZBinNeighbors is set. (Like
+    // zBinNeighbors in ACTS.)
+    darray<darray<unsigned int, 2>, max_z_bin_edges - 1> zBinNeighbors{};
+    bool useZBinNeighbors = false;
+
     darray<unsigned int, 2> neighbor_scope{1, 1};
 
     TRACCC_HOST_DEVICE
@@ -115,7 +132,45 @@ struct seedfinder_config {
     TRACCC_HOST_DEVICE
     unsigned int get_max_neighbor_bins() const {
         unsigned int t = neighbor_scope[0] + neighbor_scope[1] + 1;
-        return t * t;
+        if (!useZBinNeighbors || nZBinEdges < 2) {
+            return t * t;
+        }
+        unsigned int tz = 0;
+        for (unsigned int i = 0; i + 1 < nZBinEdges; ++i) {
+            const unsigned int n =
+                zBinNeighbors[i][0] + zBinNeighbors[i][1] + 1;
+            tz = (n > tz) ? n : tz;
+        }
+        return t * tz;
+    }
+
+    // Coordinate of a z position along the z axis of the spacepoint grid.
+    // With variable width z bins, the axis has bins of unit width, onto
+    // which z is mapped piecewise linearly.
+    TRACCC_HOST_DEVICE
+    scalar grid_z(scalar z) const {
+        if (nZBinEdges < 2) {
+            return z;
+        }
+        unsigned int i = 0;
+        while ((i + 2 < nZBinEdges) && (z >= zBinEdges[i + 1])) {
+            ++i;
+        }
+        return static_cast<scalar>(i) +
+               (z - zBinEdges[i]) / (zBinEdges[i + 1] - zBinEdges[i]);
+    }
+
+    // Neighbour scope along z, for a position along the grid's z axis
+    // (as returned by grid_z)
+    TRACCC_HOST_DEVICE
+    darray<unsigned int, 2> z_neighbor_scope(scalar grid_z_value) const {
+        if (!useZBinNeighbors || nZBinEdges < 2) {
+            return neighbor_scope;
+        }
+        int bin = static_cast<int>(grid_z_value);
+        const int max_bin = static_cast<int>(nZBinEdges) - 2;
+        bin = (bin < 0) ? 0 : ((bin > max_bin) ? max_bin : bin);
+        return zBinNeighbors[static_cast<unsigned int>(bin)];
     }
 
     // Configure unset parameters
@@ -152,7 +207,10 @@ struct spacepoint_grid_config {
           impactMax(finder_config.impactMax),
           phiMin(finder_config.phiMin),
           phiMax(finder_config.phiMax),
-          phiBinDeflectionCoverage(finder_config.phiBinDeflectionCoverage) {}
+          phiBinDeflectionCoverage(finder_config.phiBinDeflectionCoverage),
+          zBinSize(finder_config.zBinSize),
+          zBinEdges(finder_config.zBinEdges),
+          nZBinEdges(finder_config.nZBinEdges) {}
 
     // magnetic field in kTesla
     scalar bFieldInZ;
@@ -185,6 +243,13 @@ struct spacepoint_grid_config {
     // configured to return 1 neighbor on either side of the current phi-bin
     // (and you want to cover the full phi-range of minPT), leave this at 1.
     int phiBinDeflectionCoverage = 1;
+    // Width of the z bins. If not positive, it is derived from
+    // cotThetaMax * deltaRMax.
+    scalar zBinSize = 0.f * unit<scalar>::mm;
+    // Edges of variable width z bins, overriding zBinSize if at least two
+    // of them are set
+    darray<scalar, seedfinder_config::max_z_bin_edges> zBinEdges{};
+    unsigned int nZBinEdges = 0;
 };
 
 struct seedfilter_config {
@@ -223,4 +288,26 @@ struct seedfilter_config {
     scalar spB_min_radius = 43. * unit<scalar>::mm;
 };
 
+// primary vertex z pre-finding configuration
+struct vertex_z_finder_config {
+    // whether to narrow down the collision region of the seeding around the
+    // pre-found vertex candidates
+    bool enable = false;
+    // maximum radius of the (pixel) spacepoints used in the pre-finding
+    scalar max_radius = 120.f * unit<scalar>::mm;
+    // minimum distance in r between the two spacepoints of a pair
+    scalar min_delta_r = 10.f * unit<scalar>::mm;
+    // maximum distance in phi between the two spacepoints of a pair
+    scalar max_delta_phi = 0.05f;
+    // width of the bins of the z intercept histogram
+    scalar bin_width = 1.f * unit<scalar>::mm;
+    // maximum number of vertex candidates to seed around
+    unsigned int max_candidates = 3;
+    // minimum number of pairs (in three neighbouring bins) for a vertex
+    // candidate
+    unsigned int min_pairs = 3;
+    // half width of the collision region used around every vertex candidate
+    scalar window_half_width = 15.f * unit<scalar>::mm;
+};
+
 }  // namespace traccc
@@ -0,0 +1,115 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/math.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/seeding/detail/lin_circle.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// Middle-top doublets of a middle spacepoint, sorted by cotTheta
+///
+/// Holds the quantities of the doublets needed by the triplet finding's
+/// pre-selection in a structure-of-arrays layout, so that the pre-selection
+/// could be vectorised over the doublets. It is meant to be filled once per
+/// middle spacepoint, and then used with all of its middle-bottom doublets.
+///
+struct sorted_top_doublets {
+
+    /// @name Quantities of the doublets, sorted by cotTheta
+    /// @{
+
+    /// Cotangent of the pitch angle
+    std::vector<scalar> cotTheta;
+    /// Error term
+    std::vector<scalar> Er;
+    /// Reciprocal of the distance between the two spacepoints
+    std::vector<scalar> iDeltaR;
+    /// Index of the doublet in the original (unsorted) collection
+    std::vector<unsigned int> index;
+
+    /// @}
+
+    /// @name Maxima of the doublet quantities, used in the window search
+    /// @{
+    scalar maxEr = 0.f;
+    scalar maxCotThetaIDeltaR = 0.f;
+    scalar maxIDeltaR = 0.f;
+    /// @}
+
+    /// @name Scratch space of the triplet finding
+    /// @{
+    mutable std::vector<unsigned char> mask;
+    mutable std::vector<unsigned int> candidates;
+    /// @}
+
+    /// Fill the arrays from the (transformed) middle-top doublets
+    ///
+    /// @param lin_circles are the transformed coordinates of the middle-top
+    /// doublets
+    ///
+    void fill(const lin_circle_collection_types::host& lin_circles) {
+
+        const std::size_t n = lin_circles.size();
+
+        // Find the order of the doublets.
+        index.resize(n);
+        std::iota(index.begin(), index.end(), 0u);
+        std::sort(index.begin(), index.end(),
+                  [&lin_circles](unsigned int a, unsigned int b) {
+                      return lin_circles[a].cotTheta() <
+                             lin_circles[b].cotTheta();
+                  });
+
+        // Fill the arrays.
+        cotTheta.resize(n);
+        Er.resize(n);
+        iDeltaR.resize(n);
+        maxEr = 0.f;
+        maxCotThetaIDeltaR = 0.f;
+        maxIDeltaR = 0.f;
+        for (std::size_t i = 0; i < n; ++i) {
+            const lin_circle& lt = lin_circles[index[i]];
+            cotTheta[i] = lt.cotTheta();
+            Er[i] = lt.Er();
+            iDeltaR[i] = lt.iDeltaR();
+            maxEr = std::max(maxEr, lt.Er());
+            maxCotThetaIDeltaR = std::max(
+                maxCotThetaIDeltaR, math::fabs(lt.cotTheta()) * lt.iDeltaR());
+            maxIDeltaR = std::max(maxIDeltaR, lt.iDeltaR());
+        }
+    }
+
+    /// Find the (sorted) doublets with cotTheta in a given range
+    ///
+    /// @param low is the lower end of the cotTheta range
+    /// @param high is the upper end of the cotTheta range
+    ///
+    /// @return the [begin, end) range of the doublets in the sorted arrays
+    ///
+    std::pair<std::size_t, std::size_t> window(scalar low, scalar high) const {
+
+        const auto begin =
+            std::lower_bound(cotTheta.begin(), cotTheta.end(), low);
+        const auto end = std::upper_bound(begin, cotTheta.end(), high);
+        return {static_cast<std::size_t>(begin - cotTheta.begin()),
+                static_cast<std::size_t>(end - cotTheta.begin())};
+    }
+
+};  // struct sorted_top_doublets
+
+}  // namespace traccc
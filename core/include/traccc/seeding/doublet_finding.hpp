@@ -9,12 +9,18 @@
 
 #include "traccc/edm/internal_spacepoint.hpp"
 #include "traccc/seeding/detail/doublet.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/singlet.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
 #include "traccc/seeding/detail/spacepoint_type.hpp"
 #include "traccc/seeding/doublet_finding_helper.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <span>
+#include <type_traits>
+
 namespace traccc {
 
 /// Doublet finding to search the combinations of two compatible spacepoints
@@ -56,8 +62,16 @@ struct doublet_finding
     ///
     /// void interface
     ///
+    /// For a @c traccc::flat_sp_grid filled with a layer link table, the
+    /// spacepoints of the neighbour bins on layers incompatible with the
+    /// layer of the middle spacepoint are skipped without being tested.
+    ///
+    /// @tparam grid_t The spacepoint grid type (@c traccc::sp_grid or
+    ///                @c traccc::flat_sp_grid)
+    ///
     /// @return a pair of vectors of doublets and transformed coordinates
-    void operator()(const sp_grid& g2, const sp_location& l,
+    template <typename grid_t>
+    void operator()(const grid_t& g2, const sp_location& l,
                     output_type& o) const {
         // output
         auto& doublets = o.first;
@@ -67,7 +81,19 @@ struct doublet_finding
         const auto& spM = g2.bin(l.bin_idx)[l.sp_idx];
 
         auto phi_bins = g2.axis_p0().zone(spM.phi(), m_config.neighbor_scope);
-        auto z_bins = g2.axis_p1().zone(spM.z(), m_config.neighbor_scope);
+        const scalar spM_grid_z = m_config.grid_z(spM.z());
+        auto z_bins = g2.axis_p1().zone(spM_grid_z,
+                                        m_config.z_neighbor_scope(spM_grid_z));
+
+        // layer information, if the grid has it
+        const layer_link_table* links = nullptr;
+        unsigned int spM_layer = 0;
+        if constexpr (std::is_same_v<grid_t, flat_sp_grid>) {
+            links = g2.layer_links();
+            if (links != nullptr) {
+                spM_layer = g2.bin_layers(l.bin_idx)[l.sp_idx];
+            }
+        }
 
         // iterator over neighbor bins
         for (auto& phi_bin : phi_bins) {
@@ -75,8 +101,27 @@ struct doublet_finding
                 auto bin_idx = phi_bin + z_bin * g2.axis_p0().bins();
 
                 const auto& neighbors = g2.bin(phi_bin, z_bin);
+                std::span<const unsigned int> layers;
+                if constexpr (std::is_same_v<grid_t, flat_sp_grid>) {
+                    if (links != nullptr) {
+                        layers = g2.bin_layers(
+                            static_cast<unsigned int>(bin_idx));
+                    }
+                }
                 for (unsigned int sp_idx = 0; sp_idx < neighbors.size();
                      sp_idx++) {
+
+                    // skip all spacepoints of an incompatible layer at once
+                    if (links != nullptr &&
+                        !compatible_layers(*links, spM_layer,
+                                           layers[sp_idx])) {
+                        sp_idx = static_cast<unsigned int>(
+                            std::upper_bound(layers.begin() + sp_idx,
+                                             layers.end(), layers[sp_idx]) -
+                            layers.begin() - 1);
+                        continue;
+                    }
+
                     const auto& sp_nb = neighbors[sp_idx];
 
                     if (!doublet_finding_helper::isCompatible<otherSpType>(
@@ -98,6 +143,18 @@ struct doublet_finding
     }
 
     private:
+    /// Check whether the layers of the middle and the other spacepoint of a
+    /// doublet are compatible
+    static bool compatible_layers(const layer_link_table& links,
+                                  unsigned int spM_layer,
+                                  unsigned int other_layer) {
+        if constexpr (otherSpType == details::spacepoint_type::bottom) {
+            return links.compatible(other_layer, spM_layer);
+        } else {
+            return links.compatible(spM_layer, other_layer);
+        }
+    }
+
     seedfinder_config m_config;
 };
 
@@ -0,0 +1,146 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+// Detray include(s).
+#include "detray/geometry/barcode.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace traccc {
+
+/// Table of the detector layers that can form seeding doublets
+///
+/// The layers are identified by the (detray) volume indices of the surfaces
+/// that the spacepoints are on. A link from an "inner" to an "outer" layer
+/// means that a bottom-middle, or a middle-top doublet may be made with its
+/// inner spacepoint on the inner layer, and its outer spacepoint on the outer
+/// layer.
+///
+/// Volumes not known to the table are considered to be compatible with all
+/// other volumes.
+///
+class layer_link_table {
+
+    public:
+    /// Type used for the layer (volume) indices
+    using index_type = unsigned int;
+
+    /// Default constructor, with an empty table
+    layer_link_table() = default;
+
+    /// Constructor with the number of volumes, without any links set
+    explicit layer_link_table(index_type n_volumes)
+        : m_size(n_volumes),
+          m_links(static_cast<std::size_t>(n_volumes) * n_volumes, 0u),
+          m_linked(n_volumes, 0u) {}
+
+    /// @return the number of volumes described by the table
+    index_type size() const { return m_size; }
+
+    /// Allow doublets between two layers
+    ///
+    /// @param inner The layer of the inner spacepoint of the doublets
+    /// @param outer The layer of the outer spacepoint of the doublets
+    ///
+    void link(index_type inner, index_type outer) {
+        assert(inner < m_size);
+        assert(outer < m_size);
+        m_links[static_cast<std::size_t>(inner) * m_size + outer] = 1u;
+        m_linked[inner] = 1u;
+        m_linked[outer] = 1u;
+    }
+
+    /// Check whether doublets may be formed between two layers
+    ///
+    /// @param inner The layer of the inner spacepoint of the doublet
+    /// @param outer The layer of the outer spacepoint of the doublet
+    ///
+    bool compatible(index_type inner, index_type outer) const {
+        if ((inner >= m_size) || (outer >= m_size)) {
+            return true;
+        }
+        return (m_links[static_cast<std::size_t>(inner) * m_size + outer] !=
+                0u);
+    }
+
+    /// Check whether a layer can take part in any doublet
+    ///
+    /// Spacepoints on layers that can not, do not need to be binned at all.
+    ///
+    bool linked(index_type volume) const {
+        return ((volume >= m_size) || (m_linked[volume] != 0u));
+    }
+
+    private:
+    /// The number of volumes in the table
+    index_type m_size = 0u;
+    /// The (inner, outer) links, in a row-major square matrix
+    std::vector<std::uint8_t> m_links;
+    /// Whether each volume is part of any link
+    std::vector<std::uint8_t> m_linked;
+
+};  // class layer_link_table
+
+/// Generate the layer link table of a detector
+///
+/// The radial and longitudinal extent of every volume is estimated from the
+/// centres of its surfaces, extended by the given envelopes. Two volumes
+/// are linked if the radial distance between them can be within
+/// [deltaRMin, deltaRMax], and a straight line from the collision region
+/// through the inner volume can reach the outer one.
+///
+/// @param surfaces The transforms of all surfaces, by their geometry ID
+/// @param config The seed finder configuration
+/// @param r_envelope Radial envelope around the surface centres, which should
+///        be smaller than @c deltaRMin / 2 not to link barrel layers to
+///        themselves
+/// @param z_envelope Longitudinal envelope around the surface centres,
+///        which should cover the half lengths of the modules
+/// @return The layer link table of the detector
+///
+layer_link_table make_layer_link_table(
+    const std::map<geometry_id, transform3>& surfaces,
+    const seedfinder_config& config,
+    scalar r_envelope = 5.f * unit<scalar>::mm,
+    scalar z_envelope = 50.f * unit<scalar>::mm);
+
+/// Generate the layer link table of a detray detector
+///
+/// @param det The detector to generate the table for
+/// @param config The seed finder configuration
+/// @param r_envelope Radial envelope around the surface centres
+/// @param z_envelope Longitudinal envelope around the surface centres
+/// @return The layer link table of the detector
+///
+template <typename detector_t>
+layer_link_table make_layer_link_table(
+    const detector_t& det, const seedfinder_config& config,
+    scalar r_envelope = 5.f * unit<scalar>::mm,
+    scalar z_envelope = 50.f * unit<scalar>::mm) {
+
+    std::map<geometry_id, transform3> surfaces;
+    const typename detector_t::geometry_context ctx0{};
+    for (const auto& sf_desc : det.surfaces()) {
+        const detray::tracking_surface sf{det, sf_desc.barcode()};
+        surfaces.insert({sf.barcode().value(), sf.transform(ctx0)});
+    }
+    return make_layer_link_table(surfaces, config, r_envelope, z_envelope);
+}
+
+}  // namespace traccc
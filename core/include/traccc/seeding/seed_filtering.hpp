@@ -8,18 +8,42 @@
 #pragma once
 
 // Library include(s).
+#include "traccc/edm/compact_spacepoint.hpp"
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
 #include "traccc/seeding/detail/triplet.hpp"
 
+// System include(s).
+#include <vector>
+
 namespace traccc {
 
 /// Seed filtering to filter out the bad triplets
 class seed_filtering {
 
     public:
+    /// Seed candidate of a middle spacepoint, with its sort keys
+    struct candidate {
+        /// Weight of the seed
+        scalar weight;
+        /// Sum of the squared y and z coordinates of the bottom and top
+        /// spacepoints, used for ordering seeds with the same weight
+        scalar sum;
+        /// Index of the seed in @c scratch_type::seeds
+        unsigned int index;
+    };
+
+    /// Buffers used by the seed filtering, re-used between calls
+    struct scratch_type {
+        /// Seeds of the current middle spacepoint
+        std::vector<seed> seeds;
+        /// Sort keys of the seeds of the current middle spacepoint
+        std::vector<candidate> candidates;
+    };
+
     /// Constructor with the seed filter configuration
     seed_filtering(const seedfilter_config& config);
 
@@ -36,7 +60,62 @@ class seed_filtering {
                     const sp_grid& g2, triplet_collection_types::host& triplets,
                     seed_collection_types::host& seeds) const;
 
+    /// Callable operator for the seed filtering, with scratch buffers
+    ///
+    /// @param isp_collection is internal spacepoint collection
+    /// @param triplets is the vector of triplets per middle spacepoint
+    /// @param scratch are buffers re-used between the calls
+    ///
+    /// void interface
+    ///
+    /// @return seeds are the vector of seeds where the new compatible seeds are
+    /// added
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    const sp_grid& g2, triplet_collection_types::host& triplets,
+                    seed_collection_types::host& seeds,
+                    scratch_type& scratch) const;
+
+    /// Callable operator for the seed filtering, with a flat spacepoint grid
+    ///
+    /// @param isp_collection is internal spacepoint collection
+    /// @param triplets is the vector of triplets per middle spacepoint
+    /// @param scratch are buffers re-used between the calls
+    ///
+    /// void interface
+    ///
+    /// @return seeds are the vector of seeds where the new compatible seeds are
+    /// added
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    const flat_sp_grid& g2,
+                    triplet_collection_types::host& triplets,
+                    seed_collection_types::host& seeds,
+                    scratch_type& scratch) const;
+
+    /// Callable operator for the seed filtering, with compact spacepoints
+    /// in a flat spacepoint grid
+    ///
+    /// @param sp_collection is the (compact) spacepoint collection
+    /// @param triplets is the vector of triplets per middle spacepoint
+    /// @param scratch are buffers re-used between the calls
+    ///
+    /// void interface
+    ///
+    /// @return seeds are the vector of seeds where the new compatible seeds are
+    /// added
+    void operator()(
+        const compact_spacepoint_collection_types::host& sp_collection,
+        const flat_sp_grid& g2, triplet_collection_types::host& triplets,
+        seed_collection_types::host& seeds, scratch_type& scratch) const;
+
     private:
+    /// Implementation of the seed filtering, for any type of spacepoint and
+    /// grid
+    template <typename spacepoint_collection_t, typename grid_t>
+    void filter(const spacepoint_collection_t& sp_collection,
+                const grid_t& g2, triplet_collection_types::host& triplets,
+                seed_collection_types::host& seeds,
+                scratch_type& scratch) const;
+
     /// Seed filter configuration
     seedfilter_config m_filter_config;
 
@@ -8,8 +8,10 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/edm/compact_spacepoint.hpp"
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
 #include "traccc/seeding/doublet_finding.hpp"
@@ -25,6 +27,22 @@ class seed_finding
           const spacepoint_collection_types::host&, const sp_grid&)> {
 
     public:
+    /// Helper objects re-used for all middle spacepoints, and events
+    struct scratch_type {
+        /// Middle-bottom doublets of one middle spacepoint
+        doublet_finding<details::spacepoint_type::bottom>::output_type mid_bot;
+        /// Middle-top doublets of one middle spacepoint
+        doublet_finding<details::spacepoint_type::top>::output_type mid_top;
+        /// Middle-top doublets sorted by cotTheta
+        sorted_top_doublets sorted_tops;
+        /// Triplets of one middle-bottom doublet
+        triplet_collection_types::host triplets;
+        /// Triplets of one middle spacepoint
+        triplet_collection_types::host triplets_per_spM;
+        /// Scratch space of the seed filtering
+        seed_filtering::scratch_type filter;
+    };
+
     /// Constructor for the seed finding
     ///
     /// @param find_config is seed finder configuration parameters
@@ -43,7 +61,49 @@ class seed_finding
         const spacepoint_collection_types::host& sp_collection,
         const sp_grid& g2) const override;
 
+    /// Seed finding appending to an existing seed collection
+    ///
+    /// @param sp_collection All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param seeds The collection to append the seeds of the event to
+    /// @param scratch Helper objects that can be re-used between calls
+    ///
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    const sp_grid& g2, output_type& seeds,
+                    scratch_type& scratch) const;
+
+    /// Seed finding on a flat grid, appending to an existing seed collection
+    ///
+    /// @param sp_collection All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a flat 2D Phi-Z grid
+    /// @param seeds The collection to append the seeds of the event to
+    /// @param scratch Helper objects that can be re-used between calls
+    ///
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    const flat_sp_grid& g2, output_type& seeds,
+                    scratch_type& scratch) const;
+
+    /// Seed finding with compact spacepoints on a flat grid, appending to an
+    /// existing seed collection
+    ///
+    /// @param sp_collection All (compact) spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a flat 2D Phi-Z grid
+    /// @param seeds The collection to append the seeds of the event to
+    /// @param scratch Helper objects that can be re-used between calls
+    ///
+    void operator()(
+        const compact_spacepoint_collection_types::host& sp_collection,
+        const flat_sp_grid& g2, output_type& seeds,
+        scratch_type& scratch) const;
+
     private:
+    /// Implementation of the seed finding, for any type of spacepoint and
+    /// grid
+    template <typename spacepoint_collection_t, typename grid_t>
+    void find_seeds(const spacepoint_collection_t& sp_collection,
+                    const grid_t& g2, output_type& seeds,
+                    scratch_type& scratch) const;
+
     /// Algorithm performing the mid bottom doublet finding
     doublet_finding<details::spacepoint_type::bottom> m_midBot_finding;
     /// Algorithm performing the mid top doublet finding
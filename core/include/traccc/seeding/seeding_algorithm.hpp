@@ -8,30 +8,85 @@
 #pragma once
 
 // Library include(s).
+#include "traccc/edm/compact_spacepoint.hpp"
+#include "traccc/edm/region_of_interest.hpp"
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/layer_link_table.hpp"
 #include "traccc/seeding/seed_finding.hpp"
 #include "traccc/seeding/spacepoint_binning.hpp"
+#include "traccc/seeding/vertex_z_finding.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s).
+#include <functional>
+#include <span>
+
 namespace traccc {
 
 /// Main algorithm for performing the track seeding on the CPU
+///
+/// The spacepoint grid and the scratch space of the seed finding are held in
+/// a @c state_type object. The operators without a state argument set up a
+/// new one for every call, while the ones with a state argument re-fill the
+/// (caller-owned) state, keeping the capacities of its containers between
+/// events. The algorithm itself can be used by multiple threads at the same
+/// time, as long as they don't share a state object.
+///
 class seeding_algorithm : public algorithm<seed_collection_types::host(
                               const spacepoint_collection_types::host&)> {
 
     public:
+    /// Output type of the batched seeding
+    struct batch_output_type {
+        /// The seeds of all events of the batch
+        seed_collection_types::host seeds;
+        /// The index (in the batch) of the event that each seed belongs to
+        vecmem::vector<unsigned int> event_indices;
+    };
+
+    /// Output type of the seeding in regions of interest
+    struct roi_output_type {
+        /// The seeds of all regions of interest
+        seed_collection_types::host seeds;
+        /// The index of the region of interest that each seed belongs to
+        vecmem::vector<unsigned int> roi_indices;
+    };
+
+    /// Helper objects that can be re-used between events
+    struct state_type {
+        /// Spacepoint grid, re-filled for every event / region of interest
+        flat_sp_grid grid;
+        /// Scratch space of the seed finding
+        seed_finding::scratch_type finding;
+        /// Scratch space of the vertex z pre-finding
+        vertex_z_finding::scratch_type vertexing;
+    };
+
     /// Constructor for the seed finding algorithm
     ///
     /// @param mr The memory resource to use
+    /// @param vertex_config The configuration of the (optional) primary
+    ///        vertex z pre-finding
     ///
     seeding_algorithm(const seedfinder_config& finder_config,
                       const spacepoint_grid_config& grid_config,
                       const seedfilter_config& filter_config,
-                      vecmem::memory_resource& mr);
+                      vecmem::memory_resource& mr,
+                      const vertex_z_finder_config& vertex_config = {});
+
+    /// Create a state object, to re-use between calls
+    ///
+    /// @param mr The memory resource to allocate the spacepoint grid from.
+    ///           It must outlive the state, so it should not be reset
+    ///           between the events that the state is used for.
+    /// @return A state object for the operators of this algorithm
+    ///
+    state_type make_state(vecmem::memory_resource& mr) const;
 
     /// Operator executing the algorithm.
     ///
@@ -41,11 +96,147 @@ class seeding_algorithm : public algorithm<seed_collection_types::host(
     output_type operator()(
         const spacepoint_collection_types::host& spacepoints) const override;
 
+    /// Operator executing the algorithm with a re-used state
+    ///
+    /// @param spacepoint All spacepoints in the event
+    /// @param state The state to re-fill
+    /// @return The track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(const spacepoint_collection_types::host& spacepoints,
+                           state_type& state) const;
+
+    /// Operator executing the algorithm on compact spacepoints
+    ///
+    /// @param spacepoint All (compact) spacepoints in the event
+    /// @return The track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(
+        const compact_spacepoint_collection_types::host& spacepoints) const;
+
+    /// Operator executing the algorithm on compact spacepoints, with a
+    /// re-used state
+    ///
+    /// @param spacepoint All (compact) spacepoints in the event
+    /// @param state The state to re-fill
+    /// @return The track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(
+        const compact_spacepoint_collection_types::host& spacepoints,
+        state_type& state) const;
+
+    /// Operator executing the algorithm, using the detector's layer links
+    ///
+    /// Spacepoints are only paired up into doublets if their layers are
+    /// linked in the table, which skips testing most of the spacepoint pairs
+    /// that could never form doublets.
+    ///
+    /// @param spacepoint All spacepoints in the event
+    /// @param links The layer link table of the detector
+    /// @return The track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(const spacepoint_collection_types::host& spacepoints,
+                           const layer_link_table& links) const;
+
+    /// Operator executing the algorithm, using the detector's layer links,
+    /// with a re-used state
+    ///
+    /// @param spacepoint All spacepoints in the event
+    /// @param links The layer link table of the detector
+    /// @param state The state to re-fill
+    /// @return The track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(const spacepoint_collection_types::host& spacepoints,
+                           const layer_link_table& links,
+                           state_type& state) const;
+
+    /// Operator executing the algorithm on a batch of events
+    ///
+    /// The state of the algorithm is set up only once for the whole batch,
+    /// making this much cheaper than calling the single-event operator on
+    /// events with low occupancy.
+    ///
+    /// @param events The spacepoints of all events in the batch
+    /// @return The track seeds of all events, with their event indices
+    ///
+    batch_output_type operator()(
+        std::span<const spacepoint_collection_types::host> events) const;
+
+    /// Operator executing the algorithm in a region of interest
+    ///
+    /// Only the spacepoints in the grid bins overlapping with the region are
+    /// binned, and the collision region of the seed finding is narrowed down
+    /// to the z range of the region.
+    ///
+    /// @param spacepoints All spacepoints in the event
+    /// @param roi The region of interest
+    /// @return The track seeds reconstructed in the region of interest
+    ///
+    output_type operator()(const spacepoint_collection_types::host& spacepoints,
+                           const region_of_interest& roi) const;
+
+    /// Operator executing the algorithm in a region of interest, with a
+    /// re-used state
+    ///
+    /// @param spacepoints All spacepoints in the event
+    /// @param roi The region of interest
+    /// @param state The state to re-fill
+    /// @return The track seeds reconstructed in the region of interest
+    ///
+    output_type operator()(const spacepoint_collection_types::host& spacepoints,
+                           const region_of_interest& roi,
+                           state_type& state) const;
+
+    /// Operator executing the algorithm in multiple regions of interest
+    ///
+    /// The regions are processed one by one, with a single state, so seeds
+    /// in overlapping regions may be found multiple times, once for each
+    /// region.
+    ///
+    /// @param spacepoints All spacepoints in the event
+    /// @param rois The regions of interest
+    /// @return The track seeds of all regions, with their region indices
+    ///
+    roi_output_type operator()(
+        const spacepoint_collection_types::host& spacepoints,
+        std::span<const region_of_interest> rois) const;
+
     private:
+    /// Find the seeds of one (binned) event
+    ///
+    /// With the vertex z pre-finding enabled, the seeds are searched for with
+    /// a narrowed down collision region around every vertex candidate, and
+    /// the seeds found around multiple candidates are only kept once, with
+    /// their highest weight.
+    ///
+    /// @param spacepoints The spacepoints that the grid of @c state was
+    ///                    filled with
+    /// @param state The state of the algorithm
+    /// @param seeds The collection to append the seeds to
+    ///
+    template <typename spacepoint_collection_t>
+    void find_seeds(const spacepoint_collection_t& spacepoints,
+                    state_type& state, output_type& seeds) const;
+
+    /// Find the seeds of one region of interest
+    void find_roi_seeds(const spacepoint_collection_types::host& spacepoints,
+                        const region_of_interest& roi, state_type& state,
+                        output_type& seeds) const;
+
+    /// The seed finder configuration
+    seedfinder_config m_finder_config;
+    /// The seed filter configuration
+    seedfilter_config m_filter_config;
+    /// The vertex z pre-finding configuration
+    vertex_z_finder_config m_vertex_config;
+
     /// Sub-algorithm performing the spacepoint binning
     spacepoint_binning m_spacepoint_binning;
     /// Sub-algorithm performing the seed finding
     seed_finding m_seed_finding;
+    /// Sub-algorithm performing the vertex z pre-finding
+    vertex_z_finding m_vertex_z_finding;
+    /// The memory resource to use
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
 
 };  // class seeding_algorithm
 
@@ -0,0 +1,141 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace traccc {
+
+/// The performance of the seeding with one grid configuration
+struct seeding_grid_tuning_result {
+
+    /// The seed finder configuration that was evaluated
+    seedfinder_config finder_config;
+
+    /// The number of (filled) grid bins, summed over all events
+    std::size_t n_filled_bins = 0;
+    /// The largest number of spacepoints in a single bin
+    std::size_t max_bin_occupancy = 0;
+    /// The mean number of spacepoints in the filled bins
+    double mean_bin_occupancy = 0.;
+
+    /// The number of doublet compatibility tests, summed over all events
+    std::size_t n_tests = 0;
+    /// The number of seeds found, summed over all events
+    std::size_t n_seeds = 0;
+    /// The fraction of the seeds of the reference configuration that were
+    /// found with this configuration as well
+    double relative_efficiency = 0.;
+    /// Whether the configuration kept the efficiency of the reference one
+    bool accepted = false;
+
+    /// @return the number of compatibility tests per seed found
+    double tests_per_seed() const {
+        return (n_seeds > 0) ? static_cast<double>(n_tests) /
+                                   static_cast<double>(n_seeds)
+                             : static_cast<double>(n_tests);
+    }
+};
+
+/// Tuner of the spacepoint grid configuration of the seeding
+///
+/// Replays the seeding on a sample of events with every combination of the
+/// neighbour scopes, phi bin deflection coverages and z binnings that it is
+/// configured with. The z binnings being either uniform, or made of variable
+/// width bins, holding about the same number of spacepoints of the sample
+/// each. Measuring the bin occupancies and the number of doublet
+/// compatibility tests that each combination leads to, along with how many
+/// of the seeds found with the reference configuration it still finds.
+///
+/// The results are returned ordered by the number of compatibility tests
+/// per seed, with the configurations not keeping the efficiency of the
+/// reference at the end.
+///
+class seeding_grid_tuner
+    : public algorithm<std::vector<seeding_grid_tuning_result>(
+          std::span<const spacepoint_collection_types::host>)> {
+
+    public:
+    /// Configuration of the parameter search
+    struct config_type {
+        /// The neighbour scopes to try
+        std::vector<darray<unsigned int, 2>> neighbor_scopes = {
+            {0u, 1u}, {1u, 0u}, {1u, 1u}, {1u, 2u}, {2u, 1u}, {2u, 2u}};
+        /// The phi bin deflection coverages to try
+        std::vector<int> phi_bin_deflection_coverages = {1, 2, 3, 4};
+        /// The z bin sizes to try, relative to the reference configuration's
+        /// (cotThetaMax * deltaRMax, unless set explicitly)
+        std::vector<scalar> z_bin_size_scales = {0.25f, 0.5f, 1.f, 2.f};
+        /// The numbers of variable width, equal occupancy, z bins to try
+        std::vector<unsigned int> equal_occupancy_z_bins = {8u, 16u, 31u};
+        /// The minimal fraction of the reference seeds that a configuration
+        /// needs to find
+        double min_relative_efficiency = 0.999;
+    };
+
+    /// Constructor for the tuner
+    ///
+    /// @param finder_config The reference seed finder configuration
+    /// @param filter_config The seed filter configuration
+    /// @param config The configuration of the parameter search
+    /// @param mr The memory resource to use
+    ///
+    seeding_grid_tuner(const seedfinder_config& finder_config,
+                       const seedfilter_config& filter_config,
+                       const config_type& config, vecmem::memory_resource& mr);
+
+    /// Evaluate all grid configurations on a sample of events
+    ///
+    /// @param events The spacepoints of the sample of events
+    /// @return The results of all configurations, the best one first
+    ///
+    output_type operator()(std::span<const spacepoint_collection_types::host>
+                               events) const override;
+
+    private:
+    /// Evaluate a single grid configuration
+    ///
+    /// The relative efficiency of the configuration is not set by this
+    /// function.
+    ///
+    /// @param finder_config The configuration to evaluate
+    /// @param events The spacepoints of the sample of events
+    /// @param seeds The seeds found in every event, ordered by their links
+    /// @return The occupancy and compatibility test counts of the
+    ///         configuration
+    ///
+    seeding_grid_tuning_result evaluate(
+        const seedfinder_config& finder_config,
+        std::span<const spacepoint_collection_types::host> events,
+        std::vector<seed_collection_types::host>& seeds) const;
+
+    /// The reference seed finder configuration
+    seedfinder_config m_finder_config;
+    /// The seed filter configuration
+    seedfilter_config m_filter_config;
+    /// The configuration of the parameter search
+    config_type m_config;
+    /// The memory resource to use
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+
+};  // class seeding_grid_tuner
+
+}  // namespace traccc
@@ -8,13 +8,18 @@
 #pragma once
 
 // Library include(s).
+#include "traccc/edm/compact_spacepoint.hpp"
+#include "traccc/edm/region_of_interest.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/layer_link_table.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // System include(s).
 #include <functional>
+#include <utility>
 
 namespace traccc {
 
@@ -41,7 +46,82 @@ class spacepoint_binning
     output_type operator()(
         const spacepoint_collection_types::host& sp_collection) const override;
 
+    /// Operator re-filling an existing grid
+    ///
+    /// The bins of the grid are emptied without releasing their memory, so
+    /// that binning many (small) events into the same grid would not need to
+    /// allocate memory for every event.
+    ///
+    /// @param sp_collection All of the spacepoints of the event
+    /// @param grid A grid created earlier by this algorithm, to be re-filled
+    ///
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    output_type& grid) const;
+
+    /// Operator filling a flat grid
+    ///
+    /// The spacepoints are counted per bin first, and then scattered into
+    /// the flat array of the grid. The grid's memory is re-used, so a grid
+    /// filled for many events would only allocate memory for the largest
+    /// one.
+    ///
+    /// @param sp_collection All of the spacepoints of the event
+    /// @param grid A grid created with the axes of this algorithm
+    ///
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    flat_sp_grid& grid) const;
+
+    /// Operator filling a flat grid with compact spacepoints
+    ///
+    /// @param sp_collection All of the (compact) spacepoints of the event
+    /// @param grid A grid created with the axes of this algorithm
+    ///
+    void operator()(
+        const compact_spacepoint_collection_types::host& sp_collection,
+        flat_sp_grid& grid) const;
+
+    /// Operator filling a flat grid with the spacepoints of a region of
+    /// interest
+    ///
+    /// Only the spacepoints in the grid bins overlapping with the region are
+    /// put into the grid, leaving all other bins empty.
+    ///
+    /// @param sp_collection All of the spacepoints of the event
+    /// @param roi The region of interest
+    /// @param grid A grid created with the axes of this algorithm
+    ///
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    const region_of_interest& roi, flat_sp_grid& grid) const;
+
+    /// Operator filling a flat grid, ordered by the layers of the spacepoints
+    ///
+    /// Spacepoints on layers that can not form any doublets are not binned.
+    /// The spacepoints of every bin are ordered by their layers, and the
+    /// grid keeps a pointer to the layer link table, which must outlive it.
+    ///
+    /// @param sp_collection All of the spacepoints of the event
+    /// @param links The layer link table of the detector
+    /// @param grid A grid created with the axes of this algorithm
+    ///
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    const layer_link_table& links, flat_sp_grid& grid) const;
+
+    /// @return the phi and z axes of the grids made by this algorithm
+    const std::pair<output_type::axis_p0_type, output_type::axis_p1_type>&
+    axes() const {
+        return m_axes;
+    }
+
     private:
+    /// Implementation of the flat grid filling, for any spacepoint type
+    ///
+    /// Only the spacepoints accepted by @c accept, based on the spacepoint
+    /// and its (phi, z) bin, are put into the grid.
+    ///
+    template <typename spacepoint_collection_t, typename sp_filter_t>
+    void fill(const spacepoint_collection_t& sp_collection, flat_sp_grid& grid,
+              const sp_filter_t& accept) const;
+
     seedfinder_config m_config;
     spacepoint_grid_config m_grid_config;
     std::pair<output_type::axis_p0_type, output_type::axis_p1_type> m_axes;
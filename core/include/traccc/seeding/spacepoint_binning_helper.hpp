@@ -92,12 +92,23 @@ inline std::pair<detray::axis2::circular<>, detray::axis2::regular<>> get_axes(
     detray::axis2::circular m_phi_axis{phiBins, grid_config.phiMin,
                                        grid_config.phiMax, mr};
 
+    // With variable width z bins, the z axis is defined in the coordinates
+    // of seedfinder_config::grid_z, with bins of unit width.
+    if (grid_config.nZBinEdges >= 2) {
+        const detray::dindex zBins = grid_config.nZBinEdges - 1;
+        detray::axis2::regular m_z_axis{zBins, 0.f,
+                                        static_cast<scalar>(zBins), mr};
+        return {m_phi_axis, m_z_axis};
+    }
+
     // TODO: can probably be optimized using smaller z bins
     // and returning (multiple) neighbors only in one z-direction for forward
     // seeds
     // FIXME: zBinSize must include scattering
 
-    scalar zBinSize = grid_config.cotThetaMax * grid_config.deltaRMax;
+    scalar zBinSize = (grid_config.zBinSize > 0.f)
+                          ? grid_config.zBinSize
+                          : grid_config.cotThetaMax * grid_config.deltaRMax;
     detray::dindex zBins = std::max(
         1, (int)std::floor((grid_config.zMax - grid_config.zMin) / zBinSize));
 
@@ -107,8 +118,9 @@ inline std::pair<detray::axis2::circular<>, detray::axis2::regular<>> get_axes(
     return {m_phi_axis, m_z_axis};
 }
 
+template <typename spacepoint_t>
 inline TRACCC_HOST_DEVICE size_t is_valid_sp(const seedfinder_config& config,
-                                             const spacepoint& sp) {
+                                             const spacepoint_t& sp) {
     if (sp.z() > config.zMax || sp.z() < config.zMin) {
         return detray::detail::invalid_value<size_t>();
     }
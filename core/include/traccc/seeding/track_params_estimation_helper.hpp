@@ -32,28 +32,21 @@ inline TRACCC_HOST_DEVICE vector2 uv_transform(const scalar& x,
     return uv;
 }
 
-/// helper functions (for both cpu and gpu) to calculate bound track parameter
-/// at the bottom spacepoint
+namespace details {
+
+/// helper function (for both cpu and gpu) to calculate bound track parameter
+/// at the bottom spacepoint, from the positions of the seed's spacepoints
 ///
-/// @param seed is the input seed
+/// @param sp_global_positions are the bottom, middle and top positions
+/// @param spB_local is the local position of the bottom measurement
 /// @param bfield is the magnetic field
 /// @param mass is the mass of particle
-template <typename spacepoint_collection_t>
 inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
-    const spacepoint_collection_t& sp_collection, const seed& seed,
+    const darray<vector3, 3>& sp_global_positions, const point2& spB_local,
     const vector3& bfield, const scalar mass) {
 
     bound_vector params;
 
-    const auto& spB = sp_collection.at(seed.spB_link);
-    const auto& spM = sp_collection.at(seed.spM_link);
-    const auto& spT = sp_collection.at(seed.spT_link);
-
-    darray<vector3, 3> sp_global_positions;
-    sp_global_positions[0] = spB.global;
-    sp_global_positions[1] = spM.global;
-    sp_global_positions[2] = spT.global;
-
     // Define a new coordinate frame with its origin at the bottom space
     // point, z axis long the magnetic field direction and y axis
     // perpendicular to vector from the bottom to middle space point.
@@ -105,9 +98,8 @@ inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
     getter::element(params, e_bound_theta, 0) = getter::theta(direction);
 
     // The measured loc0 and loc1
-    const auto& meas_for_spB = spB.meas;
-    getter::element(params, e_bound_loc0, 0) = meas_for_spB.local[0];
-    getter::element(params, e_bound_loc1, 0) = meas_for_spB.local[1];
+    getter::element(params, e_bound_loc0, 0) = spB_local[0];
+    getter::element(params, e_bound_loc1, 0) = spB_local[1];
 
     // The estimated q/pt in [GeV/c]^-1 (note that the pt is the
     // projection of momentum on the transverse plane of the new frame)
@@ -144,4 +136,58 @@ inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
     return params;
 }
 
+}  // namespace details
+
+/// helper functions (for both cpu and gpu) to calculate bound track parameter
+/// at the bottom spacepoint
+///
+/// @param seed is the input seed
+/// @param bfield is the magnetic field
+/// @param mass is the mass of particle
+template <typename spacepoint_collection_t>
+inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
+    const spacepoint_collection_t& sp_collection, const seed& seed,
+    const vector3& bfield, const scalar mass) {
+
+    const auto& spB = sp_collection.at(seed.spB_link);
+    const auto& spM = sp_collection.at(seed.spM_link);
+    const auto& spT = sp_collection.at(seed.spT_link);
+
+    darray<vector3, 3> sp_global_positions;
+    sp_global_positions[0] = spB.global;
+    sp_global_positions[1] = spM.global;
+    sp_global_positions[2] = spT.global;
+
+    return details::seed_to_bound_vector(sp_global_positions, spB.meas.local,
+                                         bfield, mass);
+}
+
+/// helper functions (for both cpu and gpu) to calculate bound track parameter
+/// at the bottom spacepoint, for compact spacepoints
+///
+/// @param sp_collection is the (compact) spacepoint collection
+/// @param measurements is the measurement collection the spacepoints link to
+/// @param seed is the input seed
+/// @param bfield is the magnetic field
+/// @param mass is the mass of particle
+template <typename spacepoint_collection_t, typename measurement_collection_t>
+inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
+    const spacepoint_collection_t& sp_collection,
+    const measurement_collection_t& measurements, const seed& seed,
+    const vector3& bfield, const scalar mass) {
+
+    const auto& spB = sp_collection.at(seed.spB_link);
+    const auto& spM = sp_collection.at(seed.spM_link);
+    const auto& spT = sp_collection.at(seed.spT_link);
+
+    darray<vector3, 3> sp_global_positions;
+    sp_global_positions[0] = spB.global;
+    sp_global_positions[1] = spM.global;
+    sp_global_positions[2] = spT.global;
+
+    return details::seed_to_bound_vector(
+        sp_global_positions, measurements.at(spB.measurement_index).local,
+        bfield, mass);
+}
+
 }  // namespace traccc
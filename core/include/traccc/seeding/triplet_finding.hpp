@@ -9,10 +9,17 @@
 
 #include "traccc/edm/internal_spacepoint.hpp"
 #include "traccc/seeding/detail/doublet.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
+#include "traccc/seeding/detail/sorted_top_doublets.hpp"
 #include "traccc/seeding/detail/triplet.hpp"
 #include "traccc/seeding/triplet_finding_helper.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 namespace traccc {
 
 /// Triplet finding to search the compatible combintations of two doublets which
@@ -57,9 +64,13 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
     ///
     /// void interface
     ///
+    /// @tparam grid_t The spacepoint grid type (@c traccc::sp_grid or
+    ///                @c traccc::flat_sp_grid)
+    ///
     /// @return a vector of triplets
+    template <typename grid_t>
     void operator()(
-        const sp_grid& g2, const doublet& mid_bot, const lin_circle& lb,
+        const grid_t& g2, const doublet& mid_bot, const lin_circle& lb,
         const doublet_collection_types::host& doublets_mid_top,
         const lin_circle_collection_types::host& lin_circles_mid_top,
         output_type& o) const {
@@ -95,6 +106,109 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
                  lb.Zo()});
         }
 
+        // Update the weights of the triplets
+        update_weights(g2, triplets);
+    }
+
+    /// Callable operator for triplet finding per middle-bottom doublet
+    ///
+    /// Uses the middle-top doublets sorted by cotTheta to only check the
+    /// compatibility of the doublets inside of a cotTheta window around the
+    /// middle-bottom doublet, after a (vectorisable) pre-selection with the
+    /// quantities precomputed for the middle spacepoint. Produces the same
+    /// triplets, in the same order, as the overload without @c sorted_tops.
+    ///
+    /// @param mid_bot is the current middle-bottom doublets
+    /// @param lb is transformed coordinate of mid_bot
+    /// @param doublets_mid_top is the vector of middle-top doublets which share
+    /// same middle spacepoint with current middle-bottom doublet
+    /// @param lin_circles_mid_top is transformed coordinates of
+    /// doublets_mid_top
+    /// @param sorted_tops is lin_circles_mid_top sorted by cotTheta
+    ///
+    /// void interface
+    ///
+    /// @tparam grid_t The spacepoint grid type (@c traccc::sp_grid or
+    ///                @c traccc::flat_sp_grid)
+    ///
+    template <typename grid_t>
+    void operator()(
+        const grid_t& g2, const doublet& mid_bot, const lin_circle& lb,
+        const doublet_collection_types::host& doublets_mid_top,
+        const lin_circle_collection_types::host& lin_circles_mid_top,
+        const sorted_top_doublets& sorted_tops, output_type& triplets) const {
+
+        // Run the algorithm
+        auto& l = mid_bot.sp1;
+        const auto& spM = g2.bin(l.bin_idx)[l.sp_idx];
+
+        scalar iSinTheta2 = 1 + lb.cotTheta() * lb.cotTheta();
+        scalar scatteringInRegion2 = m_config.maxScatteringAngle2 * iSinTheta2;
+        scatteringInRegion2 *=
+            m_config.sigmaScattering * m_config.sigmaScattering;
+        scalar curvature, impact_parameter;
+
+        // Select the middle-top doublets in the cotTheta window.
+        const triplet_finding_helper::bottom_terms terms =
+            triplet_finding_helper::make_bottom_terms(spM, lb,
+                                                      scatteringInRegion2);
+        const scalar half_width = triplet_finding_helper::cotThetaWindow(
+            terms, sorted_tops.maxEr, sorted_tops.maxCotThetaIDeltaR,
+            sorted_tops.maxIDeltaR);
+        const auto [begin, end] = sorted_tops.window(
+            lb.cotTheta() - half_width, lb.cotTheta() + half_width);
+
+        // Pre-select the doublets in the window, in a vectorisable loop.
+        const scalar* cotTheta = sorted_tops.cotTheta.data();
+        const scalar* Er = sorted_tops.Er.data();
+        const scalar* iDeltaR = sorted_tops.iDeltaR.data();
+        std::vector<unsigned char>& mask = sorted_tops.mask;
+        mask.resize(end - begin);
+        for (std::size_t i = begin; i < end; ++i) {
+            mask[i - begin] = triplet_finding_helper::isScatteringCompatible(
+                terms, cotTheta[i], Er[i], iDeltaR[i]);
+        }
+
+        // Collect the pre-selected doublets in their original order.
+        std::vector<unsigned int>& candidates = sorted_tops.candidates;
+        candidates.clear();
+        for (std::size_t i = begin; i < end; ++i) {
+            if (mask[i - begin]) {
+                candidates.push_back(sorted_tops.index[i]);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        // Perform the full compatibility check on them.
+        for (unsigned int i : candidates) {
+            auto& mid_top = doublets_mid_top[i];
+            auto& lt = lin_circles_mid_top[i];
+
+            if (!triplet_finding_helper::isCompatible(
+                    spM, lb, lt, m_config, iSinTheta2, scatteringInRegion2,
+                    curvature, impact_parameter)) {
+                continue;
+            }
+
+            triplets.push_back(
+                {mid_bot.sp2,  // bottom
+                 mid_bot.sp1,  // middle
+                 mid_top.sp2,  // top
+                 curvature,    // curvature
+                 -impact_parameter * m_filter_config.impactWeightFactor,
+                 lb.Zo()});
+        }
+
+        // Update the weights of the triplets
+        update_weights(g2, triplets);
+    }
+
+    private:
+    /// Update the weights of the triplets of a middle-bottom doublet, based
+    /// on the number of compatible triplets
+    template <typename grid_t>
+    void update_weights(const grid_t& g2, output_type& triplets) const {
+
         for (size_t i = 0; i < triplets.size(); ++i) {
             auto& current_triplet = triplets[i];
             auto& spT_idx = current_triplet.sp3;
@@ -163,7 +277,6 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
         }
     }
 
-    private:
     seedfinder_config m_config;
     seedfilter_config m_filter_config;
 };
@@ -18,6 +18,68 @@ namespace traccc {
 
 // helper function used for both cpu and gpu
 struct triplet_finding_helper {
+
+    /// Quantities of a middle-bottom doublet, used in its compatibility checks
+    /// with all middle-top doublets of the same middle spacepoint
+    struct bottom_terms {
+        /// Cotangent of the pitch angle of the middle-bottom doublet
+        scalar cotTheta;
+        /// Error term of the middle-bottom doublet
+        scalar Er;
+        /// Coefficient of |cotTheta| * iDeltaR of the middle-top doublet in
+        /// (an upper limit of) the middle spacepoint correlation term
+        scalar corrR;
+        /// Coefficient of iDeltaR of the middle-top doublet in the middle
+        /// spacepoint correlation term
+        scalar corrZ;
+        /// Square root of the scattering threshold for the lower pT cut
+        scalar scattering;
+    };
+
+    /// Calculate the quantities of a middle-bottom doublet used in
+    /// @c isScatteringCompatible and @c cotThetaWindow
+    ///
+    /// @param spM is middle spacepoint
+    /// @param lb is transformed coordinate of middle-bottom doublet
+    /// @param scatteringInRegion2 is the threshold for scattering angle for the
+    /// lower pT cut
+    ///
+    /// @return the quantities of the middle-bottom doublet
+    static inline TRACCC_HOST_DEVICE bottom_terms
+    make_bottom_terms(const internal_spacepoint<spacepoint>& spM,
+                      const lin_circle& lb, const scalar& scatteringInRegion2);
+
+    /// Conservative version of the scattering angle cut of @c isCompatible
+    ///
+    /// It rejects only doublet pairs that @c isCompatible would reject as
+    /// well, but does so without a square root per pair, and without
+    /// branches, so that it could be vectorised over many middle-top doublets.
+    ///
+    /// @param b are the quantities of the middle-bottom doublet
+    /// @param cotThetaT is cotTheta of the middle-top doublet
+    /// @param ErT is the error term of the middle-top doublet
+    /// @param iDeltaRT is iDeltaR of the middle-top doublet
+    ///
+    /// @return false if the pair surely can not form a triplet
+    static inline TRACCC_HOST_DEVICE bool isScatteringCompatible(
+        const bottom_terms& b, scalar cotThetaT, scalar ErT, scalar iDeltaRT);
+
+    /// Half-width of the cotTheta window of compatible middle-top doublets
+    ///
+    /// Middle-top doublets with a cotTheta farther than this from the one of
+    /// the middle-bottom doublet are surely rejected by @c isCompatible.
+    ///
+    /// @param b are the quantities of the middle-bottom doublet
+    /// @param maxErT is the largest error term of the middle-top doublets
+    /// @param maxCotThetaIDeltaRT is the largest |cotTheta| * iDeltaR of the
+    /// middle-top doublets
+    /// @param maxIDeltaRT is the largest iDeltaR of the middle-top doublets
+    ///
+    /// @return the half-width of the cotTheta window
+    static inline TRACCC_HOST_DEVICE scalar
+    cotThetaWindow(const bottom_terms& b, scalar maxErT,
+                   scalar maxCotThetaIDeltaRT, scalar maxIDeltaRT);
+
     /// Check if two doublets with common middle spacepoint can form a triplet
     ///
     /// @param spM is middle spacepoint
@@ -38,6 +100,51 @@ struct triplet_finding_helper {
         scalar& curvature, scalar& impact_parameter);
 };
 
+triplet_finding_helper::bottom_terms TRACCC_HOST_DEVICE
+triplet_finding_helper::make_bottom_terms(
+    const internal_spacepoint<spacepoint>& spM, const lin_circle& lb,
+    const scalar& scatteringInRegion2) {
+
+    return {lb.cotTheta(), lb.Er(),
+            static_cast<scalar>(2.f) * math::fabs(lb.cotTheta()) *
+                spM.varianceR() * lb.iDeltaR(),
+            static_cast<scalar>(2.f) * spM.varianceZ() * lb.iDeltaR(),
+            std::sqrt(scatteringInRegion2)};
+}
+
+bool TRACCC_HOST_DEVICE triplet_finding_helper::isScatteringCompatible(
+    const bottom_terms& b, scalar cotThetaT, scalar ErT, scalar iDeltaRT) {
+
+    // Upper limit of the error2 value calculated in isCompatible.
+    const scalar error2 =
+        ErT + b.Er + (b.corrR * math::fabs(cotThetaT) + b.corrZ) * iDeltaRT;
+
+    // isCompatible rejects the pair if |deltaCotTheta| - error is larger than
+    // the scattering threshold. Leave a relative margin for the rounding
+    // differences between the two calculations.
+    const scalar excess =
+        math::fabs(b.cotTheta - cotThetaT) * static_cast<scalar>(0.999f) -
+        b.scattering;
+    return (excess <= static_cast<scalar>(0.f)) ||
+           (excess * excess <= error2 * static_cast<scalar>(1.003f));
+}
+
+scalar TRACCC_HOST_DEVICE triplet_finding_helper::cotThetaWindow(
+    const bottom_terms& b, scalar maxErT, scalar maxCotThetaIDeltaRT,
+    scalar maxIDeltaRT) {
+
+    // Upper limit of the error2 value calculated in isCompatible, for any of
+    // the middle-top doublets.
+    const scalar error2 =
+        maxErT + b.Er + b.corrR * maxCotThetaIDeltaRT + b.corrZ * maxIDeltaRT;
+
+    // Use the same margins as isScatteringCompatible, and an additional one
+    // for the rounding of the window edges.
+    return (b.scattering + static_cast<scalar>(1.002f) * std::sqrt(error2)) *
+               static_cast<scalar>(1.002f) +
+           static_cast<scalar>(1e-6f) * math::fabs(b.cotTheta);
+}
+
 bool TRACCC_HOST_DEVICE triplet_finding_helper::isCompatible(
     const internal_spacepoint<spacepoint>& spM, const lin_circle& lb,
     const lin_circle& lt, const seedfinder_config& config,
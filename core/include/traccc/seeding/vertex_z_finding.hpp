@@ -0,0 +1,121 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/compact_spacepoint.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <functional>
+#include <vector>
+
+namespace traccc {
+
+/// Fast primary vertex z pre-finding
+///
+/// Pairs up the (pixel) spacepoints at small radii that are close to each
+/// other in phi, and histograms the z intercepts of the straight lines going
+/// through them with the beam line. The most populated regions of the
+/// histogram are returned as the vertex candidates of the event, which the
+/// seeding can then use to narrow down its collision region.
+///
+class vertex_z_finding
+    : public algorithm<vecmem::vector<scalar>(
+          const spacepoint_collection_types::host&)> {
+
+    public:
+    /// Buffers used by the algorithm, re-used between calls
+    struct scratch_type {
+        /// Radii of the selected spacepoints
+        std::vector<scalar> r;
+        /// Phi coordinates of the selected spacepoints
+        std::vector<scalar> phi;
+        /// Z coordinates of the selected spacepoints
+        std::vector<scalar> z;
+        /// Indices of the selected spacepoints, ordered in phi
+        std::vector<unsigned int> order;
+        /// Z intercepts of the spacepoint pairs
+        std::vector<scalar> intercepts;
+        /// Histogram bins of the z intercepts
+        std::vector<unsigned int> bins;
+        /// The z intercept histogram
+        std::vector<unsigned int> histogram;
+        /// The histogram, summed over three neighbouring bins
+        std::vector<unsigned int> smoothed;
+    };
+
+    /// Constructor for the vertex z finding
+    ///
+    /// @param finder_config is the seed finder configuration, providing the
+    ///        (full) collision region and the beam position
+    /// @param config is the configuration of the vertex pre-finding
+    /// @param mr is the memory resource
+    ///
+    vertex_z_finding(const seedfinder_config& finder_config,
+                     const vertex_z_finder_config& config,
+                     vecmem::memory_resource& mr);
+
+    /// Operator executing the algorithm
+    ///
+    /// @param spacepoints All spacepoints of the event
+    /// @return The z positions of the vertex candidates, most populated first
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::host& spacepoints) const override;
+
+    /// Operator executing the algorithm on compact spacepoints
+    ///
+    /// @param spacepoints All (compact) spacepoints of the event
+    /// @return The z positions of the vertex candidates, most populated first
+    ///
+    output_type operator()(
+        const compact_spacepoint_collection_types::host& spacepoints) const;
+
+    /// Operator executing the algorithm, with re-used buffers
+    ///
+    /// @param spacepoints All spacepoints of the event
+    /// @param scratch Buffers that can be re-used between calls
+    /// @return The z positions of the vertex candidates, most populated first
+    ///
+    output_type operator()(const spacepoint_collection_types::host& spacepoints,
+                           scratch_type& scratch) const;
+
+    /// Operator executing the algorithm on compact spacepoints, with re-used
+    /// buffers
+    ///
+    /// @param spacepoints All (compact) spacepoints of the event
+    /// @param scratch Buffers that can be re-used between calls
+    /// @return The z positions of the vertex candidates, most populated first
+    ///
+    output_type operator()(
+        const compact_spacepoint_collection_types::host& spacepoints,
+        scratch_type& scratch) const;
+
+    private:
+    /// Implementation of the algorithm, for any spacepoint type
+    template <typename spacepoint_collection_t>
+    output_type find(const spacepoint_collection_t& spacepoints,
+                     scratch_type& scratch) const;
+
+    /// The seed finder configuration
+    seedfinder_config m_finder_config;
+    /// The vertex pre-finding configuration
+    vertex_z_finder_config m_config;
+    /// The memory resource to use
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+
+};  // class vertex_z_finding
+
+}  // namespace traccc
@@ -0,0 +1,73 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/utils/field_map.hpp"
+
+// System include(s).
+#include <limits>
+
+namespace traccc {
+
+/// View of a field map, caching the last grid cell that it looked up
+///
+/// The steppers hold their own copy of the magnetic field (view) that they
+/// are created with. So every stepper using this view gets its own cache.
+/// Subsequent lookups of a track mostly fall into the same grid cell, for
+/// which only the interpolation needs to be re-done.
+///
+/// Not thread-safe. A single object should not be used for looking up the
+/// field from multiple threads at the same time.
+///
+class cached_field_view {
+
+    public:
+    /// Constructor from the map to view
+    explicit cached_field_view(const field_map& map) : m_map(&map) {}
+
+    /// @return the field at a position
+    vector3 at(scalar x, scalar y, scalar z) const {
+
+        darray<field_map::index_type, 3> cell;
+        darray<scalar, 3> f;
+        m_map->locate(x, y, z, cell, f);
+        if (cell != m_cell) {
+            m_map->corners(cell, m_bx, m_by, m_bz);
+            m_cell = cell;
+        }
+        return detail::trilinear_interpolate(m_bx, m_by, m_bz, f);
+    }
+
+    private:
+    /// Index value marking the cache as empty
+    static constexpr field_map::index_type invalid_index =
+        std::numeric_limits<field_map::index_type>::max();
+
+    /// The viewed field map
+    const field_map* m_map;
+
+    /// @name Cached grid cell
+    /// @{
+
+    /// The indices of the lower corner of the cached cell
+    mutable darray<field_map::index_type, 3> m_cell{
+        invalid_index, invalid_index, invalid_index};
+    /// The x components of the field on the corners of the cached cell
+    mutable darray<scalar, 8> m_bx{};
+    /// The y components of the field on the corners of the cached cell
+    mutable darray<scalar, 8> m_by{};
+    /// The z components of the field on the corners of the cached cell
+    mutable darray<scalar, 8> m_bz{};
+
+    /// @}
+
+};  // class cached_field_view
+
+}  // namespace traccc
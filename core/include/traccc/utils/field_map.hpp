@@ -0,0 +1,233 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+namespace detail {
+
+/// Trilinear interpolation between the corners of a grid cell
+///
+/// The corner values are given as a structure of arrays, with corner @c c
+/// being at the (c & 1, (c >> 1) & 1, (c >> 2) & 1) position of the cell.
+/// Written with fixed size loops, for the compiler to vectorize them.
+///
+/// @param bx The x components of the field on the corners
+/// @param by The y components of the field on the corners
+/// @param bz The z components of the field on the corners
+/// @param f The position within the cell, in units of the cell size
+/// @return The interpolated field
+///
+TRACCC_HOST_DEVICE
+inline vector3 trilinear_interpolate(const darray<scalar, 8>& bx,
+                                     const darray<scalar, 8>& by,
+                                     const darray<scalar, 8>& bz,
+                                     const darray<scalar, 3>& f) {
+
+    darray<scalar, 8> w;
+    for (unsigned int c = 0; c < 8u; ++c) {
+        w[c] = ((c & 1u) ? f[0] : 1.f - f[0]) *
+               ((c & 2u) ? f[1] : 1.f - f[1]) * ((c & 4u) ? f[2] : 1.f - f[2]);
+    }
+    scalar x = 0.f, y = 0.f, z = 0.f;
+    for (unsigned int c = 0; c < 8u; ++c) {
+        x += w[c] * bx[c];
+        y += w[c] * by[c];
+        z += w[c] * bz[c];
+    }
+    return {x, y, z};
+}
+
+}  // namespace detail
+
+/// Magnetic field map on a regular, axis aligned, 3D grid
+///
+/// The field is interpolated trilinearly between the grid nodes, and is
+/// taken from the closest node outside of the grid. The components of the
+/// field are stored in separate arrays, with the x index running fastest.
+///
+class field_map {
+
+    public:
+    /// Type used for the node indices
+    using index_type = unsigned int;
+
+    /// Default constructor, with an empty map
+    field_map() = default;
+
+    /// Constructor with a constant field
+    ///
+    /// @param b The field everywhere
+    ///
+    explicit field_map(const vector3& b)
+        : m_n_nodes{1u, 1u, 1u},
+          m_bx{b[0]},
+          m_by{b[1]},
+          m_bz{b[2]} {}
+
+    /// Constructor with the field on all grid nodes
+    ///
+    /// @param min The position of the first node
+    /// @param spacing The distances between the nodes along the axes
+    /// @param n_nodes The number of nodes along the axes
+    /// @param bx The x component of the field on the nodes
+    /// @param by The y component of the field on the nodes
+    /// @param bz The z component of the field on the nodes
+    ///
+    field_map(const darray<scalar, 3>& min, const darray<scalar, 3>& spacing,
+              const darray<index_type, 3>& n_nodes, std::vector<scalar> bx,
+              std::vector<scalar> by, std::vector<scalar> bz)
+        : m_min(min),
+          m_n_nodes(n_nodes),
+          m_bx(std::move(bx)),
+          m_by(std::move(by)),
+          m_bz(std::move(bz)) {
+
+        const std::size_t n_total = static_cast<std::size_t>(n_nodes[0]) *
+                                    n_nodes[1] * n_nodes[2];
+        if ((n_total == 0u) || (m_bx.size() != n_total) ||
+            (m_by.size() != n_total) || (m_bz.size() != n_total)) {
+            throw std::invalid_argument(
+                "The field values do not match the number of grid nodes");
+        }
+        for (unsigned int i = 0; i < 3u; ++i) {
+            if (!(spacing[i] > 0.f)) {
+                throw std::invalid_argument(
+                    "The grid spacing needs to be positive");
+            }
+            m_inv_spacing[i] = 1.f / spacing[i];
+        }
+    }
+
+    /// @return the number of grid nodes along the axes
+    const darray<index_type, 3>& n_nodes() const { return m_n_nodes; }
+
+    /// @return whether the map holds any field values
+    bool empty() const { return m_bx.empty(); }
+
+    /// Find the grid cell of a position
+    ///
+    /// @param x The x coordinate of the position
+    /// @param y The y coordinate of the position
+    /// @param z The z coordinate of the position
+    /// @param cell The indices of the lower corner of the cell (output)
+    /// @param f The position within the cell, in units of the cell size
+    ///          (output)
+    ///
+    void locate(scalar x, scalar y, scalar z, darray<index_type, 3>& cell,
+                darray<scalar, 3>& f) const {
+
+        const darray<scalar, 3> pos{x, y, z};
+        for (unsigned int i = 0; i < 3u; ++i) {
+            const scalar last = static_cast<scalar>(m_n_nodes[i] - 1u);
+            const scalar g = std::clamp(
+                (pos[i] - m_min[i]) * m_inv_spacing[i], scalar{0.f}, last);
+            // The last node only starts a cell if it is the only one.
+            const scalar lower =
+                std::min(std::floor(g), std::max(last - 1.f, scalar{0.f}));
+            cell[i] = static_cast<index_type>(lower);
+            f[i] = g - lower;
+        }
+    }
+
+    /// Collect the field on the corners of a grid cell
+    ///
+    /// @param cell The indices of the lower corner of the cell
+    /// @param bx The x components of the field on the corners (output)
+    /// @param by The y components of the field on the corners (output)
+    /// @param bz The z components of the field on the corners (output)
+    ///
+    void corners(const darray<index_type, 3>& cell, darray<scalar, 8>& bx,
+                 darray<scalar, 8>& by, darray<scalar, 8>& bz) const {
+
+        assert(!empty());
+        for (unsigned int c = 0; c < 8u; ++c) {
+            const index_type ix =
+                std::min(cell[0] + (c & 1u), m_n_nodes[0] - 1u);
+            const index_type iy =
+                std::min(cell[1] + ((c >> 1) & 1u), m_n_nodes[1] - 1u);
+            const index_type iz =
+                std::min(cell[2] + ((c >> 2) & 1u), m_n_nodes[2] - 1u);
+            const std::size_t node =
+                (static_cast<std::size_t>(iz) * m_n_nodes[1] + iy) *
+                    m_n_nodes[0] +
+                ix;
+            bx[c] = m_bx[node];
+            by[c] = m_by[node];
+            bz[c] = m_bz[node];
+        }
+    }
+
+    /// Get the (interpolated) field at a position
+    ///
+    /// @param x The x coordinate of the position
+    /// @param y The y coordinate of the position
+    /// @param z The z coordinate of the position
+    /// @return The field at the position
+    ///
+    vector3 at(scalar x, scalar y, scalar z) const {
+
+        darray<index_type, 3> cell;
+        darray<scalar, 3> f;
+        locate(x, y, z, cell, f);
+        darray<scalar, 8> bx, by, bz;
+        corners(cell, bx, by, bz);
+        return detail::trilinear_interpolate(bx, by, bz, f);
+    }
+
+    private:
+    /// The position of the first node
+    darray<scalar, 3> m_min{0.f, 0.f, 0.f};
+    /// The inverse of the distances between the nodes
+    darray<scalar, 3> m_inv_spacing{1.f, 1.f, 1.f};
+    /// The number of nodes along the axes
+    darray<index_type, 3> m_n_nodes{0u, 0u, 0u};
+    /// The x component of the field on the nodes
+    std::vector<scalar> m_bx;
+    /// The y component of the field on the nodes
+    std::vector<scalar> m_by;
+    /// The z component of the field on the nodes
+    std::vector<scalar> m_bz;
+
+};  // class field_map
+
+/// View of a field map, usable as the magnetic field of the steppers
+///
+/// Looks up the field in the map on every call.
+///
+class field_map_view {
+
+    public:
+    /// Constructor from the map to view
+    explicit field_map_view(const field_map& map) : m_map(&map) {}
+
+    /// @return the field at a position
+    vector3 at(scalar x, scalar y, scalar z) const {
+        return m_map->at(x, y, z);
+    }
+
+    private:
+    /// The viewed field map
+    const field_map* m_map;
+
+};  // class field_map_view
+
+}  // namespace traccc
@@ -0,0 +1,52 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <type_traits>
+
+namespace traccc {
+
+/// Convert a matrix to the (scalar) precision of another algebra
+///
+/// Used at the boundaries of calculations that are performed in a different
+/// precision than the one used for storing their inputs and outputs.
+///
+/// @tparam to_algebra_t The algebra to convert the matrix to
+/// @tparam ROWS The number of rows of the matrix
+/// @tparam COLS The number of columns of the matrix
+/// @param m The matrix to convert
+/// @return The converted matrix
+///
+template <typename to_algebra_t, detray::dsize_type<to_algebra_t> ROWS,
+          detray::dsize_type<to_algebra_t> COLS, typename matrix_t>
+TRACCC_HOST_DEVICE inline detray::dmatrix<to_algebra_t, ROWS, COLS>
+convert_matrix(const matrix_t& m) {
+
+    using result_type = detray::dmatrix<to_algebra_t, ROWS, COLS>;
+    using scalar_type = detray::dscalar<to_algebra_t>;
+
+    if constexpr (std::is_same_v<matrix_t, result_type>) {
+        return m;
+    } else {
+        result_type result;
+        for (detray::dsize_type<to_algebra_t> i = 0u; i < ROWS; ++i) {
+            for (detray::dsize_type<to_algebra_t> j = 0u; j < COLS; ++j) {
+                getter::element(result, i, j) =
+                    static_cast<scalar_type>(getter::element(m, i, j));
+            }
+        }
+        return result;
+    }
+}
+
+}  // namespace traccc
@@ -0,0 +1,257 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/seeding/batched_track_params_estimation.hpp"
+
+#include "traccc/definitions/common.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace traccc {
+namespace {
+
+/// Structure-of-arrays buffers of one block of seeds
+struct seed_block {
+
+    /// Block size shorthand
+    static constexpr std::size_t N =
+        batched_track_params_estimation::block_size;
+
+    /// @name Inputs
+    /// @{
+    std::array<scalar, N> bx, by, bz;
+    std::array<scalar, N> mx, my, mz;
+    std::array<scalar, N> tx, ty, tz;
+    /// @}
+
+    /// @name Intermediate results of the circle fit
+    /// @{
+    std::array<scalar, N> dx, dy, dz;
+    std::array<scalar, N> time_z, time_r;
+    /// @}
+
+    /// @name Outputs
+    /// @{
+    std::array<scalar, N> phi, theta, qop, time;
+    /// @}
+};
+
+/// Estimate the track parameters of the (gathered) seeds in a block
+///
+/// Performs the same calculation as @c traccc::seed_to_bound_vector, just
+/// with all vector operations written out explicitly. The circle fit itself
+/// is done in a branch-free loop over the seeds of the block, which only uses
+/// arithmetic operations and square roots, so that it can be vectorised. The
+/// angles (needing @c std::atan2) and the choice between the two time
+/// estimates are done in a second, scalar loop.
+///
+/// @param block The block of seeds
+/// @param n The number of (valid) seeds in the block
+/// @param bfield The magnetic field
+/// @param mass The mass of the particles
+///
+void estimate_block(seed_block& block, std::size_t n, const vector3& bfield,
+                    scalar mass) {
+
+    // Quantities that are the same for all seeds.
+    const scalar bnorm = std::sqrt(bfield[0] * bfield[0] +
+                                   bfield[1] * bfield[1] +
+                                   bfield[2] * bfield[2]);
+    const scalar Zx = bfield[0] / bnorm;
+    const scalar Zy = bfield[1] / bnorm;
+    const scalar Zz = bfield[2] / bnorm;
+    const scalar massInGeV = mass / unit<scalar>::GeV;
+    static constexpr scalar G = static_cast<scalar>(1.f / 24.f);
+
+    for (std::size_t i = 0; i < n; ++i) {
+
+        // The middle and top spacepoints, relative to the bottom one.
+        const scalar d1x = block.mx[i] - block.bx[i];
+        const scalar d1y = block.my[i] - block.by[i];
+        const scalar d1z = block.mz[i] - block.bz[i];
+        const scalar d2x = block.tx[i] - block.bx[i];
+        const scalar d2y = block.ty[i] - block.by[i];
+        const scalar d2z = block.tz[i] - block.bz[i];
+
+        // The axes of the frame with its z axis along the magnetic field,
+        // and the middle spacepoint on its x axis.
+        scalar Yx = Zy * d1z - Zz * d1y;
+        scalar Yy = Zz * d1x - Zx * d1z;
+        scalar Yz = Zx * d1y - Zy * d1x;
+        const scalar iYnorm = 1.f / std::sqrt(Yx * Yx + Yy * Yy + Yz * Yz);
+        Yx *= iYnorm;
+        Yy *= iYnorm;
+        Yz *= iYnorm;
+        const scalar Xx = Yy * Zz - Yz * Zy;
+        const scalar Xy = Yz * Zx - Yx * Zz;
+        const scalar Xz = Yx * Zy - Yy * Zx;
+        // The y axis, as the transform would construct it.
+        const scalar Rx = Zy * Xz - Zz * Xy;
+        const scalar Ry = Zz * Xx - Zx * Xz;
+        const scalar Rz = Zx * Xy - Zy * Xx;
+
+        // The coordinates of the middle and top spacepoints in the new frame.
+        const scalar l1x = d1x * Xx + d1y * Xy + d1z * Xz;
+        const scalar l1y = d1x * Rx + d1y * Ry + d1z * Rz;
+        const scalar l2x = d2x * Xx + d2y * Xy + d2z * Xz;
+        const scalar l2y = d2x * Rx + d2y * Ry + d2z * Rz;
+        const scalar l2z = d2x * Zx + d2y * Zy + d2z * Zz;
+
+        // Conformal transformation.
+        const scalar den1 = l1x * l1x + l1y * l1y;
+        const scalar u1 = l1x / den1;
+        const scalar v1 = l1y / den1;
+        const scalar den2 = l2x * l2x + l2y * l2y;
+        const scalar u2 = l2x / den2;
+        const scalar v2 = l2y / den2;
+
+        // Slope and intercept of the line in the u,v plane.
+        const scalar A = (v2 - v1) / (u2 - u1);
+        const scalar B = v2 - A * u2;
+        const scalar perpA = std::sqrt(1.f + A * A);
+
+        // Curvature, and theta, in the new frame.
+        const scalar rho = -2.0f * B / perpA;
+        const scalar rn = den2;
+        const scalar invTanTheta =
+            l2z * std::sqrt(1.f / rn) / (1.f + G * rho * rho * rn);
+
+        // The momentum direction, transformed back to the original frame.
+        const scalar tdz = perpA * invTanTheta;
+        const scalar itdnorm = 1.f / std::sqrt(1.f + A * A + tdz * tdz);
+        block.dx[i] = (Xx + A * Rx + tdz * Zx) * itdnorm;
+        block.dy[i] = (Xy + A * Ry + tdz * Zy) * itdnorm;
+        block.dz[i] = (Xz + A * Rz + tdz * Zz) * itdnorm;
+
+        // The charge over momentum.
+        const scalar qOverPt = rho / bnorm;
+        const scalar qop = qOverPt / std::sqrt(1.f + invTanTheta * invTanTheta);
+        block.qop[i] = qop;
+
+        // The time, both from the path length along the magnetic field, and
+        // from the full path length. (Divisions by zero just produce values
+        // that are not used later on.)
+        const scalar pInGeV = std::abs(1.0f / qop);
+        const scalar pzInGeV = 1.0f / std::abs(qOverPt) * invTanTheta;
+        const scalar E = std::sqrt(pInGeV * pInGeV + massInGeV * massInGeV);
+        const scalar v = pInGeV / E;
+        const scalar vz = pzInGeV / E;
+        const scalar pathz =
+            (block.bx[i] * bfield[0] + block.by[i] * bfield[1] +
+             block.bz[i] * bfield[2]) /
+            bnorm;
+        const scalar path = std::sqrt(block.bx[i] * block.bx[i] +
+                                      block.by[i] * block.by[i] +
+                                      block.bz[i] * block.bz[i]);
+        block.time_z[i] = pathz / vz;
+        block.time_r[i] = path / v;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+
+        // The angles of the momentum direction.
+        const scalar dx = block.dx[i];
+        const scalar dy = block.dy[i];
+        const scalar dz = block.dz[i];
+        block.phi[i] = std::atan2(dy, dx);
+        block.theta[i] = std::atan2(std::sqrt(dx * dx + dy * dy), dz);
+
+        // Use the time from the path length along the magnetic field, if
+        // that is not zero.
+        const scalar pathz =
+            (block.bx[i] * bfield[0] + block.by[i] * bfield[1] +
+             block.bz[i] * bfield[2]);
+        block.time[i] = (pathz != 0.f) ? block.time_z[i] : block.time_r[i];
+    }
+}
+
+}  // namespace
+
+batched_track_params_estimation::batched_track_params_estimation(
+    vecmem::memory_resource& mr, const config_type& config,
+    executor_type executor)
+    : m_mr(mr), m_config(config), m_executor(std::move(executor)) {}
+
+batched_track_params_estimation::output_type
+batched_track_params_estimation::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    const seed_collection_types::host& seeds, const vector3& bfield,
+    const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
+
+    const std::size_t num_seeds = seeds.size();
+    output_type result(num_seeds, &m_mr.get());
+
+    // The parameters that all seeds start from, with the covariance set.
+    bound_track_parameters param_template;
+    for (std::size_t j = 0; j < e_bound_size; ++j) {
+        getter::element(param_template.covariance(), j, j) =
+            stddev[j] * stddev[j];
+    }
+
+    // Function processing a range of seeds, block by block.
+    auto process_range = [&](std::size_t begin, std::size_t end) {
+        seed_block block;
+        for (std::size_t block_begin = begin; block_begin < end;
+             block_begin += block_size) {
+
+            const std::size_t n = std::min(block_size, end - block_begin);
+
+            // Gather the spacepoint coordinates of the seeds.
+            for (std::size_t i = 0; i < n; ++i) {
+                const seed& s = seeds[block_begin + i];
+                const vector3& b = spacepoints[s.spB_link].global;
+                const vector3& m = spacepoints[s.spM_link].global;
+                const vector3& t = spacepoints[s.spT_link].global;
+                block.bx[i] = b[0];
+                block.by[i] = b[1];
+                block.bz[i] = b[2];
+                block.mx[i] = m[0];
+                block.my[i] = m[1];
+                block.mz[i] = m[2];
+                block.tx[i] = t[0];
+                block.ty[i] = t[1];
+                block.tz[i] = t[2];
+            }
+
+            // Perform the estimation.
+            estimate_block(block, n, bfield, PION_MASS_MEV);
+
+            // Stamp out the parameters.
+            for (std::size_t i = 0; i < n; ++i) {
+                const spacepoint& spB =
+                    spacepoints[seeds[block_begin + i].spB_link];
+                bound_track_parameters& params = result[block_begin + i];
+                params = param_template;
+
+                bound_vector vec;
+                getter::element(vec, e_bound_loc0, 0) = spB.meas.local[0];
+                getter::element(vec, e_bound_loc1, 0) = spB.meas.local[1];
+                getter::element(vec, e_bound_phi, 0) = block.phi[i];
+                getter::element(vec, e_bound_theta, 0) = block.theta[i];
+                getter::element(vec, e_bound_qoverp, 0) = block.qop[i];
+                getter::element(vec, e_bound_time, 0) = block.time[i];
+                params.set_vector(vec);
+                params.set_surface_link(spB.meas.surface_link);
+            }
+        }
+    };
+
+    // Process the seeds, in parallel if possible / necessary.
+    if (m_executor && (num_seeds >= m_config.parallel_threshold)) {
+        m_executor(num_seeds, process_range);
+    } else {
+        process_range(0u, num_seeds);
+    }
+
+    return result;
+}
+
+}  // namespace traccc
@@ -0,0 +1,118 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/seeding/layer_link_table.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace traccc {
+namespace {
+
+/// The (estimated) extent of one volume
+struct volume_extent {
+    scalar r_min = std::numeric_limits<scalar>::max();
+    scalar r_max = std::numeric_limits<scalar>::lowest();
+    scalar z_min = std::numeric_limits<scalar>::max();
+    scalar z_max = std::numeric_limits<scalar>::lowest();
+
+    /// Whether any surface was found in the volume
+    bool valid() const { return (r_min <= r_max); }
+};
+
+/// Check whether doublets could be formed between two volumes
+///
+/// @param inner The extent of the volume of the inner spacepoint
+/// @param outer The extent of the volume of the outer spacepoint
+/// @param config The seed finder configuration
+///
+bool can_link(const volume_extent& inner, const volume_extent& outer,
+              const seedfinder_config& config) {
+
+    // The radial distance needs to be possible to get within the range of the
+    // doublet finding.
+    if ((outer.r_max - inner.r_min < config.deltaRMin) ||
+        (outer.r_min - inner.r_max > config.deltaRMax)) {
+        return false;
+    }
+
+    // Project the straight lines from the collision region through the inner
+    // volume, out to the radii of the outer volume. The function is
+    // monotonic in each of its variables, so its extrema are found in the
+    // corners of the (z0, r_in, z_in, r_out) box.
+    static constexpr scalar min_radius = 1.f * unit<scalar>::mm;
+    const scalar z0s[] = {config.collisionRegionMin,
+                          config.collisionRegionMax};
+    const scalar r_ins[] = {std::max(inner.r_min, min_radius),
+                            std::max(inner.r_max, min_radius)};
+    const scalar z_ins[] = {inner.z_min, inner.z_max};
+    const scalar r_outs[] = {std::max(outer.r_min, min_radius),
+                             std::max(outer.r_max, min_radius)};
+    scalar z_min = std::numeric_limits<scalar>::max();
+    scalar z_max = std::numeric_limits<scalar>::lowest();
+    for (scalar z0 : z0s) {
+        for (scalar r_in : r_ins) {
+            for (scalar z_in : z_ins) {
+                for (scalar r_out : r_outs) {
+                    const scalar z = z0 + (z_in - z0) * r_out / r_in;
+                    z_min = std::min(z_min, z);
+                    z_max = std::max(z_max, z);
+                }
+            }
+        }
+    }
+    return ((z_max >= outer.z_min) && (z_min <= outer.z_max));
+}
+
+}  // namespace
+
+layer_link_table make_layer_link_table(
+    const std::map<geometry_id, transform3>& surfaces,
+    const seedfinder_config& config, scalar r_envelope, scalar z_envelope) {
+
+    // Collect the extent of all volumes.
+    std::vector<volume_extent> extents;
+    for (const auto& [id, transform] : surfaces) {
+        const layer_link_table::index_type volume =
+            static_cast<layer_link_table::index_type>(
+                detray::geometry::barcode{id}.volume());
+        if (volume >= extents.size()) {
+            extents.resize(volume + 1u);
+        }
+        const point3 centre = transform.translation();
+        const scalar r = std::sqrt(centre[0] * centre[0] +
+                                   centre[1] * centre[1]);
+        volume_extent& extent = extents[volume];
+        extent.r_min = std::min(extent.r_min, r - r_envelope);
+        extent.r_max = std::max(extent.r_max, r + r_envelope);
+        extent.z_min = std::min(extent.z_min, centre[2] - z_envelope);
+        extent.z_max = std::max(extent.z_max, centre[2] + z_envelope);
+    }
+
+    // Link all compatible volumes.
+    layer_link_table result(
+        static_cast<layer_link_table::index_type>(extents.size()));
+    for (layer_link_table::index_type inner = 0; inner < extents.size();
+         ++inner) {
+        if (!extents[inner].valid()) {
+            continue;
+        }
+        for (layer_link_table::index_type outer = 0; outer < extents.size();
+             ++outer) {
+            if (extents[outer].valid() &&
+                can_link(extents[inner], extents[outer], config)) {
+                result.link(inner, outer);
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,7 +10,45 @@
 
 #include "traccc/seeding/seed_selecting_helper.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
 namespace traccc {
+namespace {
+
+/// Squared distance of a spacepoint from the x axis, as used in ordering
+/// the seeds with the same weight
+///
+/// The squares are evaluated in double precision, where they are exact.
+///
+template <typename spacepoint_t>
+scalar yz_distance2(const spacepoint_t& sp) {
+
+    const double y = sp.y();
+    const double z = sp.z();
+    return static_cast<scalar>(y * y + z * z);
+}
+
+/// Ordering of the seed candidates, best seed first
+///
+/// Seeds with the same weight are ordered by the distances of their bottom
+/// and top spacepoints from the x axis. If those agree as well, the order in
+/// which the seeds were found is kept.
+///
+bool candidate_order(const seed_filtering::candidate& c1,
+                     const seed_filtering::candidate& c2) {
+
+    if (c1.weight != c2.weight) {
+        return c1.weight > c2.weight;
+    }
+    if (c1.sum != c2.sum) {
+        return c1.sum > c2.sum;
+    }
+    return c1.index < c2.index;
+}
+
+}  // namespace
 
 seed_filtering::seed_filtering(const seedfilter_config& config)
     : m_filter_config(config) {}
@@ -20,7 +58,44 @@ void seed_filtering::operator()(
     triplet_collection_types::host& triplets,
     seed_collection_types::host& seeds) const {
 
-    seed_collection_types::host seeds_per_spM;
+    scratch_type scratch;
+    (*this)(sp_collection, g2, triplets, seeds, scratch);
+}
+
+void seed_filtering::operator()(
+    const spacepoint_collection_types::host& sp_collection, const sp_grid& g2,
+    triplet_collection_types::host& triplets,
+    seed_collection_types::host& seeds, scratch_type& scratch) const {
+
+    filter(sp_collection, g2, triplets, seeds, scratch);
+}
+
+void seed_filtering::operator()(
+    const spacepoint_collection_types::host& sp_collection,
+    const flat_sp_grid& g2, triplet_collection_types::host& triplets,
+    seed_collection_types::host& seeds, scratch_type& scratch) const {
+
+    filter(sp_collection, g2, triplets, seeds, scratch);
+}
+
+void seed_filtering::operator()(
+    const compact_spacepoint_collection_types::host& sp_collection,
+    const flat_sp_grid& g2, triplet_collection_types::host& triplets,
+    seed_collection_types::host& seeds, scratch_type& scratch) const {
+
+    filter(sp_collection, g2, triplets, seeds, scratch);
+}
+
+template <typename spacepoint_collection_t, typename grid_t>
+void seed_filtering::filter(
+    const spacepoint_collection_t& sp_collection, const grid_t& g2,
+    triplet_collection_types::host& triplets,
+    seed_collection_types::host& seeds, scratch_type& scratch) const {
+
+    std::vector<seed>& seeds_per_spM = scratch.seeds;
+    std::vector<candidate>& candidates = scratch.candidates;
+    seeds_per_spM.clear();
+    candidates.clear();
 
     for (triplet& triplet : triplets) {
         // bottom
@@ -43,68 +118,43 @@ void seed_filtering::operator()(
             continue;
         }
 
+        // Precompute the sort key of the seed, so that the spacepoints would
+        // not need to be looked at again during the sorting.
+        scalar sum = 0;
+        sum += yz_distance2(sp_collection.at(spB.m_link));
+        sum += yz_distance2(sp_collection.at(spT.m_link));
+        candidates.push_back({triplet.weight, sum,
+                              static_cast<unsigned int>(seeds_per_spM.size())});
+
         seeds_per_spM.push_back({spB.m_link, spM.m_link, spT.m_link,
                                  triplet.weight, triplet.z_vertex});
     }
 
-    // sort seeds based on their weights
-    std::sort(
-        seeds_per_spM.begin(), seeds_per_spM.end(),
-        [&](seed& seed1, seed& seed2) {
-            if (seed1.weight != seed2.weight) {
-                return seed1.weight > seed2.weight;
-            } else {
-                scalar seed1_sum = 0;
-                scalar seed2_sum = 0;
-                auto& spB1 = sp_collection.at(seed1.spB_link);
-                auto& spT1 = sp_collection.at(seed1.spT_link);
-                auto& spB2 = sp_collection.at(seed2.spB_link);
-                auto& spT2 = sp_collection.at(seed2.spT_link);
-
-                seed1_sum +=
-                    static_cast<scalar>(pow(spB1.y(), 2) + pow(spB1.z(), 2));
-                seed1_sum +=
-                    static_cast<scalar>(pow(spT1.y(), 2) + pow(spT1.z(), 2));
-                seed2_sum +=
-                    static_cast<scalar>(pow(spB2.y(), 2) + pow(spB2.z(), 2));
-                seed2_sum +=
-                    static_cast<scalar>(pow(spT2.y(), 2) + pow(spT2.z(), 2));
-
-                return seed1_sum > seed2_sum;
-            }
-        });
-
-    seed_collection_types::host new_seeds;
-    if (seeds_per_spM.size() > 1) {
-        new_seeds.push_back(seeds_per_spM[0]);
-
-        size_t itLength = std::min(seeds_per_spM.size(),
-                                   m_filter_config.max_triplets_per_spM);
-        // don't cut first element
-        for (size_t i = 1; i < itLength; i++) {
-            if (seed_selecting_helper::cut_per_middle_sp(
-                    m_filter_config, sp_collection, seeds_per_spM[i],
-                    seeds_per_spM[i].weight)) {
-                new_seeds.push_back(std::move(seeds_per_spM[i]));
-            }
-        }
-        seeds_per_spM = std::move(new_seeds);
-    }
-
-    unsigned int maxSeeds = seeds_per_spM.size();
-
-    if (maxSeeds > m_filter_config.maxSeedsPerSpM) {
-        maxSeeds = m_filter_config.maxSeedsPerSpM + 1;
+    if (candidates.empty()) {
+        return;
     }
 
-    auto itBegin = seeds_per_spM.begin();
-    auto it = seeds_per_spM.begin();
-    // default filter removes the last seeds if maximum amount exceeded
-    // ordering by weight by filterSeeds_2SpFixed means these are the lowest
-    // weight seeds
-
-    for (; it < itBegin + maxSeeds; ++it) {
-        seeds.push_back(*it);
+    // Only the best max_triplets_per_spM seeds (but at least one) are
+    // considered in the following, so only those need to be sorted.
+    const std::size_t n_sorted = std::max<std::size_t>(
+        1u, std::min(candidates.size(), m_filter_config.max_triplets_per_spM));
+    std::partial_sort(candidates.begin(), candidates.begin() + n_sorted,
+                      candidates.end(), candidate_order);
+
+    // The best seed is always kept. The rest need to pass the cut per middle
+    // spacepoint. At most maxSeedsPerSpM + 1 seeds are kept in total.
+    const std::size_t max_seeds =
+        static_cast<std::size_t>(m_filter_config.maxSeedsPerSpM) + 1u;
+    seeds.push_back(seeds_per_spM[candidates[0].index]);
+    std::size_t n_seeds = 1;
+    for (std::size_t i = 1; (i < n_sorted) && (n_seeds < max_seeds); ++i) {
+        const seed& s = seeds_per_spM[candidates[i].index];
+        if (seed_selecting_helper::cut_per_middle_sp(m_filter_config,
+                                                     sp_collection, s,
+                                                     s.weight)) {
+            seeds.push_back(s);
+            ++n_seeds;
+        }
     }
 }
 
@@ -23,27 +23,71 @@ seed_finding::output_type seed_finding::operator()(
 
     // Run the algorithm
     output_type seeds;
+    scratch_type scratch;
+    (*this)(sp_collection, g2, seeds, scratch);
+    return seeds;
+}
+
+void seed_finding::operator()(
+    const spacepoint_collection_types::host& sp_collection, const sp_grid& g2,
+    output_type& seeds, scratch_type& scratch) const {
+
+    find_seeds(sp_collection, g2, seeds, scratch);
+}
+
+void seed_finding::operator()(
+    const spacepoint_collection_types::host& sp_collection,
+    const flat_sp_grid& g2, output_type& seeds, scratch_type& scratch) const {
+
+    find_seeds(sp_collection, g2, seeds, scratch);
+}
+
+void seed_finding::operator()(
+    const compact_spacepoint_collection_types::host& sp_collection,
+    const flat_sp_grid& g2, output_type& seeds, scratch_type& scratch) const {
+
+    find_seeds(sp_collection, g2, seeds, scratch);
+}
+
+template <typename spacepoint_collection_t, typename grid_t>
+void seed_finding::find_seeds(
+    const spacepoint_collection_t& sp_collection, const grid_t& g2,
+    output_type& seeds, scratch_type& scratch) const {
+
+    auto& mid_bot = scratch.mid_bot;
+    auto& mid_top = scratch.mid_top;
+    auto& sorted_tops = scratch.sorted_tops;
+    auto& triplets = scratch.triplets;
+    auto& triplets_per_spM = scratch.triplets_per_spM;
 
     for (unsigned int i = 0; i < g2.nbins(); i++) {
-        auto& spM_collection = g2.bin(i);
+        const auto& spM_collection = g2.bin(i);
 
         for (unsigned int j = 0; j < spM_collection.size(); ++j) {
 
             sp_location spM_location({i, j});
 
             // middule-bottom doublet search
-            auto mid_bot = m_midBot_finding(g2, spM_location);
+            mid_bot.first.clear();
+            mid_bot.second.clear();
+            m_midBot_finding(g2, spM_location, mid_bot);
 
             if (mid_bot.first.empty())
                 continue;
 
             // middule-top doublet search
-            auto mid_top = m_midTop_finding(g2, spM_location);
+            mid_top.first.clear();
+            mid_top.second.clear();
+            m_midTop_finding(g2, spM_location, mid_top);
 
             if (mid_top.first.empty())
                 continue;
 
-            triplet_collection_types::host triplets_per_spM;
+            triplets_per_spM.clear();
+
+            // sort the middle-top doublets by cotTheta once for all
+            // middle-bottom doublets
+            sorted_tops.fill(mid_top.second);
 
             // triplet search from the combinations of two doublets which
             // share middle spacepoint
@@ -51,19 +95,19 @@ seed_finding::output_type seed_finding::operator()(
                 auto& doublet_mb = mid_bot.first[k];
                 auto& lb = mid_bot.second[k];
 
-                triplet_collection_types::host triplets = m_triplet_finding(
-                    g2, doublet_mb, lb, mid_top.first, mid_top.second);
+                triplets.clear();
+                m_triplet_finding(g2, doublet_mb, lb, mid_top.first,
+                                  mid_top.second, sorted_tops, triplets);
 
                 triplets_per_spM.insert(std::end(triplets_per_spM),
                                         triplets.begin(), triplets.end());
             }
 
             // seed filtering
-            m_seed_filtering(sp_collection, g2, triplets_per_spM, seeds);
+            m_seed_filtering(sp_collection, g2, triplets_per_spM, seeds,
+                             scratch.filter);
         }
     }
-
-    return seeds;
 }
 
 }  // namespace traccc
@@ -11,22 +11,237 @@
 #include "traccc/seeding/detail/seeding_config.hpp"
 
 // System include(s).
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
 namespace traccc {
+namespace {
 
-seeding_algorithm::seeding_algorithm(const seedfinder_config& finder_config,
-                                     const spacepoint_grid_config& grid_config,
-                                     const seedfilter_config& filter_config,
-                                     vecmem::memory_resource& mr)
-    : m_spacepoint_binning(finder_config, grid_config, mr),
-      m_seed_finding(finder_config, filter_config) {}
+/// Ordering of seeds by their spacepoints
+///
+/// Seeds made of the same spacepoints are ordered by decreasing weight (and
+/// then by their vertex z), so that the first one of them is always the
+/// best one.
+///
+bool seed_link_order(const seed& lhs, const seed& rhs) {
+
+    if (lhs.spM_link != rhs.spM_link) {
+        return lhs.spM_link < rhs.spM_link;
+    } else if (lhs.spB_link != rhs.spB_link) {
+        return lhs.spB_link < rhs.spB_link;
+    } else if (lhs.spT_link != rhs.spT_link) {
+        return lhs.spT_link < rhs.spT_link;
+    } else if (lhs.weight != rhs.weight) {
+        return lhs.weight > rhs.weight;
+    } else {
+        return lhs.z_vertex < rhs.z_vertex;
+    }
+}
+
+/// Check whether two seeds are made of the same spacepoints
+bool same_links(const seed& lhs, const seed& rhs) {
+
+    return ((lhs.spB_link == rhs.spB_link) && (lhs.spM_link == rhs.spM_link) &&
+            (lhs.spT_link == rhs.spT_link));
+}
+
+}  // namespace
+
+seeding_algorithm::seeding_algorithm(
+    const seedfinder_config& finder_config,
+    const spacepoint_grid_config& grid_config,
+    const seedfilter_config& filter_config, vecmem::memory_resource& mr,
+    const vertex_z_finder_config& vertex_config)
+    : m_finder_config(finder_config),
+      m_filter_config(filter_config),
+      m_vertex_config(vertex_config),
+      m_spacepoint_binning(finder_config, grid_config, mr),
+      m_seed_finding(finder_config, filter_config),
+      m_vertex_z_finding(finder_config, vertex_config, mr),
+      m_mr(mr) {}
+
+seeding_algorithm::state_type seeding_algorithm::make_state(
+    vecmem::memory_resource& mr) const {
+
+    return {flat_sp_grid(m_spacepoint_binning.axes(), mr), {}, {}};
+}
 
 seeding_algorithm::output_type seeding_algorithm::operator()(
     const spacepoint_collection_types::host& spacepoints) const {
 
-    return m_seed_finding(spacepoints, m_spacepoint_binning(spacepoints));
+    state_type state = make_state(m_mr.get());
+    return (*this)(spacepoints, state);
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    state_type& state) const {
+
+    // Bin the spacepoints into the flat grid of the state, which needs much
+    // fewer memory allocations than an sp_grid would.
+    m_spacepoint_binning(spacepoints, state.grid);
+
+    // Find the seeds.
+    output_type seeds{&(m_mr.get())};
+    find_seeds(spacepoints, state, seeds);
+    return seeds;
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const compact_spacepoint_collection_types::host& spacepoints) const {
+
+    state_type state = make_state(m_mr.get());
+    return (*this)(spacepoints, state);
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const compact_spacepoint_collection_types::host& spacepoints,
+    state_type& state) const {
+
+    m_spacepoint_binning(spacepoints, state.grid);
+
+    output_type seeds{&(m_mr.get())};
+    find_seeds(spacepoints, state, seeds);
+    return seeds;
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    const layer_link_table& links) const {
+
+    state_type state = make_state(m_mr.get());
+    return (*this)(spacepoints, links, state);
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    const layer_link_table& links, state_type& state) const {
+
+    m_spacepoint_binning(spacepoints, links, state.grid);
+
+    output_type seeds{&(m_mr.get())};
+    find_seeds(spacepoints, state, seeds);
+    return seeds;
+}
+
+seeding_algorithm::batch_output_type seeding_algorithm::operator()(
+    std::span<const spacepoint_collection_types::host> events) const {
+
+    batch_output_type result{seed_collection_types::host{&(m_mr.get())},
+                             vecmem::vector<unsigned int>{&(m_mr.get())}};
+
+    // Use the same state for all events.
+    state_type state = make_state(m_mr.get());
+    for (std::size_t event = 0; event < events.size(); ++event) {
+
+        // Skip the (binning of the) empty events.
+        if (events[event].empty()) {
+            continue;
+        }
+
+        // Find the seeds of the event.
+        m_spacepoint_binning(events[event], state.grid);
+        find_seeds(events[event], state, result.seeds);
+
+        // Tag the new seeds with the index of the event.
+        result.event_indices.resize(result.seeds.size(),
+                                    static_cast<unsigned int>(event));
+    }
+
+    return result;
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    const region_of_interest& roi) const {
+
+    state_type state = make_state(m_mr.get());
+    return (*this)(spacepoints, roi, state);
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    const region_of_interest& roi, state_type& state) const {
+
+    output_type seeds{&(m_mr.get())};
+    find_roi_seeds(spacepoints, roi, state, seeds);
+    return seeds;
+}
+
+seeding_algorithm::roi_output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    std::span<const region_of_interest> rois) const {
+
+    roi_output_type result{seed_collection_types::host{&(m_mr.get())},
+                           vecmem::vector<unsigned int>{&(m_mr.get())}};
+
+    // Use the same state for all regions.
+    state_type state = make_state(m_mr.get());
+    for (std::size_t roi = 0; roi < rois.size(); ++roi) {
+
+        // Find the seeds of the region.
+        find_roi_seeds(spacepoints, rois[roi], state, result.seeds);
+
+        // Tag the new seeds with the index of the region.
+        result.roi_indices.resize(result.seeds.size(),
+                                  static_cast<unsigned int>(roi));
+    }
+
+    return result;
+}
+
+void seeding_algorithm::find_roi_seeds(
+    const spacepoint_collection_types::host& spacepoints,
+    const region_of_interest& roi, state_type& state,
+    output_type& seeds) const {
+
+    // Bin the spacepoints of the region.
+    m_spacepoint_binning(spacepoints, roi, state.grid);
+
+    // Find the seeds pointing at the z range of the region.
+    seedfinder_config config = m_finder_config;
+    config.collisionRegionMin = std::max(config.collisionRegionMin, roi.z_min);
+    config.collisionRegionMax = std::min(config.collisionRegionMax, roi.z_max);
+    seed_finding(config, m_filter_config)(spacepoints, state.grid, seeds,
+                                          state.finding);
+}
+
+template <typename spacepoint_collection_t>
+void seeding_algorithm::find_seeds(const spacepoint_collection_t& spacepoints,
+                                   state_type& state,
+                                   output_type& seeds) const {
+
+    // Without vertex candidates, use the full collision region.
+    if (!m_vertex_config.enable) {
+        m_seed_finding(spacepoints, state.grid, seeds, state.finding);
+        return;
+    }
+    const vertex_z_finding::output_type candidates =
+        m_vertex_z_finding(spacepoints, state.vertexing);
+    if (candidates.empty()) {
+        m_seed_finding(spacepoints, state.grid, seeds, state.finding);
+        return;
+    }
+
+    // Find the seeds pointing at each vertex candidate.
+    const auto first_seed = seeds.end() - seeds.begin();
+    for (scalar z : candidates) {
+        seedfinder_config config = m_finder_config;
+        config.collisionRegionMin = std::max(
+            config.collisionRegionMin, z - m_vertex_config.window_half_width);
+        config.collisionRegionMax = std::min(
+            config.collisionRegionMax, z + m_vertex_config.window_half_width);
+        seed_finding(config, m_filter_config)(spacepoints, state.grid, seeds,
+                                              state.finding);
+    }
+
+    // Remove the seeds found for more than one candidate, keeping the one
+    // with the highest weight.
+    std::sort(seeds.begin() + first_seed, seeds.end(), seed_link_order);
+    seeds.erase(std::unique(seeds.begin() + first_seed, seeds.end(),
+                            same_links),
+                seeds.end());
 }
 
 }  // namespace traccc
@@ -0,0 +1,231 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/seeding/seeding_grid_tuner.hpp"
+
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
+#include "traccc/seeding/seed_finding.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+
+// System include(s).
+#include <algorithm>
+
+namespace traccc {
+namespace {
+
+/// Ordering of seeds by their spacepoints
+bool seed_link_order(const seed& lhs, const seed& rhs) {
+
+    if (lhs.spM_link != rhs.spM_link) {
+        return lhs.spM_link < rhs.spM_link;
+    } else if (lhs.spB_link != rhs.spB_link) {
+        return lhs.spB_link < rhs.spB_link;
+    } else {
+        return lhs.spT_link < rhs.spT_link;
+    }
+}
+
+/// Set up variable width z bins, with equal occupancies in a sample of events
+///
+/// @param config The configuration to set the z bins in
+/// @param n_bins The (maximal) number of z bins to use
+/// @param events The spacepoints of the sample of events
+///
+void set_equal_occupancy_z_bins(
+    seedfinder_config& config, unsigned int n_bins,
+    std::span<const spacepoint_collection_types::host> events) {
+
+    // Collect the z positions of the spacepoints in the z range.
+    std::vector<scalar> zs;
+    for (const spacepoint_collection_types::host& spacepoints : events) {
+        for (const spacepoint& sp : spacepoints) {
+            if ((sp.z() >= config.zMin) && (sp.z() <= config.zMax)) {
+                zs.push_back(sp.z());
+            }
+        }
+    }
+    std::sort(zs.begin(), zs.end());
+
+    // Put the bin edges at the quantiles of the z positions, skipping the
+    // ones that would make empty bins.
+    n_bins = std::clamp(n_bins, 1u, seedfinder_config::max_z_bin_edges - 1u);
+    config.zBinEdges[0] = config.zMin;
+    config.nZBinEdges = 1u;
+    for (unsigned int i = 1; (i < n_bins) && !zs.empty(); ++i) {
+        const scalar edge = zs[i * zs.size() / n_bins];
+        if (edge > config.zBinEdges[config.nZBinEdges - 1u]) {
+            config.zBinEdges[config.nZBinEdges++] = edge;
+        }
+    }
+    if (config.zMax > config.zBinEdges[config.nZBinEdges - 1u]) {
+        config.zBinEdges[config.nZBinEdges++] = config.zMax;
+    }
+    config.useZBinNeighbors = false;
+}
+
+}  // namespace
+
+seeding_grid_tuner::seeding_grid_tuner(const seedfinder_config& finder_config,
+                                       const seedfilter_config& filter_config,
+                                       const config_type& config,
+                                       vecmem::memory_resource& mr)
+    : m_finder_config(finder_config),
+      m_filter_config(filter_config),
+      m_config(config),
+      m_mr(mr) {}
+
+seeding_grid_tuner::output_type seeding_grid_tuner::operator()(
+    std::span<const spacepoint_collection_types::host> events) const {
+
+    // Find the seeds with the reference configuration.
+    std::vector<seed_collection_types::host> reference_seeds;
+    evaluate(m_finder_config, events, reference_seeds);
+    std::size_t n_reference_seeds = 0;
+    for (const seed_collection_types::host& seeds : reference_seeds) {
+        n_reference_seeds += seeds.size();
+    }
+
+    // The z bin size of the reference configuration.
+    const scalar reference_z_bin_size =
+        (m_finder_config.zBinSize > 0.f)
+            ? m_finder_config.zBinSize
+            : m_finder_config.cotThetaMax * m_finder_config.deltaRMax;
+
+    // The z binnings to try.
+    std::vector<seedfinder_config> z_binnings;
+    for (scalar z_scale : m_config.z_bin_size_scales) {
+        seedfinder_config z_binning = m_finder_config;
+        z_binning.zBinSize = z_scale * reference_z_bin_size;
+        z_binning.nZBinEdges = 0u;
+        z_binning.useZBinNeighbors = false;
+        z_binnings.push_back(z_binning);
+    }
+    for (unsigned int n_bins : m_config.equal_occupancy_z_bins) {
+        seedfinder_config z_binning = m_finder_config;
+        set_equal_occupancy_z_bins(z_binning, n_bins, events);
+        z_binnings.push_back(z_binning);
+    }
+
+    // Evaluate all combinations of the parameters.
+    output_type results;
+    std::vector<seed_collection_types::host> seeds;
+    for (const darray<unsigned int, 2>& scope : m_config.neighbor_scopes) {
+        for (int coverage : m_config.phi_bin_deflection_coverages) {
+            for (const seedfinder_config& z_binning : z_binnings) {
+
+                seedfinder_config finder_config = z_binning;
+                finder_config.neighbor_scope = scope;
+                finder_config.phiBinDeflectionCoverage = coverage;
+                seeding_grid_tuning_result result =
+                    evaluate(finder_config, events, seeds);
+
+                // Count the reference seeds that were found again.
+                std::size_t n_found = 0;
+                for (std::size_t event = 0; event < events.size(); ++event) {
+                    for (const seed& s : reference_seeds[event]) {
+                        if (std::binary_search(seeds[event].begin(),
+                                               seeds[event].end(), s,
+                                               seed_link_order)) {
+                            ++n_found;
+                        }
+                    }
+                }
+                result.relative_efficiency =
+                    (n_reference_seeds > 0)
+                        ? static_cast<double>(n_found) /
+                              static_cast<double>(n_reference_seeds)
+                        : 1.;
+                result.accepted = (result.relative_efficiency >=
+                                   m_config.min_relative_efficiency);
+                results.push_back(result);
+            }
+        }
+    }
+
+    // Put the best configurations first.
+    std::stable_sort(results.begin(), results.end(),
+                     [](const seeding_grid_tuning_result& lhs,
+                        const seeding_grid_tuning_result& rhs) {
+                         if (lhs.accepted != rhs.accepted) {
+                             return lhs.accepted;
+                         }
+                         return lhs.tests_per_seed() < rhs.tests_per_seed();
+                     });
+    return results;
+}
+
+seeding_grid_tuning_result seeding_grid_tuner::evaluate(
+    const seedfinder_config& finder_config,
+    std::span<const spacepoint_collection_types::host> events,
+    std::vector<seed_collection_types::host>& seeds) const {
+
+    seeding_grid_tuning_result result;
+    result.finder_config = finder_config;
+
+    // Set up the algorithms for the configuration.
+    const spacepoint_grid_config grid_config(finder_config);
+    const spacepoint_binning binning(finder_config, grid_config, m_mr.get());
+    const seed_finding finding(finder_config, m_filter_config);
+    flat_sp_grid grid(binning.axes(), m_mr.get());
+    seed_finding::scratch_type scratch;
+
+    seeds.resize(events.size(), seed_collection_types::host{&(m_mr.get())});
+    std::size_t n_binned = 0;
+    for (std::size_t event = 0; event < events.size(); ++event) {
+
+        binning(events[event], grid);
+
+        for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+
+            const flat_sp_grid::bin_type spacepoints = grid.bin(bin);
+            if (spacepoints.empty()) {
+                continue;
+            }
+
+            // Measure the occupancy of the bin.
+            ++result.n_filled_bins;
+            n_binned += spacepoints.size();
+            result.max_bin_occupancy =
+                std::max(result.max_bin_occupancy, spacepoints.size());
+
+            // Every middle spacepoint of the bin is tested against all
+            // spacepoints of the neighbour bins, once for its bottom, and
+            // once for its top doublets.
+            const auto phi_bins = grid.axis_p0().zone(
+                spacepoints.front().phi(), finder_config.neighbor_scope);
+            const scalar grid_z = finder_config.grid_z(spacepoints.front().z());
+            const auto z_bins = grid.axis_p1().zone(
+                grid_z, finder_config.z_neighbor_scope(grid_z));
+            std::size_t n_neighbors = 0;
+            for (const auto& phi_bin : phi_bins) {
+                for (const auto& z_bin : z_bins) {
+                    n_neighbors +=
+                        grid.bin(static_cast<unsigned int>(phi_bin),
+                                 static_cast<unsigned int>(z_bin))
+                            .size();
+                }
+            }
+            result.n_tests += 2u * spacepoints.size() * n_neighbors;
+        }
+
+        // Find the seeds of the event.
+        seeds[event].clear();
+        finding(events[event], grid, seeds[event], scratch);
+        std::sort(seeds[event].begin(), seeds[event].end(), seed_link_order);
+        result.n_seeds += seeds[event].size();
+    }
+
+    result.mean_bin_occupancy =
+        (result.n_filled_bins > 0)
+            ? static_cast<double>(n_binned) /
+                  static_cast<double>(result.n_filled_bins)
+            : 0.;
+    return result;
+}
+
+}  // namespace traccc
@@ -11,6 +11,13 @@
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/seeding/spacepoint_binning_helper.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
 namespace traccc {
 
 spacepoint_binning::spacepoint_binning(
@@ -25,6 +32,19 @@ spacepoint_binning::output_type spacepoint_binning::operator()(
     const spacepoint_collection_types::host& sp_collection) const {
 
     output_type g2(m_axes.first, m_axes.second, m_mr.get());
+    (*this)(sp_collection, g2);
+    return g2;
+}
+
+void spacepoint_binning::operator()(
+    const spacepoint_collection_types::host& sp_collection,
+    output_type& g2) const {
+
+    // Empty the bins, keeping their capacity.
+    assert(g2.nbins() == m_axes.first.bins() * m_axes.second.bins());
+    for (unsigned int i = 0; i < g2.nbins(); ++i) {
+        g2.bin(i).clear();
+    }
 
     auto& phi_axis = g2.axis_p0();
     auto& z_axis = g2.axis_p1();
@@ -36,11 +56,178 @@ spacepoint_binning::output_type spacepoint_binning::operator()(
         if (is_valid_sp(m_config, sp) !=
             detray::detail::invalid_value<size_t>()) {
             const std::size_t bin_index =
-                phi_axis.bin(isp.phi()) + phi_axis.bins() * z_axis.bin(isp.z());
+                phi_axis.bin(isp.phi()) +
+                phi_axis.bins() * z_axis.bin(m_config.grid_z(isp.z()));
             g2.bin(bin_index).push_back(std::move(isp));
         }
     }
-    return g2;
+}
+
+void spacepoint_binning::operator()(
+    const spacepoint_collection_types::host& sp_collection,
+    flat_sp_grid& grid) const {
+
+    fill(sp_collection, grid,
+         [](const auto&, unsigned int, unsigned int) { return true; });
+}
+
+void spacepoint_binning::operator()(
+    const compact_spacepoint_collection_types::host& sp_collection,
+    flat_sp_grid& grid) const {
+
+    fill(sp_collection, grid,
+         [](const auto&, unsigned int, unsigned int) { return true; });
+}
+
+void spacepoint_binning::operator()(
+    const spacepoint_collection_types::host& sp_collection,
+    const region_of_interest& roi, flat_sp_grid& grid) const {
+
+    const auto& phi_axis = grid.axis_p0();
+    const auto& z_axis = grid.axis_p1();
+
+    // The phi bins overlapping with the region, widened by the largest
+    // deflection that a minPt track picks up until reaching rMax. (But by at
+    // least phiBinDeflectionCoverage bins.)
+    const unsigned int n_phi_bins = static_cast<unsigned int>(phi_axis.bins());
+    const scalar min_helix_radius = m_config.minPt / m_config.bFieldInZ;
+    const scalar deflection = std::asin(
+        std::min<scalar>(1.f, m_config.rMax / (2.f * min_helix_radius)));
+    const scalar phi_bin_width =
+        static_cast<scalar>(2. * M_PI) / static_cast<scalar>(n_phi_bins);
+    const unsigned int phi_bin_margin = std::max(
+        static_cast<unsigned int>(std::ceil(deflection / phi_bin_width)),
+        static_cast<unsigned int>(
+            std::max(m_config.phiBinDeflectionCoverage, 0)));
+    const unsigned int roi_phi_bin_min =
+        static_cast<unsigned int>(phi_axis.bin(roi.phi_min));
+    const unsigned int roi_phi_bin_max =
+        static_cast<unsigned int>(phi_axis.bin(roi.phi_max));
+    const unsigned int roi_phi_bins =
+        (roi_phi_bin_max + n_phi_bins - roi_phi_bin_min) % n_phi_bins + 1u;
+    const bool phi_all =
+        ((roi.phi_min > roi.phi_max) && (roi_phi_bin_min == roi_phi_bin_max)) ||
+        (roi_phi_bins + 2u * phi_bin_margin >= n_phi_bins);
+    const unsigned int phi_bin_min =
+        (roi_phi_bin_min + n_phi_bins - phi_bin_margin % n_phi_bins) %
+        n_phi_bins;
+    const unsigned int phi_bin_max =
+        (roi_phi_bin_max + phi_bin_margin) % n_phi_bins;
+    const bool phi_wraps = (phi_bin_min > phi_bin_max);
+
+    // The z bins overlapping with the region, anywhere up to the maximal
+    // radius of the seeding.
+    const scalar z_min =
+        roi.z_min +
+        std::min<scalar>(0.f, m_config.rMax * std::sinh(roi.eta_min));
+    const scalar z_max =
+        roi.z_max +
+        std::max<scalar>(0.f, m_config.rMax * std::sinh(roi.eta_max));
+    const unsigned int z_bin_min =
+        static_cast<unsigned int>(z_axis.bin(m_config.grid_z(z_min)));
+    const unsigned int z_bin_max =
+        static_cast<unsigned int>(z_axis.bin(m_config.grid_z(z_max)));
+
+    fill(sp_collection, grid,
+         [&](const spacepoint&, unsigned int phi_bin, unsigned int z_bin) {
+             const bool phi_ok =
+                 phi_all ||
+                 (phi_wraps
+                      ? ((phi_bin >= phi_bin_min) || (phi_bin <= phi_bin_max))
+                      : ((phi_bin >= phi_bin_min) &&
+                         (phi_bin <= phi_bin_max)));
+             return (phi_ok && (z_bin >= z_bin_min) && (z_bin <= z_bin_max));
+         });
+}
+
+void spacepoint_binning::operator()(
+    const spacepoint_collection_types::host& sp_collection,
+    const layer_link_table& links, flat_sp_grid& grid) const {
+
+    // Only bin the spacepoints on layers that can form any doublets.
+    fill(sp_collection, grid,
+         [&links](const spacepoint& sp, unsigned int, unsigned int) {
+             return links.linked(static_cast<layer_link_table::index_type>(
+                 sp.meas.surface_link.volume()));
+         });
+
+    // Order the spacepoints of every bin by their layers, keeping their
+    // original order within the layers.
+    auto layer_of = [&sp_collection](const flat_sp_grid::value_type& isp) {
+        return static_cast<unsigned int>(
+            sp_collection[isp.m_link].meas.surface_link.volume());
+    };
+    for (unsigned int i = 0; i < grid.nbins(); ++i) {
+        std::stable_sort(grid.m_spacepoints.begin() + grid.m_offsets[i],
+                         grid.m_spacepoints.begin() + grid.m_offsets[i + 1u],
+                         [&layer_of](const flat_sp_grid::value_type& lhs,
+                                     const flat_sp_grid::value_type& rhs) {
+                             return layer_of(lhs) < layer_of(rhs);
+                         });
+    }
+
+    // Remember the layers of the spacepoints.
+    grid.m_layers.resize(grid.m_spacepoints.size());
+    std::transform(grid.m_spacepoints.begin(), grid.m_spacepoints.end(),
+                   grid.m_layers.begin(), layer_of);
+    grid.m_layer_links = &links;
+}
+
+template <typename spacepoint_collection_t, typename sp_filter_t>
+void spacepoint_binning::fill(const spacepoint_collection_t& sp_collection,
+                              flat_sp_grid& grid,
+                              const sp_filter_t& accept) const {
+
+    assert(grid.nbins() == m_axes.first.bins() * m_axes.second.bins());
+    const auto& phi_axis = grid.axis_p0();
+    const auto& z_axis = grid.axis_p1();
+
+    // Create the internal spacepoints, find their bins, and count the
+    // spacepoints per bin. The counts are collected in the (shifted) offsets.
+    vecmem::vector<flat_sp_grid::value_type>& isps =
+        grid.m_scratch_spacepoints;
+    vecmem::vector<unsigned int>& sp_bins = grid.m_scratch_bins;
+    vecmem::vector<unsigned int>& offsets = grid.m_offsets;
+    isps.clear();
+    sp_bins.clear();
+    std::fill(offsets.begin(), offsets.end(), 0u);
+    grid.m_layers.clear();
+    grid.m_layer_links = nullptr;
+    for (unsigned int i = 0; i < sp_collection.size(); i++) {
+        const auto& sp = sp_collection[i];
+        if (is_valid_sp(m_config, sp) ==
+            detray::detail::invalid_value<size_t>()) {
+            continue;
+        }
+        const flat_sp_grid::value_type isp(sp, i, m_config.beamPos);
+        const unsigned int phi_bin =
+            static_cast<unsigned int>(phi_axis.bin(isp.phi()));
+        const unsigned int z_bin =
+            static_cast<unsigned int>(z_axis.bin(m_config.grid_z(isp.z())));
+        if (!accept(sp, phi_bin, z_bin)) {
+            continue;
+        }
+        const unsigned int bin_index =
+            static_cast<unsigned int>(phi_bin + phi_axis.bins() * z_bin);
+        isps.push_back(isp);
+        sp_bins.push_back(bin_index);
+        ++offsets[bin_index + 1u];
+    }
+
+    // Turn the counts into offsets.
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // Scatter the spacepoints into their bins, keeping their order within
+    // the bins. Using the offsets of the bins as fill positions, which leaves
+    // them pointing at the end of their bins afterwards.
+    grid.m_spacepoints.resize(offsets.back());
+    for (std::size_t i = 0; i < isps.size(); ++i) {
+        grid.m_spacepoints[offsets[sp_bins[i]]++] = isps[i];
+    }
+
+    // Shift the offsets back to the beginning of the bins.
+    std::copy_backward(offsets.begin(), offsets.end() - 1, offsets.end());
+    offsets.front() = 0u;
 }
 
 }  // namespace traccc
@@ -45,4 +45,35 @@ track_params_estimation::output_type track_params_estimation::operator()(
     return result;
 }
 
+track_params_estimation::output_type track_params_estimation::operator()(
+    const compact_spacepoint_collection_types::host& spacepoints,
+    const measurement_collection_types::host& measurements,
+    const seed_collection_types::host& seeds, const vector3& bfield,
+    const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
+
+    const unsigned int num_seeds = seeds.size();
+    output_type result(num_seeds, &m_mr.get());
+
+    for (unsigned int i = 0; i < num_seeds; ++i) {
+        bound_track_parameters track_params;
+        track_params.set_vector(seed_to_bound_vector(
+            spacepoints, measurements, seeds[i], bfield, PION_MASS_MEV));
+
+        // Set Covariance
+        for (std::size_t j = 0; j < e_bound_size; ++j) {
+            getter::element(track_params.covariance(), j, j) =
+                stddev[j] * stddev[j];
+        }
+
+        // Get geometry ID for bottom spacepoint
+        const auto& spB = spacepoints.at(seeds[i].spB_link);
+        track_params.set_surface_link(
+            measurements.at(spB.measurement_index).surface_link);
+
+        result[i] = track_params;
+    }
+
+    return result;
+}
+
 }  // namespace traccc
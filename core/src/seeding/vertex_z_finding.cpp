@@ -0,0 +1,225 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/seeding/vertex_z_finding.hpp"
+
+#include "traccc/definitions/math.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+
+namespace traccc {
+namespace {
+
+/// The number of interleaved copies of the histogram used in its filling
+///
+/// Consecutive intercepts are counted in different copies, so that the
+/// increments of (the same bins of) the histogram would not need to wait for
+/// each other.
+///
+static constexpr std::size_t n_histogram_lanes = 4;
+
+/// A peak of the z intercept histogram
+struct peak {
+    /// The (central) bin of the peak
+    unsigned int bin;
+    /// The number of pairs in the three bins around the peak
+    unsigned int content;
+};
+
+}  // namespace
+
+vertex_z_finding::vertex_z_finding(const seedfinder_config& finder_config,
+                                   const vertex_z_finder_config& config,
+                                   vecmem::memory_resource& mr)
+    : m_finder_config(finder_config), m_config(config), m_mr(mr) {}
+
+vertex_z_finding::output_type vertex_z_finding::operator()(
+    const spacepoint_collection_types::host& spacepoints) const {
+
+    scratch_type scratch;
+    return find(spacepoints, scratch);
+}
+
+vertex_z_finding::output_type vertex_z_finding::operator()(
+    const compact_spacepoint_collection_types::host& spacepoints) const {
+
+    scratch_type scratch;
+    return find(spacepoints, scratch);
+}
+
+vertex_z_finding::output_type vertex_z_finding::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    scratch_type& scratch) const {
+
+    return find(spacepoints, scratch);
+}
+
+vertex_z_finding::output_type vertex_z_finding::operator()(
+    const compact_spacepoint_collection_types::host& spacepoints,
+    scratch_type& scratch) const {
+
+    return find(spacepoints, scratch);
+}
+
+template <typename spacepoint_collection_t>
+vertex_z_finding::output_type vertex_z_finding::find(
+    const spacepoint_collection_t& spacepoints, scratch_type& scratch) const {
+
+    output_type result(&(m_mr.get()));
+
+    const scalar z_min = m_finder_config.collisionRegionMin;
+    const scalar z_max = m_finder_config.collisionRegionMax;
+    const vector2& beam = m_finder_config.beamPos;
+
+    // Select the spacepoints at small radii.
+    std::vector<scalar>& r = scratch.r;
+    std::vector<scalar>& phi = scratch.phi;
+    std::vector<scalar>& z = scratch.z;
+    r.clear();
+    phi.clear();
+    z.clear();
+    for (const auto& sp : spacepoints) {
+        const scalar x = sp.x() - beam[0];
+        const scalar y = sp.y() - beam[1];
+        const scalar radius = std::sqrt(x * x + y * y);
+        if (radius >= m_config.max_radius) {
+            continue;
+        }
+        r.push_back(radius);
+        phi.push_back(std::atan2(y, x));
+        z.push_back(sp.z());
+    }
+
+    // Order them in phi.
+    std::vector<unsigned int>& order = scratch.order;
+    order.resize(r.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(),
+              [&phi](unsigned int a, unsigned int b) {
+                  return phi[a] < phi[b];
+              });
+
+    // Collect the z intercepts of the pairs that are close in phi. Wrapping
+    // around at phi = +-pi.
+    std::vector<scalar>& intercepts = scratch.intercepts;
+    intercepts.clear();
+    const std::size_t n_sps = order.size();
+    for (std::size_t a = 0; a < n_sps; ++a) {
+        const unsigned int i = order[a];
+        for (std::size_t b = a + 1; b < a + n_sps; ++b) {
+            const unsigned int j = order[b % n_sps];
+            const scalar delta_phi =
+                phi[j] - phi[i] +
+                (b >= n_sps ? static_cast<scalar>(2. * M_PI) : 0.f);
+            if (delta_phi > m_config.max_delta_phi) {
+                break;
+            }
+            const scalar delta_r = r[j] - r[i];
+            if (std::abs(delta_r) < m_config.min_delta_r) {
+                continue;
+            }
+            const scalar z0 = z[i] - r[i] * (z[j] - z[i]) / delta_r;
+            if ((z0 >= z_min) && (z0 < z_max)) {
+                intercepts.push_back(z0);
+            }
+        }
+    }
+
+    // Calculate the histogram bins of the intercepts.
+    const std::size_t n_bins = std::max<std::size_t>(
+        1u, static_cast<std::size_t>(
+                std::ceil((z_max - z_min) / m_config.bin_width)));
+    const scalar inv_bin_width = 1.f / m_config.bin_width;
+    const unsigned int last_bin = static_cast<unsigned int>(n_bins - 1u);
+    std::vector<unsigned int>& bins = scratch.bins;
+    bins.resize(intercepts.size());
+    for (std::size_t k = 0; k < intercepts.size(); ++k) {
+        bins[k] = std::min(last_bin, static_cast<unsigned int>(
+                                         (intercepts[k] - z_min) *
+                                         inv_bin_width));
+    }
+
+    // Fill the histogram, using interleaved copies of it.
+    std::vector<unsigned int>& histogram = scratch.histogram;
+    histogram.assign(n_histogram_lanes * n_bins, 0u);
+    std::size_t k = 0;
+    for (; k + n_histogram_lanes <= bins.size(); k += n_histogram_lanes) {
+        for (std::size_t lane = 0; lane < n_histogram_lanes; ++lane) {
+            ++histogram[lane * n_bins + bins[k + lane]];
+        }
+    }
+    for (; k < bins.size(); ++k) {
+        ++histogram[bins[k]];
+    }
+    for (std::size_t lane = 1; lane < n_histogram_lanes; ++lane) {
+        for (std::size_t bin = 0; bin < n_bins; ++bin) {
+            histogram[bin] += histogram[lane * n_bins + bin];
+        }
+    }
+    histogram.resize(n_bins);
+
+    // Sum up the neighbouring bins, to be robust against vertices falling
+    // on bin boundaries.
+    std::vector<unsigned int>& smoothed = scratch.smoothed;
+    smoothed.resize(n_bins);
+    for (std::size_t bin = 0; bin < n_bins; ++bin) {
+        smoothed[bin] = histogram[bin] +
+                        (bin > 0 ? histogram[bin - 1] : 0u) +
+                        (bin + 1 < n_bins ? histogram[bin + 1] : 0u);
+    }
+
+    // Find the local maxima of the smoothed histogram.
+    std::vector<peak> peaks;
+    for (std::size_t bin = 0; bin < n_bins; ++bin) {
+        const unsigned int content = smoothed[bin];
+        if ((content < m_config.min_pairs) ||
+            ((bin > 0) && (smoothed[bin - 1] > content)) ||
+            ((bin + 1 < n_bins) && (smoothed[bin + 1] >= content))) {
+            continue;
+        }
+        peaks.push_back({static_cast<unsigned int>(bin), content});
+    }
+    std::stable_sort(peaks.begin(), peaks.end(),
+                     [](const peak& a, const peak& b) {
+                         return a.content > b.content;
+                     });
+
+    // Select the highest peaks, which are not within the seeding window of
+    // an already selected one.
+    for (const peak& p : peaks) {
+        if (result.size() >= m_config.max_candidates) {
+            break;
+        }
+
+        // The weighted mean of the three bins around the peak.
+        scalar sum = 0.f;
+        for (unsigned int bin = (p.bin > 0 ? p.bin - 1 : 0u);
+             (bin <= p.bin + 1) && (bin < n_bins); ++bin) {
+            sum += static_cast<scalar>(histogram[bin]) *
+                   (z_min + (static_cast<scalar>(bin) + 0.5f) *
+                                m_config.bin_width);
+        }
+        const scalar z_peak = sum / static_cast<scalar>(p.content);
+
+        const bool overlaps = std::any_of(
+            result.begin(), result.end(), [&](scalar z_other) {
+                return std::abs(z_other - z_peak) < m_config.window_half_width;
+            });
+        if (!overlaps) {
+            result.push_back(z_peak);
+        }
+    }
+
+    return result;
+}
+
+}  // namespace traccc
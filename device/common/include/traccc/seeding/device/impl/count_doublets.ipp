@@ -48,8 +48,9 @@ inline void count_doublets(
     // grid.
     const detray::dindex_range phi_bins =
         sp_grid.axis_p0().range(middle_sp.phi(), config.neighbor_scope);
-    const detray::dindex_range z_bins =
-        sp_grid.axis_p1().range(middle_sp.z(), config.neighbor_scope);
+    const scalar middle_grid_z = config.grid_z(middle_sp.z());
+    const detray::dindex_range z_bins = sp_grid.axis_p1().range(
+        middle_grid_z, config.z_neighbor_scope(middle_grid_z));
     assert(z_bins[0] <= z_bins[1]);
 
     // The number of middle-bottom candidates found for this thread's middle
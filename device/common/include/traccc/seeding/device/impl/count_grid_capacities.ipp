@@ -37,7 +37,8 @@ inline void count_grid_capacities(
         const internal_spacepoint<spacepoint> isp(sp, globalIndex,
                                                   config.beamPos);
         const std::size_t bin_index =
-            phi_axis.bin(isp.phi()) + phi_axis.bins() * z_axis.bin(isp.z());
+            phi_axis.bin(isp.phi()) +
+            phi_axis.bins() * z_axis.bin(config.grid_z(isp.z()));
 
         // Increase the capacity of the grid bin.
         vecmem::device_vector<unsigned int> grid_capacities(
@@ -73,6 +73,11 @@ inline void find_triplets(
                                        config.sigmaScattering *
                                        config.sigmaScattering;
 
+    // Quantities of the middle-bottom doublet used in the pre-selection of
+    // the middle-top doublets
+    const triplet_finding_helper::bottom_terms terms =
+        triplet_finding_helper::make_bottom_terms(spM, lb, scatteringInRegion2);
+
     // These two quantities are used as output parameters in
     // triplet_finding_helper::isCompatible but their values are irrelevant
     scalar curvature, impact_parameter;
@@ -99,6 +104,13 @@ inline void find_triplets(
             doublet_finding_helper::transform_coordinates<
                 details::spacepoint_type::top>(spM, spT);
 
+        // Skip the doublets that surely don't pass the scattering cut,
+        // without paying for a square root
+        if (!triplet_finding_helper::isScatteringCompatible(
+                terms, lt.cotTheta(), lt.Er(), lt.iDeltaR())) {
+            continue;
+        }
+
         // Check if mid-bot and mid-top doublets can form a triplet
         if (triplet_finding_helper::isCompatible(
                 spM, lb, lt, config, iSinTheta2, scatteringInRegion2, curvature,
@@ -38,7 +38,8 @@ inline void populate_grid(
         const internal_spacepoint<spacepoint> isp(sp, globalIndex,
                                                   config.beamPos);
         const std::size_t bin_index =
-            phi_axis.bin(isp.phi()) + phi_axis.bins() * z_axis.bin(isp.z());
+            phi_axis.bin(isp.phi()) +
+            phi_axis.bins() * z_axis.bin(config.grid_z(isp.z()));
 
         // Add the spacepoint to the grid.
         grid.bin(bin_index).push_back(std::move(isp));
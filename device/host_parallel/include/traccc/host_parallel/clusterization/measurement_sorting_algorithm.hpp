@@ -0,0 +1,59 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc::host_parallel {
+
+/// Algorithm sorting the reconstructed measurements in their container
+///
+/// The track finding algorithm expects measurements belonging to a single
+/// detector module to be consecutive in memory. But
+/// @c traccc::host_parallel::clusterization_algorithm does not produce the
+/// measurements in such an ordered state.
+///
+class measurement_sorting_algorithm
+    : public algorithm<measurement_collection_types::view(
+          const measurement_collection_types::view&)> {
+
+    public:
+    /// Constructor for the algorithm
+    ///
+    /// @param copy The copy object to use in the algorithm
+    /// @param pool The thread pool to perform the sorting with
+    ///
+    measurement_sorting_algorithm(vecmem::copy& copy, thread_pool& pool);
+
+    /// Callable operator performing the sorting on a container
+    ///
+    /// @param measurements The measurements to sort
+    ///
+    output_type operator()(const measurement_collection_types::view&
+                               measurements_view) const override;
+
+    private:
+    /// Copy object to use in the algorithm
+    std::reference_wrapper<vecmem::copy> m_copy;
+    /// Thread pool used by the algorithm
+    std::reference_wrapper<thread_pool> m_pool;
+
+};  // class measurement_sorting_algorithm
+
+}  // namespace traccc::host_parallel
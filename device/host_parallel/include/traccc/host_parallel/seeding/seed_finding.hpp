@@ -0,0 +1,69 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+
+// Project include(s).
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc::host_parallel {
+
+/// Seed finding executed with the device kernels on the CPU
+class seed_finding : public algorithm<seed_collection_types::buffer(
+                         const spacepoint_collection_types::const_view&,
+                         const sp_grid_const_view&)> {
+
+    public:
+    /// Constructor for the seed finding
+    ///
+    /// @param config is seed finder configuration parameters
+    /// @param filter_config is seed filter configuration parameters
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for setting up buffers
+    /// @param pool The thread pool to execute the kernels with
+    ///
+    seed_finding(const seedfinder_config& config,
+                 const seedfilter_config& filter_config,
+                 const traccc::memory_resource& mr, vecmem::copy& copy,
+                 thread_pool& pool);
+
+    /// Callable operator for the seed finding
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @return                     a vector buffer of seeds
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_grid_const_view& g2_view) const override;
+
+    private:
+    seedfinder_config m_seedfinder_config;
+    seedfilter_config m_seedfilter_config;
+    traccc::memory_resource m_mr;
+
+    /// The copy object to use
+    std::reference_wrapper<vecmem::copy> m_copy;
+    /// The thread pool to use
+    std::reference_wrapper<thread_pool> m_pool;
+};
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,75 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+
+// Project include(s)
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <array>
+#include <functional>
+
+namespace traccc::host_parallel {
+
+/// Track parameter estimation executed with the device kernels on the CPU
+struct track_params_estimation
+    : public algorithm<bound_track_parameters_collection_types::buffer(
+          const spacepoint_collection_types::const_view&,
+          const seed_collection_types::const_view&, const vector3&,
+          const std::array<traccc::scalar, traccc::e_bound_size>&)> {
+
+    public:
+    /// Constructor for track_params_estimation
+    ///
+    /// @param mr is the memory resource
+    /// @param copy The copy object to use for setting up buffers
+    /// @param pool The thread pool to execute the kernels with
+    track_params_estimation(const traccc::memory_resource& mr,
+                            vecmem::copy& copy, thread_pool& pool);
+
+    /// Callable operator for track_params_estimation
+    ///
+    /// @param spacepoints All spacepoints of the event
+    /// @param seeds The reconstructed track seeds of the event
+    /// @param bfield (Temporary) Magnetic field vector
+    /// @param stddev standard deviation for setting the covariance (Default
+    /// value from arXiv:2112.09470v1)
+    /// @return A vector of bound track parameters
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const seed_collection_types::const_view& seeds_view,
+        const vector3& bfield,
+        const std::array<traccc::scalar, traccc::e_bound_size>& = {
+            0.02f * detray::unit<traccc::scalar>::mm,
+            0.03f * detray::unit<traccc::scalar>::mm,
+            1.f * detray::unit<traccc::scalar>::degree,
+            1.f * detray::unit<traccc::scalar>::degree,
+            0.01f / detray::unit<traccc::scalar>::GeV,
+            1.f * detray::unit<traccc::scalar>::ns}) const override;
+
+    private:
+    /// Memory resource used by the algorithm
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    std::reference_wrapper<vecmem::copy> m_copy;
+    /// The thread pool to use
+    std::reference_wrapper<thread_pool> m_pool;
+};
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,41 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::host_parallel {
+
+// Forward declaration(s).
+namespace details {
+class worker_group;
+}
+
+/// Block-wide barrier for device kernels executed on the CPU
+///
+/// Implements @c traccc::device::concepts::barrier on top of the worker
+/// group running the block. Every synchronisation point counts the threads
+/// that arrived with a true predicate, and returns that count to all of them.
+/// Threads that already returned from the kernel do not take part in the
+/// synchronisation, also not in the @c blockAnd decision.
+///
+struct barrier {
+
+    explicit barrier(details::worker_group& group) : m_group(group) {}
+
+    void blockBarrier();
+
+    bool blockAnd(bool predicate);
+
+    bool blockOr(bool predicate);
+
+    unsigned int blockCount(bool predicate);
+
+    private:
+    details::worker_group& m_group;
+};
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,52 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::host_parallel {
+
+/// Thread identifier of a (logical) thread running a device kernel on the CPU
+///
+/// Implements @c traccc::device::concepts::thread_id1 for one-dimensional
+/// "grids" of "blocks" executed by @c traccc::host_parallel::thread_pool.
+///
+struct thread_id1 {
+
+    /// Constructor with all the coordinates of the thread
+    constexpr thread_id1(unsigned int local_id, unsigned int block_id,
+                         unsigned int block_dim, unsigned int grid_dim)
+        : m_local_id(local_id),
+          m_block_id(block_id),
+          m_block_dim(block_dim),
+          m_grid_dim(grid_dim) {}
+
+    constexpr unsigned int getLocalThreadId() const { return m_local_id; }
+
+    constexpr unsigned int getLocalThreadIdX() const { return m_local_id; }
+
+    constexpr unsigned int getGlobalThreadId() const {
+        return m_local_id + m_block_id * m_block_dim;
+    }
+
+    constexpr unsigned int getGlobalThreadIdX() const {
+        return m_local_id + m_block_id * m_block_dim;
+    }
+
+    constexpr unsigned int getBlockIdX() const { return m_block_id; }
+
+    constexpr unsigned int getBlockDimX() const { return m_block_dim; }
+
+    constexpr unsigned int getGridDimX() const { return m_grid_dim; }
+
+    private:
+    unsigned int m_local_id;
+    unsigned int m_block_id;
+    unsigned int m_block_dim;
+    unsigned int m_grid_dim;
+};
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,129 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/host_parallel/utils/barrier.hpp"
+#include "traccc/host_parallel/utils/thread_id.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace traccc::host_parallel {
+
+// Forward declaration(s).
+namespace details {
+struct thread_pool_data;
+}
+
+/// Thread pool executing the device kernels of traccc on the CPU
+///
+/// "Flat" kernels, which only need a global thread index, are executed on a
+/// work-stealing (TBB) task arena. Cooperative kernels, which synchronise the
+/// threads of a block with a @c traccc::host_parallel::barrier, are executed
+/// by groups of dedicated worker threads, with one OS thread for every
+/// (logical) thread of a block. Each group executes one block at a time,
+/// picking up the next unprocessed block when it's done with the previous
+/// one.
+///
+/// Cooperative launches may be made concurrently from multiple threads. Each
+/// launch uses its own worker groups, which are kept around for later
+/// launches with the same block size once it finished.
+///
+/// This plays the role that @c traccc::cuda::stream plays for the CUDA
+/// algorithms. All launches are synchronous.
+///
+class thread_pool {
+
+    public:
+    /// Type of the "flat" kernels, processing a range of global indices
+    using range_kernel_type = std::function<void(std::size_t, std::size_t)>;
+    /// Type of the cooperative kernels
+    ///
+    /// The last argument is the index of the worker group executing the
+    /// block, which kernels can use to access "shared memory" allocated for
+    /// each group. It is smaller than @c n_groups(block_size).
+    ///
+    using block_kernel_type =
+        std::function<void(const thread_id1&, barrier&, unsigned int)>;
+
+    /// Construct a pool with a given number of threads
+    ///
+    /// @param n_threads The number of threads to use (0 means all available
+    ///                  hardware threads)
+    ///
+    explicit thread_pool(std::size_t n_threads = 0u);
+
+    /// Destructor
+    ~thread_pool();
+
+    /// The number of threads used by the pool
+    std::size_t concurrency() const;
+
+    /// Execute a "flat" kernel for a number of (logical) threads
+    ///
+    /// @param n_threads The number of global thread indices to process
+    /// @param kernel    Functor called with every global thread index
+    ///
+    template <typename kernel_t>
+    void launch(std::size_t n_threads, const kernel_t& kernel) const {
+        launch_range(n_threads,
+                     [&kernel](std::size_t begin, std::size_t end) {
+                         for (std::size_t i = begin; i < end; ++i) {
+                             kernel(i);
+                         }
+                     });
+    }
+
+    /// Execute a "flat" kernel on ranges of global thread indices
+    ///
+    /// Useful for kernels needing scratch memory, which can then be set up
+    /// once per range.
+    ///
+    /// @param n_threads The number of global thread indices to process
+    /// @param kernel    Functor called with the [begin, end) ranges
+    ///
+    void launch_range(std::size_t n_threads,
+                      const range_kernel_type& kernel) const;
+
+    /// The number of worker groups used for cooperative kernels
+    ///
+    /// Every group executes one block at a time, so this is the number of
+    /// blocks executed concurrently by a single launch. There are as many
+    /// groups as the concurrency of the pool allows for with the given block
+    /// size, but at least one.
+    ///
+    /// @param block_size The number of threads per block
+    ///
+    unsigned int n_groups(unsigned int block_size) const;
+
+    /// Execute a cooperative kernel
+    ///
+    /// @param n_blocks   The number of blocks to execute
+    /// @param block_size The number of threads per block
+    /// @param kernel     Functor executed by every thread of every block
+    ///
+    void launch_cooperative(unsigned int n_blocks, unsigned int block_size,
+                            const block_kernel_type& kernel) const;
+
+    /// Execute a function inside of the pool's task arena
+    ///
+    /// Allows using TBB's parallel algorithms (sorting, scanning, etc.) with
+    /// the threads of the pool.
+    ///
+    void execute(const std::function<void()>& func) const;
+
+    private:
+    /// The internal data of the pool
+    std::unique_ptr<details::thread_pool_data> m_data;
+
+};  // class thread_pool
+
+}  // namespace traccc::host_parallel
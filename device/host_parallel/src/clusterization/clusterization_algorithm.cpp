@@ -0,0 +1,121 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/host_parallel/clusterization/clusterization_algorithm.hpp"
+
+// Project include(s)
+#include "traccc/clusterization/device/ccl_kernel.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace traccc::host_parallel {
+namespace {
+
+/// "Shared memory" of the CCL kernel, allocated once per worker group
+struct ccl_shared_memory {
+    std::size_t partition_start = 0u;
+    std::size_t partition_end = 0u;
+    std::size_t outi = 0u;
+    std::vector<device::details::index_t> f;
+    std::vector<device::details::index_t> gf;
+};
+
+}  // namespace
+
+clusterization_algorithm::clusterization_algorithm(
+    const traccc::memory_resource& mr, vecmem::copy& copy, thread_pool& pool,
+    const config_type& config)
+    : m_mr(mr),
+      m_copy(copy),
+      m_pool(pool),
+      m_config(config),
+      m_f_backup(m_config.backup_size(), m_mr.main),
+      m_gf_backup(m_config.backup_size(), m_mr.main),
+      m_backup_mutex(vecmem::make_unique_alloc<unsigned int>(m_mr.main)),
+      m_adjc_backup(m_config.backup_size(), m_mr.main),
+      m_adjv_backup(m_config.backup_size() * 8, m_mr.main) {
+
+    m_copy.get().setup(m_f_backup)->wait();
+    m_copy.get().setup(m_gf_backup)->wait();
+    m_copy.get().setup(m_adjc_backup)->wait();
+    m_copy.get().setup(m_adjv_backup)->wait();
+    *m_backup_mutex = 0u;
+}
+
+clusterization_algorithm::output_type clusterization_algorithm::operator()(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    // Get the number of cells
+    const cell_collection_types::view::size_type num_cells =
+        m_copy.get().get_size(cells);
+
+    // Create the result object, overestimating the number of measurements.
+    measurement_collection_types::buffer measurements{
+        num_cells, m_mr.main, vecmem::data::buffer_type::resizable};
+    m_copy.get().setup(measurements)->ignore();
+
+    // If there are no cells, return right away.
+    if (num_cells == 0) {
+        return measurements;
+    }
+
+    // Create buffer for linking cells to their measurements.
+    vecmem::data::vector_buffer<unsigned int> cell_links(num_cells, m_mr.main);
+    m_copy.get().setup(cell_links)->ignore();
+
+    // Each block handles a partition of cells.
+    const unsigned int num_blocks = static_cast<unsigned int>(
+        (num_cells + (m_config.target_partition_size()) - 1) /
+        m_config.target_partition_size());
+
+    // Ensure that the chosen maximum cell count is compatible with the maximum
+    // stack size.
+    assert(m_config.max_cells_per_thread <=
+           device::details::CELLS_PER_THREAD_STACK_LIMIT);
+
+    // Set up the "shared memory" of the worker groups.
+    std::vector<ccl_shared_memory> shared(
+        m_pool.get().n_groups(m_config.threads_per_partition));
+    for (ccl_shared_memory& s : shared) {
+        s.f.resize(m_config.max_partition_size());
+        s.gf.resize(m_config.max_partition_size());
+    }
+
+    using vector_size_t =
+        vecmem::data::vector_view<device::details::index_t>::size_type;
+    const measurement_collection_types::view measurements_view = measurements;
+    const vecmem::data::vector_view<unsigned int> cell_links_view = cell_links;
+
+    // Run the ccl kernel.
+    m_pool.get().launch_cooperative(
+        num_blocks, m_config.threads_per_partition,
+        [&](const thread_id1& thread_id, barrier& bar, unsigned int group) {
+            ccl_shared_memory& s = shared[group];
+            vecmem::data::vector_view<device::details::index_t> f_view{
+                static_cast<vector_size_t>(s.f.size()), s.f.data()};
+            vecmem::data::vector_view<device::details::index_t> gf_view{
+                static_cast<vector_size_t>(s.gf.size()), s.gf.data()};
+            vecmem::device_atomic_ref<unsigned int> backup_mutex(
+                *m_backup_mutex);
+
+            device::ccl_kernel(m_config, thread_id, cells, modules,
+                               s.partition_start, s.partition_end, s.outi,
+                               f_view, gf_view, m_f_backup, m_gf_backup,
+                               m_adjc_backup, m_adjv_backup, backup_mutex, bar,
+                               measurements_view, cell_links_view);
+        });
+
+    // Return the reconstructed measurements.
+    return measurements;
+}
+
+}  // namespace traccc::host_parallel
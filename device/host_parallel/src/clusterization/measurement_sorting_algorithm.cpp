@@ -0,0 +1,40 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/host_parallel/clusterization/measurement_sorting_algorithm.hpp"
+
+// TBB include(s).
+#include <tbb/parallel_sort.h>
+
+namespace traccc::host_parallel {
+
+measurement_sorting_algorithm::measurement_sorting_algorithm(
+    vecmem::copy& copy, thread_pool& pool)
+    : m_copy{copy}, m_pool{pool} {}
+
+measurement_sorting_algorithm::output_type
+measurement_sorting_algorithm::operator()(
+    const measurement_collection_types::view& measurements_view) const {
+
+    // Get the number of measurements. This is necessary because the input
+    // container may not be fixed sized.
+    const measurement_collection_types::view::size_type n_measurements =
+        m_copy.get().get_size(measurements_view);
+
+    // Sort the measurements in place
+    m_pool.get().execute([&]() {
+        tbb::parallel_sort(measurements_view.ptr(),
+                           measurements_view.ptr() + n_measurements,
+                           measurement_sort_comp());
+    });
+
+    // Return the view of the sorted measurements.
+    return measurements_view;
+}
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,50 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/host_parallel/clusterization/spacepoint_formation_algorithm.hpp"
+
+// Project include(s)
+#include "traccc/clusterization/device/form_spacepoints.hpp"
+
+namespace traccc::host_parallel {
+
+spacepoint_formation_algorithm::spacepoint_formation_algorithm(
+    const traccc::memory_resource& mr, vecmem::copy& copy, thread_pool& pool)
+    : m_mr(mr), m_copy(copy), m_pool(pool) {}
+
+spacepoint_formation_algorithm::output_type
+spacepoint_formation_algorithm::operator()(
+    const measurement_collection_types::const_view& measurements_view,
+    const cell_module_collection_types::const_view& modules_view) const {
+
+    // Get the number of measurements.
+    const measurement_collection_types::const_view::size_type num_measurements =
+        m_copy.get().get_size(measurements_view);
+
+    // Create the result buffer.
+    spacepoint_collection_types::buffer spacepoints(num_measurements,
+                                                    m_mr.main);
+    m_copy.get().setup(spacepoints)->ignore();
+
+    // If there are no measurements, we can conclude here.
+    if (num_measurements == 0) {
+        return spacepoints;
+    }
+
+    // Run the spacepoint formation kernel.
+    const spacepoint_collection_types::view spacepoints_view = spacepoints;
+    m_pool.get().launch(num_measurements, [&](std::size_t globalIndex) {
+        device::form_spacepoints(globalIndex, measurements_view, modules_view,
+                                 num_measurements, spacepoints_view);
+    });
+
+    // Return the reconstructed spacepoints.
+    return spacepoints;
+}
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,443 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/host_parallel/finding/finding_algorithm.hpp"
+
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/device/finding_global_counter.hpp"
+#include "traccc/finding/candidate_link.hpp"
+#include "traccc/finding/device/add_links_for_holes.hpp"
+#include "traccc/finding/device/apply_interaction.hpp"
+#include "traccc/finding/device/build_tracks.hpp"
+#include "traccc/finding/device/count_measurements.hpp"
+#include "traccc/finding/device/find_tracks.hpp"
+#include "traccc/finding/device/make_barcode_sequence.hpp"
+#include "traccc/finding/device/propagate_to_next_surface.hpp"
+#include "traccc/finding/device/prune_tracks.hpp"
+
+// detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/core/detector_metadata.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/jagged_device_vector.hpp>
+#include <vecmem/memory/unique_ptr.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <vector>
+
+namespace traccc::host_parallel {
+
+template <typename stepper_t, typename navigator_t>
+finding_algorithm<stepper_t, navigator_t>::finding_algorithm(
+    const config_type& cfg, const traccc::memory_resource& mr,
+    vecmem::copy& copy, thread_pool& pool)
+    : m_cfg(cfg), m_mr(mr), m_copy(copy), m_pool(pool) {}
+
+template <typename stepper_t, typename navigator_t>
+track_candidate_container_types::buffer
+finding_algorithm<stepper_t, navigator_t>::operator()(
+    const typename detector_type::view_type& det_view,
+    const bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename navigator_t::intersection_type>& navigation_buffer,
+    const typename measurement_collection_types::view& measurements,
+    const bound_track_parameters_collection_types::buffer& seeds_buffer) const {
+
+    // Convenience variables.
+    vecmem::copy& copy = m_copy.get();
+    const thread_pool& pool = m_pool.get();
+
+    const unsigned int n_seeds = copy.get_size(seeds_buffer);
+
+    // Prepare input parameters with seeds
+    bound_track_parameters_collection_types::buffer in_params_buffer(n_seeds,
+                                                                     m_mr.main);
+    copy.setup(in_params_buffer)->ignore();
+    copy(seeds_buffer, in_params_buffer)->ignore();
+
+    // Number of tracks per seed
+    vecmem::data::vector_buffer<unsigned int> n_tracks_per_seed_buffer(
+        n_seeds, m_mr.main);
+    copy.setup(n_tracks_per_seed_buffer)->ignore();
+
+    // Create a map for links
+    std::map<unsigned int, vecmem::data::vector_buffer<candidate_link>>
+        link_map;
+
+    // Create a map for parameter ID to link ID
+    std::map<unsigned int, vecmem::data::vector_buffer<unsigned int>>
+        param_to_link_map;
+
+    // Create a map for tip links
+    std::map<unsigned int, vecmem::data::vector_buffer<
+                               typename candidate_link::link_index_type>>
+        tips_map;
+
+    // Link size
+    std::vector<std::size_t> n_candidates_per_step;
+    n_candidates_per_step.reserve(m_cfg.max_track_candidates_per_track);
+
+    std::vector<std::size_t> n_parameters_per_step;
+    n_parameters_per_step.reserve(m_cfg.max_track_candidates_per_track);
+
+    // Global counter object. The memory resource of the algorithm must be
+    // host accessible, so it can be read directly between the kernels.
+    vecmem::unique_alloc_ptr<device::finding_global_counter> global_counter =
+        vecmem::make_unique_alloc<device::finding_global_counter>(m_mr.main);
+    *global_counter = {0u, 0u, 0u, 0u};
+
+    /*****************************************************************
+     * Measurement Operations
+     *****************************************************************/
+
+    measurement_collection_types::const_view::size_type n_measurements =
+        copy.get_size(measurements);
+
+    // Get copy of barcode uniques
+    measurement_collection_types::buffer uniques_buffer{n_measurements,
+                                                        m_mr.main};
+    copy.setup(uniques_buffer)->ignore();
+    measurement_collection_types::device uniques(uniques_buffer);
+
+    measurement* end = std::unique_copy(
+        measurements.ptr(), measurements.ptr() + n_measurements,
+        uniques.begin(), measurement_equal_comp());
+    const unsigned int n_modules =
+        static_cast<unsigned int>(end - uniques.begin());
+
+    // Get upper bounds of unique elements
+    vecmem::data::vector_buffer<unsigned int> upper_bounds_buffer{n_modules,
+                                                                  m_mr.main};
+    copy.setup(upper_bounds_buffer)->ignore();
+    vecmem::device_vector<unsigned int> upper_bounds(upper_bounds_buffer);
+
+    pool.launch(n_modules, [&](std::size_t i) {
+        upper_bounds[static_cast<unsigned int>(i)] =
+            static_cast<unsigned int>(
+                std::upper_bound(measurements.ptr(),
+                                 measurements.ptr() + n_measurements,
+                                 uniques[static_cast<unsigned int>(i)],
+                                 measurement_sort_comp()) -
+                measurements.ptr());
+    });
+
+    /*****************************************************************
+     * Kernel1: Create barcode sequence
+     *****************************************************************/
+
+    vecmem::data::vector_buffer<detray::geometry::barcode> barcodes_buffer{
+        n_modules, m_mr.main};
+    copy.setup(barcodes_buffer)->ignore();
+    const vecmem::data::vector_view<detray::geometry::barcode> barcodes_view =
+        barcodes_buffer;
+
+    pool.launch(n_modules, [&](std::size_t globalIndex) {
+        device::make_barcode_sequence(globalIndex, uniques_buffer,
+                                      barcodes_view);
+    });
+
+    for (unsigned int step = 0; step < m_cfg.max_track_candidates_per_track;
+         step++) {
+
+        // Previous step
+        const unsigned int prev_step = (step == 0 ? 0 : step - 1);
+
+        // Reset the number of tracks per seed
+        copy.memset(n_tracks_per_seed_buffer, 0)->ignore();
+
+        // Set the number of input parameters
+        const unsigned int n_in_params = (step == 0)
+                                             ? in_params_buffer.size()
+                                             : global_counter->n_out_params;
+
+        // Terminate if there is no parameter to process.
+        if (n_in_params == 0) {
+            break;
+        }
+
+        // Reset the global counter
+        *global_counter = {0u, 0u, 0u, 0u};
+
+        /*****************************************************************
+         * Kernel2: Apply material interaction
+         ****************************************************************/
+
+        const bound_track_parameters_collection_types::view in_params_view =
+            in_params_buffer;
+        pool.launch(n_in_params, [&](std::size_t globalIndex) {
+            device::apply_interaction<detector_type>(
+                globalIndex, det_view, static_cast<int>(n_in_params),
+                in_params_view);
+        });
+
+        /*****************************************************************
+         * Kernel3: Count the number of measurements per parameter
+         ****************************************************************/
+
+        vecmem::data::vector_buffer<unsigned int> n_measurements_buffer(
+            n_in_params, m_mr.main);
+        copy.setup(n_measurements_buffer)->ignore();
+        copy.memset(n_measurements_buffer, 0)->ignore();
+        vecmem::device_vector<unsigned int> n_measurements_device(
+            n_measurements_buffer);
+
+        // Create a buffer for the first measurement index of parameter
+        vecmem::data::vector_buffer<unsigned int> ref_meas_idx_buffer(
+            n_in_params, m_mr.main);
+        copy.setup(ref_meas_idx_buffer)->ignore();
+
+        pool.launch(n_in_params, [&](std::size_t globalIndex) {
+            device::count_measurements(
+                globalIndex, in_params_buffer, barcodes_buffer,
+                upper_bounds_buffer, n_in_params, n_measurements_buffer,
+                ref_meas_idx_buffer, global_counter->n_measurements_sum);
+        });
+
+        // Create the buffer for the prefix sum of the number of measurements
+        // per parameter
+        vecmem::data::vector_buffer<unsigned int>
+            n_measurements_prefix_sum_buffer(n_in_params, m_mr.main);
+        copy.setup(n_measurements_prefix_sum_buffer)->ignore();
+        vecmem::device_vector<unsigned int> n_measurements_prefix_sum(
+            n_measurements_prefix_sum_buffer);
+        std::inclusive_scan(n_measurements_device.begin(),
+                            n_measurements_device.end(),
+                            n_measurements_prefix_sum.begin());
+
+        /*****************************************************************
+         * Kernel4: Find valid tracks
+         *****************************************************************/
+
+        // Buffer for kalman-updated parameters spawned by the measurement
+        // candidates
+        const unsigned int n_max_candidates =
+            n_in_params * m_cfg.max_num_branches_per_surface;
+
+        vecmem::data::vector_buffer<unsigned int> n_candidates_buffer{
+            n_in_params, m_mr.main};
+        copy.setup(n_candidates_buffer)->ignore();
+        copy.memset(n_candidates_buffer, 0)->ignore();
+
+        bound_track_parameters_collection_types::buffer updated_params_buffer(
+            n_in_params * m_cfg.max_num_branches_per_surface, m_mr.main);
+        copy.setup(updated_params_buffer)->ignore();
+
+        // Create the link map
+        link_map[step] = {n_in_params * m_cfg.max_num_branches_per_surface,
+                          m_mr.main};
+        copy.setup(link_map[step])->ignore();
+
+        // Views of the link maps, set up before the (parallel) launches, as
+        // std::map::operator[] may modify the maps.
+        const vecmem::data::vector_view<const candidate_link> prev_links_view =
+            link_map[prev_step];
+        const vecmem::data::vector_view<const unsigned int>
+            prev_param_to_link_view = param_to_link_map[prev_step];
+        const vecmem::data::vector_view<candidate_link> links_view =
+            link_map[step];
+
+        // Every (logical) thread processes n_measurements_per_thread
+        // measurements.
+        const unsigned int n_find_threads =
+            (global_counter->n_measurements_sum +
+             m_cfg.n_measurements_per_thread - 1) /
+            m_cfg.n_measurements_per_thread;
+
+        pool.launch(n_find_threads, [&](std::size_t globalIndex) {
+            device::find_tracks<detector_type, config_type>(
+                globalIndex, m_cfg, det_view, measurements, in_params_buffer,
+                n_measurements_prefix_sum_buffer, ref_meas_idx_buffer,
+                prev_links_view, prev_param_to_link_view, step,
+                n_max_candidates, updated_params_buffer, n_candidates_buffer,
+                links_view, global_counter->n_candidates);
+        });
+
+        /*****************************************************************
+         * Kernel5: Add a dummy links in case of no branches
+         *****************************************************************/
+
+        pool.launch(n_in_params, [&](std::size_t globalIndex) {
+            device::add_links_for_holes(
+                globalIndex, n_candidates_buffer, in_params_buffer,
+                prev_links_view, prev_param_to_link_view, step,
+                n_max_candidates, updated_params_buffer, links_view,
+                global_counter->n_candidates);
+        });
+
+        /*****************************************************************
+         * Kernel6: Propagate to the next surface
+         *****************************************************************/
+
+        const unsigned int n_candidates = global_counter->n_candidates;
+
+        // Buffer for out parameters for the next step
+        bound_track_parameters_collection_types::buffer out_params_buffer(
+            n_candidates, m_mr.main);
+        copy.setup(out_params_buffer)->ignore();
+
+        // Create the param to link ID map
+        param_to_link_map[step] = {n_candidates, m_mr.main};
+        copy.setup(param_to_link_map[step])->ignore();
+
+        // Create the tip map
+        tips_map[step] = {n_candidates, m_mr.main,
+                          vecmem::data::buffer_type::resizable};
+        copy.setup(tips_map[step])->ignore();
+
+        const vecmem::data::vector_view<unsigned int> param_to_link_view =
+            param_to_link_map[step];
+        const vecmem::data::vector_view<
+            typename candidate_link::link_index_type>
+            tips_view = tips_map[step];
+
+        pool.launch(n_candidates, [&](std::size_t globalIndex) {
+            device::propagate_to_next_surface<propagator_type, bfield_type,
+                                              config_type>(
+                globalIndex, m_cfg, det_view, field_view, navigation_buffer,
+                updated_params_buffer, links_view, step,
+                global_counter->n_candidates, out_params_buffer,
+                param_to_link_view, tips_view,
+                n_tracks_per_seed_buffer, global_counter->n_out_params);
+        });
+
+        // Fill the candidate size vector
+        n_candidates_per_step.push_back(global_counter->n_candidates);
+        n_parameters_per_step.push_back(global_counter->n_out_params);
+
+        // Swap parameter buffer for the next step
+        in_params_buffer = std::move(out_params_buffer);
+    }
+
+    // Create link buffer
+    vecmem::data::jagged_vector_buffer<candidate_link> links_buffer(
+        n_candidates_per_step, m_mr.main, m_mr.host);
+    copy.setup(links_buffer)->ignore();
+
+    // Copy link map to link buffer
+    const auto n_steps = n_candidates_per_step.size();
+    for (unsigned int it = 0; it < n_steps; it++) {
+
+        vecmem::device_vector<candidate_link> in(link_map[it]);
+        vecmem::device_vector<candidate_link> out(
+            *(links_buffer.host_ptr() + it));
+
+        std::copy(in.begin(), in.begin() + n_candidates_per_step[it],
+                  out.begin());
+    }
+
+    // Create param_to_link
+    vecmem::data::jagged_vector_buffer<unsigned int> param_to_link_buffer(
+        n_parameters_per_step, m_mr.main, m_mr.host);
+    copy.setup(param_to_link_buffer)->ignore();
+
+    // Copy param_to_link map to param_to_link buffer
+    for (unsigned int it = 0; it < n_steps; it++) {
+
+        vecmem::device_vector<unsigned int> in(param_to_link_map[it]);
+        vecmem::device_vector<unsigned int> out(
+            *(param_to_link_buffer.host_ptr() + it));
+
+        std::copy(in.begin(), in.begin() + n_parameters_per_step[it],
+                  out.begin());
+    }
+
+    // Get the number of tips per step
+    std::vector<unsigned int> n_tips_per_step;
+    n_tips_per_step.reserve(n_steps);
+    for (unsigned int it = 0; it < n_steps; it++) {
+        n_tips_per_step.push_back(copy.get_size(tips_map[it]));
+    }
+
+    // Copy tips_map into the tips vector
+    const unsigned int n_tips_total =
+        std::accumulate(n_tips_per_step.begin(), n_tips_per_step.end(), 0u);
+    vecmem::data::vector_buffer<typename candidate_link::link_index_type>
+        tips_buffer{n_tips_total, m_mr.main};
+    copy.setup(tips_buffer)->ignore();
+
+    vecmem::device_vector<typename candidate_link::link_index_type> tips(
+        tips_buffer);
+
+    unsigned int prefix_sum = 0;
+
+    for (unsigned int it = 0; it < n_steps; it++) {
+        vecmem::device_vector<typename candidate_link::link_index_type> in(
+            tips_map[it]);
+
+        const unsigned int n_tips = n_tips_per_step[it];
+        if (n_tips > 0) {
+            std::copy(in.begin(), in.begin() + n_tips,
+                      tips.begin() + prefix_sum);
+            prefix_sum += n_tips;
+        }
+    }
+
+    /*****************************************************************
+     * Kernel7: Build tracks
+     *****************************************************************/
+
+    // Create track candidate buffer
+    track_candidate_container_types::buffer track_candidates_buffer{
+        {n_tips_total, m_mr.main},
+        {std::vector<std::size_t>(n_tips_total,
+                                  m_cfg.max_track_candidates_per_track),
+         m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable}};
+
+    copy.setup(track_candidates_buffer.headers)->ignore();
+    copy.setup(track_candidates_buffer.items)->ignore();
+
+    // Create buffer for valid indices
+    vecmem::data::vector_buffer<unsigned int> valid_indices_buffer(n_tips_total,
+                                                                   m_mr.main);
+    copy.setup(valid_indices_buffer)->ignore();
+
+    pool.launch(n_tips_total, [&](std::size_t globalIndex) {
+        device::build_tracks(globalIndex, m_cfg, measurements, seeds_buffer,
+                             links_buffer, param_to_link_buffer, tips_buffer,
+                             track_candidates_buffer, valid_indices_buffer,
+                             global_counter->n_valid_tracks);
+    });
+
+    // Create pruned candidate buffer
+    const unsigned int n_valid_tracks = global_counter->n_valid_tracks;
+    track_candidate_container_types::buffer prune_candidates_buffer{
+        {n_valid_tracks, m_mr.main},
+        {std::vector<std::size_t>(n_valid_tracks,
+                                  m_cfg.max_track_candidates_per_track),
+         m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable}};
+
+    copy.setup(prune_candidates_buffer.headers)->ignore();
+    copy.setup(prune_candidates_buffer.items)->ignore();
+
+    pool.launch(n_valid_tracks, [&](std::size_t globalIndex) {
+        device::prune_tracks(globalIndex, track_candidates_buffer,
+                             valid_indices_buffer, prune_candidates_buffer);
+    });
+
+    return prune_candidates_buffer;
+}
+
+// Explicit template instantiation
+using default_detector_type =
+    detray::detector<detray::default_metadata, detray::device_container_types>;
+using default_stepper_type =
+    detray::rk_stepper<covfie::field<detray::bfield::const_bknd_t>::view_t,
+                       traccc::default_algebra, detray::constrained_step<>>;
+using default_navigator_type = detray::navigator<const default_detector_type>;
+template class finding_algorithm<default_stepper_type, default_navigator_type>;
+
+}  // namespace traccc::host_parallel
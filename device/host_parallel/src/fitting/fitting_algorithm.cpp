@@ -0,0 +1,82 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/host_parallel/fitting/fitting_algorithm.hpp"
+
+#include "traccc/fitting/device/fit.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+
+// detray include(s).
+#include "detray/core/detector_metadata.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// System include(s).
+#include <vector>
+
+namespace traccc::host_parallel {
+
+template <typename fitter_t>
+fitting_algorithm<fitter_t>::fitting_algorithm(
+    const config_type& cfg, const traccc::memory_resource& mr,
+    vecmem::copy& copy, thread_pool& pool)
+    : m_cfg(cfg), m_mr(mr), m_copy(copy), m_pool(pool) {}
+
+template <typename fitter_t>
+track_state_container_types::buffer fitting_algorithm<fitter_t>::operator()(
+    const typename fitter_t::detector_type::view_type& det_view,
+    const typename fitter_t::bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename fitter_t::intersection_type>& navigation_buffer,
+    const typename track_candidate_container_types::const_view&
+        track_candidates_view) const {
+
+    // Convenience variable.
+    vecmem::copy& copy = m_copy.get();
+
+    // Number of tracks
+    const track_candidate_container_types::const_device::header_vector::
+        size_type n_tracks = copy.get_size(track_candidates_view.headers);
+
+    // Get the sizes of the track candidates in each track
+    const std::vector<track_candidate_container_types::const_device::
+                          item_vector::value_type::size_type>
+        candidate_sizes = copy.get_sizes(track_candidates_view.items);
+
+    track_state_container_types::buffer track_states_buffer{
+        {n_tracks, m_mr.main},
+        {candidate_sizes, m_mr.main, m_mr.host,
+         vecmem::data::buffer_type::resizable}};
+
+    copy.setup(track_states_buffer.headers)->ignore();
+    copy.setup(track_states_buffer.items)->ignore();
+
+    // Run the track fitting
+    const track_state_container_types::view track_states_view =
+        track_states_buffer;
+    m_pool.get().launch(n_tracks, [&](std::size_t globalIndex) {
+        device::fit<fitter_t>(globalIndex, det_view, field_view, m_cfg,
+                              navigation_buffer, track_candidates_view,
+                              track_states_view);
+    });
+
+    return track_states_buffer;
+}
+
+// Explicit template instantiation
+using default_detector_type =
+    detray::detector<detray::default_metadata, detray::device_container_types>;
+using default_stepper_type =
+    detray::rk_stepper<covfie::field<detray::bfield::const_bknd_t>::view_t,
+                       default_algebra, detray::constrained_step<>>;
+using default_navigator_type = detray::navigator<const default_detector_type>;
+using default_fitter_type =
+    kalman_fitter<default_stepper_type, default_navigator_type>;
+template class fitting_algorithm<default_fitter_type>;
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,205 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/host_parallel/seeding/seed_finding.hpp"
+
+#include "traccc/host_parallel/utils/make_prefix_sum_buff.hpp"
+
+// Project include(s).
+#include "traccc/device/fill_prefix_sum.hpp"
+#include "traccc/edm/device/device_doublet.hpp"
+#include "traccc/edm/device/device_triplet.hpp"
+#include "traccc/edm/device/doublet_counter.hpp"
+#include "traccc/edm/device/seeding_global_counter.hpp"
+#include "traccc/edm/device/triplet_counter.hpp"
+#include "traccc/seeding/device/count_doublets.hpp"
+#include "traccc/seeding/device/count_triplets.hpp"
+#include "traccc/seeding/device/find_doublets.hpp"
+#include "traccc/seeding/device/find_triplets.hpp"
+#include "traccc/seeding/device/reduce_triplet_counts.hpp"
+#include "traccc/seeding/device/select_seeds.hpp"
+#include "traccc/seeding/device/update_triplet_weights.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/unique_ptr.hpp>
+
+// System include(s).
+#include <vector>
+
+namespace traccc::host_parallel {
+
+seed_finding::seed_finding(const seedfinder_config& config,
+                           const seedfilter_config& filter_config,
+                           const traccc::memory_resource& mr,
+                           vecmem::copy& copy, thread_pool& pool)
+    : m_seedfinder_config(config),
+      m_seedfilter_config(filter_config),
+      m_mr(mr),
+      m_copy(copy),
+      m_pool(pool) {}
+
+seed_finding::output_type seed_finding::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_grid_const_view& g2_view) const {
+
+    // Convenience variables.
+    vecmem::copy& copy = m_copy.get();
+    const thread_pool& pool = m_pool.get();
+
+    // Get the sizes from the grid view
+    auto grid_sizes = copy.get_sizes(g2_view._data_view);
+
+    // Create prefix sum buffer
+    vecmem::data::vector_buffer sp_grid_prefix_sum_buff =
+        make_prefix_sum_buff(grid_sizes, copy, m_mr, pool);
+    const vecmem::data::vector_view<const device::prefix_sum_element_t>
+        sp_grid_prefix_sum_view = sp_grid_prefix_sum_buff;
+
+    const auto num_spacepoints = copy.get_size(sp_grid_prefix_sum_buff);
+    if (num_spacepoints == 0) {
+        return {0, m_mr.main};
+    }
+
+    // Set up the doublet counter buffer.
+    device::doublet_counter_collection_types::buffer doublet_counter_buffer = {
+        num_spacepoints, m_mr.main, vecmem::data::buffer_type::resizable};
+    copy.setup(doublet_counter_buffer)->ignore();
+    const device::doublet_counter_collection_types::view doublet_counter_view =
+        doublet_counter_buffer;
+
+    // Counter for the total number of doublets and triplets. The memory
+    // resource of the algorithm must be host accessible, so the counter can
+    // be read directly.
+    vecmem::unique_alloc_ptr<device::seeding_global_counter> globalCounter =
+        vecmem::make_unique_alloc<device::seeding_global_counter>(m_mr.main);
+    *globalCounter = {0u, 0u, 0u};
+
+    // Count the number of doublets that we need to produce.
+    pool.launch(num_spacepoints, [&](std::size_t globalIndex) {
+        device::count_doublets(globalIndex, m_seedfinder_config, g2_view,
+                               sp_grid_prefix_sum_view, doublet_counter_view,
+                               globalCounter->m_nMidBot,
+                               globalCounter->m_nMidTop);
+    });
+
+    if (globalCounter->m_nMidBot == 0 || globalCounter->m_nMidTop == 0) {
+        return {0, m_mr.main};
+    }
+
+    // Set up the doublet buffers.
+    device::device_doublet_collection_types::buffer doublet_buffer_mb = {
+        globalCounter->m_nMidBot, m_mr.main};
+    copy.setup(doublet_buffer_mb)->ignore();
+    device::device_doublet_collection_types::buffer doublet_buffer_mt = {
+        globalCounter->m_nMidTop, m_mr.main};
+    copy.setup(doublet_buffer_mt)->ignore();
+    const device::device_doublet_collection_types::view doublet_view_mb =
+        doublet_buffer_mb;
+    const device::device_doublet_collection_types::view doublet_view_mt =
+        doublet_buffer_mt;
+
+    // Find all of the spacepoint doublets.
+    const unsigned int doublet_counter_buffer_size =
+        copy.get_size(doublet_counter_buffer);
+    pool.launch(doublet_counter_buffer_size, [&](std::size_t globalIndex) {
+        device::find_doublets(globalIndex, m_seedfinder_config, g2_view,
+                              doublet_counter_view, doublet_view_mb,
+                              doublet_view_mt);
+    });
+
+    // Set up the triplet counter buffers
+    device::triplet_counter_spM_collection_types::buffer
+        triplet_counter_spM_buffer = {doublet_counter_buffer_size, m_mr.main};
+    copy.setup(triplet_counter_spM_buffer)->ignore();
+    copy.memset(triplet_counter_spM_buffer, 0)->ignore();
+    device::triplet_counter_collection_types::buffer
+        triplet_counter_midBot_buffer = {globalCounter->m_nMidBot, m_mr.main,
+                                         vecmem::data::buffer_type::resizable};
+    copy.setup(triplet_counter_midBot_buffer)->ignore();
+    const device::triplet_counter_spM_collection_types::view
+        triplet_counter_spM_view = triplet_counter_spM_buffer;
+    const device::triplet_counter_collection_types::view
+        triplet_counter_midBot_view = triplet_counter_midBot_buffer;
+
+    // Count the number of triplets that we need to produce.
+    pool.launch(globalCounter->m_nMidBot, [&](std::size_t globalIndex) {
+        device::count_triplets(globalIndex, m_seedfinder_config, g2_view,
+                               doublet_counter_view, doublet_view_mb,
+                               doublet_view_mt, triplet_counter_spM_view,
+                               triplet_counter_midBot_view);
+    });
+
+    // Reduce the triplet counts per spM.
+    pool.launch(doublet_counter_buffer_size, [&](std::size_t globalIndex) {
+        device::reduce_triplet_counts(globalIndex, doublet_counter_view,
+                                      triplet_counter_spM_view,
+                                      globalCounter->m_nTriplets);
+    });
+
+    if (globalCounter->m_nTriplets == 0) {
+        return {0, m_mr.main};
+    }
+
+    // Set up the triplet buffer.
+    device::device_triplet_collection_types::buffer triplet_buffer = {
+        globalCounter->m_nTriplets, m_mr.main};
+    copy.setup(triplet_buffer)->ignore();
+    const device::device_triplet_collection_types::view triplet_view =
+        triplet_buffer;
+
+    // Find all of the spacepoint triplets.
+    pool.launch(copy.get_size(triplet_counter_midBot_buffer),
+                [&](std::size_t globalIndex) {
+                    device::find_triplets(
+                        globalIndex, m_seedfinder_config, m_seedfilter_config,
+                        g2_view, doublet_counter_view, doublet_view_mt,
+                        triplet_counter_spM_view, triplet_counter_midBot_view,
+                        triplet_view);
+                });
+
+    // Update the weights of all spacepoint triplets. Every (logical) thread
+    // uses compatSeedLimit elements of scratch memory, which is set up once
+    // per range of threads here.
+    pool.launch_range(
+        globalCounter->m_nTriplets, [&](std::size_t begin, std::size_t end) {
+            std::vector<scalar> data(m_seedfilter_config.compatSeedLimit);
+            for (std::size_t globalIndex = begin; globalIndex < end;
+                 ++globalIndex) {
+                device::update_triplet_weights(
+                    globalIndex, m_seedfilter_config, g2_view,
+                    triplet_counter_spM_view, triplet_counter_midBot_view,
+                    data.data(), triplet_view);
+            }
+        });
+
+    // Create result object: collection of seeds
+    seed_collection_types::buffer seed_buffer(
+        globalCounter->m_nTriplets, m_mr.main,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(seed_buffer)->ignore();
+    const seed_collection_types::view seed_view = seed_buffer;
+
+    // Create seeds out of selected triplets. Every (logical) thread uses
+    // max_triplets_per_spM elements of scratch memory.
+    pool.launch_range(
+        doublet_counter_buffer_size, [&](std::size_t begin, std::size_t end) {
+            std::vector<triplet> data(m_seedfilter_config.max_triplets_per_spM);
+            for (std::size_t globalIndex = begin; globalIndex < end;
+                 ++globalIndex) {
+                device::select_seeds(globalIndex, m_seedfilter_config,
+                                     spacepoints_view, g2_view,
+                                     triplet_counter_spM_view,
+                                     triplet_counter_midBot_view, triplet_view,
+                                     data.data(), seed_view);
+            }
+        });
+
+    return seed_buffer;
+}
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,28 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/host_parallel/seeding/seeding_algorithm.hpp"
+
+namespace traccc::host_parallel {
+
+seeding_algorithm::seeding_algorithm(const seedfinder_config& finder_config,
+                                     const spacepoint_grid_config& grid_config,
+                                     const seedfilter_config& filter_config,
+                                     const traccc::memory_resource& mr,
+                                     vecmem::copy& copy, thread_pool& pool)
+    : m_spacepoint_binning(finder_config, grid_config, mr, copy, pool),
+      m_seed_finding(finder_config, filter_config, mr, copy, pool) {}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view) const {
+
+    return m_seed_finding(spacepoints_view,
+                          m_spacepoint_binning(spacepoints_view));
+}
+
+}  // namespace traccc::host_parallel
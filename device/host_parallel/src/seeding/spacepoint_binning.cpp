@@ -0,0 +1,79 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/host_parallel/seeding/spacepoint_binning.hpp"
+
+// Project include(s).
+#include "traccc/seeding/device/count_grid_capacities.hpp"
+#include "traccc/seeding/device/populate_grid.hpp"
+#include "traccc/seeding/spacepoint_binning_helper.hpp"
+
+// System include(s).
+#include <vector>
+
+namespace traccc::host_parallel {
+
+spacepoint_binning::spacepoint_binning(
+    const seedfinder_config& config, const spacepoint_grid_config& grid_config,
+    const traccc::memory_resource& mr, vecmem::copy& copy, thread_pool& pool)
+    : m_config(config),
+      m_axes(get_axes(grid_config, (mr.host ? *(mr.host) : mr.main))),
+      m_mr(mr),
+      m_copy(copy),
+      m_pool(pool) {}
+
+sp_grid_buffer spacepoint_binning::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view) const {
+
+    // Get the spacepoint sizes from the view
+    const auto sp_size = m_copy.get().get_size(spacepoints_view);
+
+    if (sp_size == 0) {
+        return {m_axes.first, m_axes.second, {}, m_mr.main, m_mr.host};
+    }
+
+    // Set up the container that will be filled with the required capacities for
+    // the spacepoint grid.
+    const std::size_t grid_bins = m_axes.first.n_bins * m_axes.second.n_bins;
+    vecmem::data::vector_buffer<unsigned int> grid_capacities_buff(grid_bins,
+                                                                   m_mr.main);
+    m_copy.get().setup(grid_capacities_buff)->ignore();
+    m_copy.get().memset(grid_capacities_buff, 0)->ignore();
+    const vecmem::data::vector_view<unsigned int> grid_capacities_view =
+        grid_capacities_buff;
+
+    // Fill the grid capacity container.
+    m_pool.get().launch(sp_size, [&](std::size_t globalIndex) {
+        device::count_grid_capacities(globalIndex, m_config, m_axes.first,
+                                      m_axes.second, spacepoints_view,
+                                      grid_capacities_view);
+    });
+
+    // Create the grid buffer.
+    vecmem::vector<unsigned int> grid_capacities(m_mr.host ? m_mr.host
+                                                           : &(m_mr.main));
+    m_copy.get()(grid_capacities_buff, grid_capacities)->wait();
+    sp_grid_buffer grid_buffer(
+        m_axes.first, m_axes.second,
+        std::vector<std::size_t>(grid_capacities.begin(),
+                                 grid_capacities.end()),
+        m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable);
+    m_copy.get().setup(grid_buffer._buffer)->ignore();
+
+    // Populate the grid.
+    const sp_grid_view grid_view = grid_buffer;
+    m_pool.get().launch(sp_size, [&](std::size_t globalIndex) {
+        device::populate_grid(static_cast<unsigned int>(globalIndex), m_config,
+                              spacepoints_view, grid_view);
+    });
+
+    // Return the freshly filled buffer.
+    return grid_buffer;
+}
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,49 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/host_parallel/seeding/track_params_estimation.hpp"
+
+// Project include(s).
+#include "traccc/seeding/device/estimate_track_params.hpp"
+
+namespace traccc::host_parallel {
+
+track_params_estimation::track_params_estimation(
+    const traccc::memory_resource& mr, vecmem::copy& copy, thread_pool& pool)
+    : m_mr(mr), m_copy(copy), m_pool(pool) {}
+
+track_params_estimation::output_type track_params_estimation::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const seed_collection_types::const_view& seeds_view, const vector3& bfield,
+    const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
+
+    // Get the size of the seeds view
+    const std::size_t seeds_size = m_copy.get().get_size(seeds_view);
+
+    // Create the buffer for the parameters
+    bound_track_parameters_collection_types::buffer params_buffer(seeds_size,
+                                                                  m_mr.main);
+    m_copy.get().setup(params_buffer)->ignore();
+
+    // Check if anything needs to be done.
+    if (seeds_size == 0) {
+        return params_buffer;
+    }
+
+    // Run the kernel.
+    const bound_track_parameters_collection_types::view params_view =
+        params_buffer;
+    m_pool.get().launch(seeds_size, [&](std::size_t globalIndex) {
+        device::estimate_track_params(globalIndex, spacepoints_view, seeds_view,
+                                      bfield, stddev, params_view);
+    });
+
+    return params_buffer;
+}
+
+}  // namespace traccc::host_parallel
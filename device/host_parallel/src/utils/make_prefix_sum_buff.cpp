@@ -0,0 +1,41 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/host_parallel/utils/make_prefix_sum_buff.hpp"
+
+// Project include(s).
+#include "traccc/device/make_prefix_sum_buffer.hpp"
+
+namespace traccc::host_parallel {
+
+vecmem::data::vector_buffer<device::prefix_sum_element_t> make_prefix_sum_buff(
+    const std::vector<device::prefix_sum_size_t>& sizes, vecmem::copy& copy,
+    const traccc::memory_resource& mr, const thread_pool& pool) {
+
+    const device::prefix_sum_buffer_t make_sum_result =
+        device::make_prefix_sum_buffer(sizes, copy, mr);
+    const vecmem::data::vector_view<const device::prefix_sum_size_t>
+        sizes_sum_view = make_sum_result.view;
+    const unsigned int totalSize = make_sum_result.totalSize;
+
+    // Create buffer and view objects for prefix sum vector
+    vecmem::data::vector_buffer<device::prefix_sum_element_t> prefix_sum_buff(
+        totalSize, mr.main);
+    copy.setup(prefix_sum_buff)->ignore();
+    const vecmem::data::vector_view<device::prefix_sum_element_t>
+        prefix_sum_view = prefix_sum_buff;
+
+    // Fill the prefix sum vector
+    pool.launch(totalSize, [&](std::size_t globalIndex) {
+        device::fill_prefix_sum(globalIndex, sizes_sum_view, prefix_sum_view);
+    });
+
+    return prefix_sum_buff;
+}
+
+}  // namespace traccc::host_parallel
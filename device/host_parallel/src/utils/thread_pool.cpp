@@ -0,0 +1,155 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+
+#include "worker_group.hpp"
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/info.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace traccc::host_parallel::details {
+
+/// Internal data of @c traccc::host_parallel::thread_pool
+struct thread_pool_data {
+
+    explicit thread_pool_data(std::size_t n_threads)
+        : m_concurrency(n_threads > 0u
+                            ? n_threads
+                            : static_cast<std::size_t>(
+                                  tbb::info::default_concurrency())),
+          m_arena(static_cast<int>(m_concurrency)) {}
+
+    /// The number of threads to use
+    std::size_t m_concurrency;
+    /// Work-stealing arena for the "flat" kernels
+    tbb::task_arena m_arena;
+
+    /// Mutex protecting the list of idle worker groups
+    std::mutex m_groups_mutex;
+    /// Worker groups not used by any ongoing cooperative launch
+    std::vector<std::unique_ptr<worker_group>> m_idle_groups;
+
+};  // struct thread_pool_data
+
+}  // namespace traccc::host_parallel::details
+
+namespace traccc::host_parallel {
+
+thread_pool::thread_pool(std::size_t n_threads)
+    : m_data(std::make_unique<details::thread_pool_data>(n_threads)) {}
+
+thread_pool::~thread_pool() = default;
+
+std::size_t thread_pool::concurrency() const {
+
+    return m_data->m_concurrency;
+}
+
+void thread_pool::launch_range(std::size_t n_threads,
+                               const range_kernel_type& kernel) const {
+
+    if (n_threads == 0u) {
+        return;
+    }
+    m_data->m_arena.execute([&]() {
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0u, n_threads),
+                          [&](const tbb::blocked_range<std::size_t>& range) {
+                              kernel(range.begin(), range.end());
+                          });
+    });
+}
+
+unsigned int thread_pool::n_groups(unsigned int block_size) const {
+
+    if (block_size == 0u) {
+        throw std::invalid_argument("Block size must be positive");
+    }
+    return std::max(
+        1u, static_cast<unsigned int>(m_data->m_concurrency / block_size));
+}
+
+void thread_pool::launch_cooperative(unsigned int n_blocks,
+                                     unsigned int block_size,
+                                     const block_kernel_type& kernel) const {
+
+    if (n_blocks == 0u) {
+        return;
+    }
+
+    // Take idle worker groups of the right block size, only holding the lock
+    // while looking them up.
+    const unsigned int n_launch_groups =
+        std::min(n_groups(block_size), n_blocks);
+    std::vector<std::unique_ptr<details::worker_group>> groups;
+    groups.reserve(n_launch_groups);
+    {
+        std::lock_guard lock(m_data->m_groups_mutex);
+        auto& idle = m_data->m_idle_groups;
+        for (auto it = idle.begin();
+             (it != idle.end()) && (groups.size() < n_launch_groups);) {
+            if ((*it)->size() == block_size) {
+                groups.push_back(std::move(*it));
+                it = idle.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    // Create the missing ones.
+    while (groups.size() < n_launch_groups) {
+        groups.push_back(std::make_unique<details::worker_group>(block_size));
+    }
+
+    // Execute the blocks.
+    std::atomic<unsigned int> next_block{0u};
+    for (unsigned int i = 0; i < n_launch_groups; ++i) {
+        groups[i]->start(kernel, next_block, n_blocks, i);
+    }
+    std::exception_ptr exception;
+    for (auto& group : groups) {
+        try {
+            group->wait();
+        } catch (...) {
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    // Give the groups back to the pool.
+    {
+        std::lock_guard lock(m_data->m_groups_mutex);
+        for (auto& group : groups) {
+            m_data->m_idle_groups.push_back(std::move(group));
+        }
+    }
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void thread_pool::execute(const std::function<void()>& func) const {
+
+    m_data->m_arena.execute(func);
+}
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,179 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "worker_group.hpp"
+
+#include "traccc/host_parallel/utils/barrier.hpp"
+
+// System include(s).
+#include <stdexcept>
+
+namespace traccc::host_parallel::details {
+
+worker_group::worker_group(unsigned int block_size)
+    : m_block_size(block_size),
+      m_group_barrier(static_cast<std::ptrdiff_t>(block_size)) {
+
+    if (block_size == 0u) {
+        throw std::invalid_argument("Block size must be positive");
+    }
+
+    m_threads.reserve(block_size);
+    try {
+        for (unsigned int i = 0; i < block_size; ++i) {
+            m_threads.emplace_back([this, i]() { work(i); });
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+}
+
+worker_group::~worker_group() {
+
+    stop();
+}
+
+void worker_group::start(const thread_pool::block_kernel_type& kernel,
+                         std::atomic<unsigned int>& next_block,
+                         unsigned int n_blocks, unsigned int group) {
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_kernel = &kernel;
+        m_next_block = &next_block;
+        m_n_blocks = n_blocks;
+        m_group = group;
+        m_exception = nullptr;
+        m_n_finished = 0u;
+        ++m_generation;
+    }
+    m_start.notify_all();
+}
+
+void worker_group::wait() {
+
+    std::unique_lock lock(m_mutex);
+    m_finish.wait(lock, [this]() { return m_n_finished == m_block_size; });
+    if (m_exception) {
+        std::exception_ptr exception = m_exception;
+        m_exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+worker_group::sync_result worker_group::synchronize(bool predicate) {
+
+    if (predicate) {
+        m_count.fetch_add(1u, std::memory_order_relaxed);
+    }
+    m_arrived.fetch_add(1u, std::memory_order_relaxed);
+    m_block_barrier->arrive_and_wait();
+    return m_result;
+}
+
+void worker_group::work(unsigned int local_id) {
+
+    std::size_t generation = 0u;
+
+    while (true) {
+
+        // Wait for a new job.
+        {
+            std::unique_lock lock(m_mutex);
+            m_start.wait(lock, [this, generation]() {
+                return m_stop || (m_generation != generation);
+            });
+            if (m_stop) {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        // Execute blocks until there are none left. The first thread picks
+        // the block and sets up its barrier, and the group barrier makes
+        // them visible to all the others.
+        while (true) {
+            if (local_id == 0u) {
+                m_block = m_next_block->fetch_add(1u);
+                if (m_block < m_n_blocks) {
+                    m_block_barrier.emplace(
+                        static_cast<std::ptrdiff_t>(m_block_size),
+                        completion{this});
+                }
+            }
+            m_group_barrier.arrive_and_wait();
+            const unsigned int block = m_block;
+            if (block >= m_n_blocks) {
+                break;
+            }
+            try {
+                barrier bar(*this);
+                (*m_kernel)(
+                    thread_id1{local_id, block, m_block_size, m_n_blocks},
+                    bar, m_group);
+            } catch (...) {
+                std::lock_guard lock(m_mutex);
+                if (!m_exception) {
+                    m_exception = std::current_exception();
+                }
+            }
+            // Let the rest of the block synchronise without this thread.
+            m_block_barrier->arrive_and_drop();
+            m_group_barrier.arrive_and_wait();
+        }
+
+        // Signal that this thread is done.
+        {
+            std::lock_guard lock(m_mutex);
+            ++m_n_finished;
+        }
+        m_finish.notify_all();
+    }
+}
+
+void worker_group::stop() {
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (std::thread& t : m_threads) {
+        t.join();
+    }
+    m_threads.clear();
+}
+
+}  // namespace traccc::host_parallel::details
+
+namespace traccc::host_parallel {
+
+void barrier::blockBarrier() {
+
+    m_group.synchronize(false);
+}
+
+bool barrier::blockAnd(bool predicate) {
+
+    const details::worker_group::sync_result result =
+        m_group.synchronize(predicate);
+    return result.count == result.participants;
+}
+
+bool barrier::blockOr(bool predicate) {
+
+    return m_group.synchronize(predicate).count > 0u;
+}
+
+unsigned int barrier::blockCount(bool predicate) {
+
+    return m_group.synchronize(predicate).count;
+}
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,153 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+
+// System include(s).
+#include <atomic>
+#include <barrier>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace traccc::host_parallel::details {
+
+/// Group of OS threads executing the blocks of cooperative kernels
+///
+/// Every (logical) thread of a block is executed by its own thread of the
+/// group, and the block-wide barriers of the kernels are real thread
+/// barriers. So the kernels run with the same concurrency as on a device,
+/// and the thread and address sanitizers can follow them.
+///
+/// The threads of a block that return from the kernel early drop out of the
+/// block's barrier, so the remaining threads can still synchronise with
+/// each other.
+///
+class worker_group {
+
+    public:
+    /// Result of a block-wide synchronisation
+    struct sync_result {
+        /// The number of threads that arrived with a true predicate
+        unsigned int count = 0u;
+        /// The number of threads that took part in the synchronisation
+        unsigned int participants = 0u;
+    };
+
+    /// Start the threads of the group
+    ///
+    /// @param block_size The number of threads per block
+    ///
+    explicit worker_group(unsigned int block_size);
+
+    /// Stop the threads of the group
+    ~worker_group();
+
+    /// The object is neither copyable, nor movable
+    worker_group(const worker_group&) = delete;
+    /// The object is neither copyable, nor movable
+    worker_group& operator=(const worker_group&) = delete;
+
+    /// The number of threads per block
+    unsigned int size() const { return m_block_size; }
+
+    /// Start executing the blocks of a cooperative kernel
+    ///
+    /// The group keeps picking up blocks until @c next_block reaches
+    /// @c n_blocks. Which may be shared between multiple groups.
+    ///
+    /// @param kernel     The kernel to execute
+    /// @param next_block The index of the next block to be picked up
+    /// @param n_blocks   The total number of blocks of the launch
+    /// @param group      The index of the group in the launch
+    ///
+    void start(const thread_pool::block_kernel_type& kernel,
+               std::atomic<unsigned int>& next_block, unsigned int n_blocks,
+               unsigned int group);
+
+    /// Wait for the group to run out of blocks to execute
+    ///
+    /// @throws The first exception thrown by the kernel, if any
+    ///
+    void wait();
+
+    /// Synchronise all (unfinished) threads of the current block
+    ///
+    /// @param predicate The predicate of the calling thread
+    /// @return The predicate count and the number of participating threads
+    ///
+    sync_result synchronize(bool predicate);
+
+    private:
+    /// Function executed by every thread of the group
+    void work(unsigned int local_id);
+    /// Stop the threads of the group, and wait for them to exit
+    void stop();
+
+    /// Completion function of the block barrier
+    struct completion {
+        worker_group* m_group;
+        void operator()() noexcept {
+            m_group->m_result = {
+                m_group->m_count.exchange(0u, std::memory_order_relaxed),
+                m_group->m_arrived.exchange(0u, std::memory_order_relaxed)};
+        }
+    };
+
+    /// The number of threads in the group
+    unsigned int m_block_size;
+
+    /// Mutex protecting the job (control) variables
+    std::mutex m_mutex;
+    /// Condition for starting a new job
+    std::condition_variable m_start;
+    /// Condition for finishing a job
+    std::condition_variable m_finish;
+    /// Counter of the jobs started
+    std::size_t m_generation = 0u;
+    /// The number of threads that finished the current job
+    unsigned int m_n_finished = 0u;
+    /// Flag for stopping the threads
+    bool m_stop = false;
+
+    /// The kernel being executed
+    const thread_pool::block_kernel_type* m_kernel = nullptr;
+    /// The index of the next block to be picked up
+    std::atomic<unsigned int>* m_next_block = nullptr;
+    /// The total number of blocks of the launch
+    unsigned int m_n_blocks = 0u;
+    /// The index of the group in the launch
+    unsigned int m_group = 0u;
+    /// The first exception thrown by the kernel
+    std::exception_ptr m_exception;
+
+    /// The block currently being executed by the group
+    unsigned int m_block = 0u;
+    /// Barrier synchronising all threads of the group between blocks
+    std::barrier<> m_group_barrier;
+    /// Barrier used by the kernel, set up anew for every block
+    std::optional<std::barrier<completion>> m_block_barrier;
+    /// Predicate count of the ongoing synchronisation
+    std::atomic<unsigned int> m_count{0u};
+    /// Number of threads arrived at the ongoing synchronisation
+    std::atomic<unsigned int> m_arrived{0u};
+    /// Result of the last synchronisation
+    sync_result m_result;
+
+    /// The threads of the group
+    std::vector<std::thread> m_threads;
+
+};  // class worker_group
+
+}  // namespace traccc::host_parallel::details
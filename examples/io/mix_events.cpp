@@ -0,0 +1,128 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/demonstrator_edm.hpp"
+#include "traccc/io/event_mixer.hpp"
+#include "traccc/io/read.hpp"
+#include "traccc/io/write.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/event_mixing.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/output_data.hpp"
+#include "traccc/options/program_options.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+int mix_events(const traccc::opts::detector& detector_opts,
+               const traccc::opts::input_data& input_opts,
+               const traccc::opts::output_data& output_opts,
+               const traccc::opts::event_mixing& mixing_opts) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the library events into memory, once.
+    traccc::demonstrator_input library(&host_mr);
+    for (std::size_t i = 0; i < input_opts.events; ++i) {
+        library.push_back(traccc::demonstrator_input::value_type(&host_mr));
+    }
+    traccc::io::read(
+        library, input_opts.events, input_opts.directory,
+        detector_opts.detector_file, detector_opts.digitization_file,
+        input_opts.format,
+        (detector_opts.use_detray_detector ? traccc::data_format::json
+                                           : traccc::data_format::csv));
+
+    // Overlaying the same library event more than once in a mixed event would
+    // put identical particles into it (vertex z smearing can not be applied
+    // to digitised cells), so make sure that the library is large enough.
+    if (mixing_opts.pileup > library.size()) {
+        throw std::invalid_argument{
+            "The pileup (" + std::to_string(mixing_opts.pileup) +
+            ") is larger than the number of library events (" +
+            std::to_string(library.size()) + ")"};
+    }
+
+    // Set up the mixing.
+    const traccc::io::event_mixer mixer(library);
+    traccc::io::event_mixer::generator_type generator(mixing_opts.seed);
+    std::poisson_distribution<std::size_t> poisson(
+        static_cast<double>(mixing_opts.pileup));
+
+    // Create the mixed events.
+    traccc::io::cell_reader_output mixed(&host_mr);
+    std::size_t n_library_cells = 0, n_mixed_cells = 0, n_reusing_events = 0;
+    for (std::size_t event = 0; event < mixing_opts.mixed_events; ++event) {
+
+        // Choose the library events to overlay.
+        const std::size_t n_overlaid =
+            (mixing_opts.poisson_pileup ? poisson(generator)
+                                        : mixing_opts.pileup);
+        if (n_overlaid > library.size()) {
+            ++n_reusing_events;
+        }
+        const auto chosen = mixer.choose(n_overlaid, generator);
+        for (std::size_t i : chosen) {
+            n_library_cells += library[i].cells.size();
+        }
+
+        // Overlay them, and write out the result in binary format.
+        mixer(mixed, chosen);
+        n_mixed_cells += mixed.cells.size();
+        traccc::io::write(event, output_opts.directory,
+                          traccc::data_format::binary,
+                          vecmem::get_data(mixed.cells),
+                          vecmem::get_data(mixed.modules));
+    }
+
+    // Print some statistics.
+    std::cout << "==> Statistics ... " << std::endl;
+    std::cout << "- read    " << input_opts.events << " library events"
+              << std::endl;
+    std::cout << "- created " << mixing_opts.mixed_events << " mixed events"
+              << std::endl;
+    std::cout << "- merged  " << n_library_cells << " library cells into "
+              << n_mixed_cells << " mixed cells" << std::endl;
+    if (n_reusing_events > 0) {
+        std::cout << "WARNING: " << n_reusing_events
+                  << " mixed event(s) overlaid some library event(s) more "
+                     "than once, because of Poisson fluctuations above the "
+                     "library size"
+                  << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::detector detector_opts;
+    traccc::opts::input_data input_opts;
+    traccc::opts::output_data output_opts;
+    traccc::opts::event_mixing mixing_opts;
+    traccc::opts::program_options program_opts{
+        "Pileup Event Mixing",
+        {detector_opts, input_opts, output_opts, mixing_opts},
+        argc,
+        argv};
+
+    // Run the application.
+    return mix_events(detector_opts, input_opts, output_opts, mixing_opts);
+}
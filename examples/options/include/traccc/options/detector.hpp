@@ -28,6 +28,8 @@ class detector : public interface {
     std::string material_file;
     /// The file containing the surface grid description
     std::string grid_file;
+    /// The file containing the magnetic field map
+    std::string bfield_file;
     /// Use detray::detector for the geometry handling
     bool use_detray_detector = false;
 
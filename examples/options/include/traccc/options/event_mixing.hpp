@@ -0,0 +1,55 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/options/details/interface.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::opts {
+
+/// Options for overlaying library events into (high pileup) mixed events
+class event_mixing : public interface {
+
+    public:
+    /// @name Options
+    /// @{
+
+    /// The number of mixed events to create
+    std::size_t mixed_events = 10;
+    /// The (mean) number of library events to overlay per mixed event
+    ///
+    /// It must not be larger than the number of library events, as the same
+    /// event can not be overlaid more than once without vertex smearing.
+    ///
+    std::size_t pileup = 10;
+    /// Draw the number of overlaid events from a Poisson distribution
+    bool poisson_pileup = false;
+    /// Seed for the random choice of the library events
+    unsigned long seed = 42;
+
+    /// @}
+
+    /// Constructor
+    event_mixing();
+
+    /// Read/process the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm) override;
+
+    private:
+    /// Print the specific options of this class
+    std::ostream& print_impl(std::ostream& out) const override;
+
+};  // class event_mixing
+
+}  // namespace traccc::opts
@@ -0,0 +1,52 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/options/details/interface.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <string>
+
+namespace traccc::opts {
+
+/// Command line options used to configure the per-stage profiling
+class profiling : public interface {
+
+    public:
+    /// @name Options
+    /// @{
+
+    /// Whether to record per-stage profiling information
+    bool run = false;
+    /// File to write a Chrome trace / Perfetto (JSON) file to
+    std::string trace_file;
+    /// Number of profiling records to keep per thread
+    std::size_t buffer_size = 1u << 16;
+    /// Whether to sample hardware performance counters for every stage
+    bool hardware_counters = false;
+
+    /// @}
+
+    /// Constructor
+    profiling();
+
+    /// Read/process the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm) override;
+
+    private:
+    /// Print the specific options of this class
+    std::ostream& print_impl(std::ostream& out) const override;
+
+};  // class profiling
+
+}  // namespace traccc::opts
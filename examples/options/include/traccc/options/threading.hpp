@@ -12,6 +12,7 @@
 
 // System include(s).
 #include <cstddef>
+#include <vector>
 
 namespace traccc::opts {
 
@@ -24,12 +25,22 @@ class threading : public interface {
 
     /// The number of threads to use for the data processing
     std::size_t threads = 1;
+    /// The thread counts to measure in a thread-count sweep (if not empty)
+    std::vector<std::size_t> thread_sweep;
+    /// Pin the threads (and their memory) to the NUMA nodes of the host
+    bool numa_pinning = false;
 
     /// @}
 
     /// Constructor
     threading();
 
+    /// The thread counts to run the data processing with
+    ///
+    /// @return @c thread_sweep if it was set, or just @c threads otherwise
+    ///
+    std::vector<std::size_t> thread_counts() const;
+
     /// Read/process the command line options
     ///
     /// @param vm The command line options to interpret/read
@@ -13,6 +13,7 @@
 // System include(s).
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace traccc::opts {
 
@@ -28,15 +29,40 @@ class throughput : public interface {
     /// The number of events to run "cold", i.e. run without accounting for
     /// them in the performance measurements
     std::size_t cold_run_events = 10;
+    /// The number of times to repeat the measurement of the processed events
+    std::size_t repetitions = 1;
+
+    /// The way to pick the events to process ("random", "sequential",
+    /// "shuffled" or "list")
+    std::string event_sampling = "random";
+    /// Seed for the (random) event sampling
+    unsigned int sampling_seed = 42u;
+    /// The events to process, in the "list" sampling mode
+    std::vector<std::size_t> event_list;
+    /// The number of events to process in one task
+    std::size_t batch_size = 1;
+
+    /// Use a per-thread arena allocator, reset after every event
+    bool arena_allocator = false;
+    /// The size of the arena memory blocks, in MiB
+    std::size_t arena_block_size = 16;
 
     /// Output log file
     std::string log_file;
+    /// Output (JSON) report file
+    std::string report_file;
 
     /// @}
 
     /// Constructor
     throughput();
 
+    /// Read/process the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm) override;
+
     private:
     /// Print the specific options of this class
     std::ostream& print_impl(std::ostream& out) const override;
@@ -13,6 +13,7 @@
 
 // System include(s).
 #include <iosfwd>
+#include <vector>
 
 namespace traccc::opts {
 
@@ -27,12 +28,34 @@ class track_seeding : public interface {
     traccc::seedfinder_config seedfinder;
     /// Configuration for the seed filtering
     traccc::seedfilter_config seedfilter;
+    /// Configuration for the primary vertex z pre-finding
+    traccc::vertex_z_finder_config vertexfinder;
+    /// Use the layer links of the detector in the doublet finding
+    bool layer_links = false;
+    /// Estimate the track parameters of the seeds in (vectorised) batches
+    bool batched_params_estimation = false;
 
     /// @}
 
     /// Constructor
     track_seeding();
 
+    /// Read/process the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm) override;
+
+    private:
+    /// Edges of variable width z bins, as given on the command line
+    std::vector<scalar> m_z_bin_edges;
+    /// Neighbour scopes of the variable width z bins, as given on the
+    /// command line
+    std::vector<unsigned int> m_z_bin_neighbors;
+
+    /// Print the specific options of this class
+    std::ostream& print_impl(std::ostream& out) const override;
+
 };  // struct track_seeding
 
 }  // namespace traccc::opts
@@ -28,6 +28,10 @@ detector::detector() : interface("Detector Options") {
     m_desc.add_options()("grid-file",
                          po::value(&grid_file)->default_value(grid_file),
                          "Surface grid file");
+    m_desc.add_options()(
+        "bfield-file", po::value(&bfield_file)->default_value(bfield_file),
+        "Magnetic field map file (covfie format), used instead of a constant "
+        "field in the track finding and fitting, where supported");
     m_desc.add_options()("use-detray-detector",
                          po::bool_switch(&use_detray_detector),
                          "Use detray::detector for the geometry handling");
@@ -42,6 +46,7 @@ std::ostream& detector::print_impl(std::ostream& out) const {
     out << "  Detector file       : " << detector_file << "\n"
         << "  Material file       : " << material_file << "\n"
         << "  Surface grid file   : " << grid_file << "\n"
+        << "  B field file        : " << bfield_file << "\n"
         << "  Use detray::detector: " << (use_detray_detector ? "yes" : "no")
         << "\n"
         << "  Digitization file   : " << digitization_file;
@@ -0,0 +1,52 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/options/event_mixing.hpp"
+
+// System include(s).
+#include <iostream>
+#include <stdexcept>
+
+namespace traccc::opts {
+
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+event_mixing::event_mixing() : interface("Event Mixing Options") {
+
+    m_desc.add_options()(
+        "mixed-events", po::value(&mixed_events)->default_value(mixed_events),
+        "Number of mixed events to create");
+    m_desc.add_options()("pileup", po::value(&pileup)->default_value(pileup),
+                         "(Mean) number of library events to overlay per "
+                         "mixed event, at most the number of input events");
+    m_desc.add_options()("poisson-pileup", po::bool_switch(&poisson_pileup),
+                         "Draw the number of overlaid events from a Poisson "
+                         "distribution");
+    m_desc.add_options()("mixing-seed",
+                         po::value(&seed)->default_value(seed),
+                         "Seed for the choice of the library events");
+}
+
+void event_mixing::read(const po::variables_map&) {
+
+    if (pileup == 0) {
+        throw std::invalid_argument{"Must use pileup>0"};
+    }
+}
+
+std::ostream& event_mixing::print_impl(std::ostream& out) const {
+
+    out << "  Mixed event(s) : " << mixed_events << "\n"
+        << "  Pileup         : " << pileup << "\n"
+        << "  Poisson pileup : " << (poisson_pileup ? "yes" : "no") << "\n"
+        << "  Mixing seed    : " << seed;
+    return out;
+}
+
+}  // namespace traccc::opts
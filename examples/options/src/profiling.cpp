@@ -0,0 +1,58 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/options/profiling.hpp"
+
+// System include(s).
+#include <iostream>
+#include <stdexcept>
+
+namespace traccc::opts {
+
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+profiling::profiling() : interface("Profiling Options") {
+
+    m_desc.add_options()("profile", po::bool_switch(&run),
+                         "Record per-stage profiling information");
+    m_desc.add_options()(
+        "profile-trace-file", po::value(&trace_file),
+        "Chrome trace / Perfetto (JSON) file to write the profile into "
+        "(suffixed with the thread count in thread sweeps)");
+    m_desc.add_options()(
+        "profile-buffer-size",
+        po::value(&buffer_size)->default_value(buffer_size),
+        "Number of profiling records to keep per thread");
+    m_desc.add_options()(
+        "profile-hw-counters", po::bool_switch(&hardware_counters),
+        "Sample hardware performance counters (cycles, instructions, cache "
+        "and branch misses) for every profiled stage");
+}
+
+void profiling::read(const po::variables_map&) {
+
+    // Writing a trace file or sampling counters implies profiling.
+    if ((trace_file.empty() == false) || hardware_counters) {
+        run = true;
+    }
+    if (buffer_size == 0) {
+        throw std::invalid_argument{"Must use profile-buffer-size>0"};
+    }
+}
+
+std::ostream& profiling::print_impl(std::ostream& out) const {
+
+    out << "  Record profile     : " << (run ? "yes" : "no") << "\n"
+        << "  Trace file         : " << trace_file << "\n"
+        << "  Records per thread : " << buffer_size << "\n"
+        << "  Hardware counters  : " << (hardware_counters ? "yes" : "no");
+    return out;
+}
+
+}  // namespace traccc::opts
@@ -20,6 +20,15 @@ threading::threading() : interface("Multi-Threading Options") {
         "cpu-threads",
         boost::program_options::value(&threads)->default_value(threads),
         "The number of CPU threads to use");
+    m_desc.add_options()(
+        "cpu-threads-sweep",
+        boost::program_options::value(&thread_sweep)->multitoken(),
+        "The numbers of CPU threads to measure the throughput with");
+    m_desc.add_options()(
+        "cpu-numa-pinning",
+        boost::program_options::bool_switch(&numa_pinning),
+        "Distribute the CPU threads over the NUMA nodes of the host, pinning "
+        "them to their node");
 }
 
 void threading::read(const boost::program_options::variables_map&) {
@@ -27,11 +36,31 @@ void threading::read(const boost::program_options::variables_map&) {
     if (threads == 0) {
         throw std::invalid_argument{"Must use threads>0"};
     }
+    for (std::size_t n : thread_sweep) {
+        if (n == 0) {
+            throw std::invalid_argument{"Must use threads>0 in the sweep"};
+        }
+    }
+}
+
+std::vector<std::size_t> threading::thread_counts() const {
+
+    if (thread_sweep.empty()) {
+        return {threads};
+    }
+    return thread_sweep;
 }
 
 std::ostream& threading::print_impl(std::ostream& out) const {
 
     out << "  CPU threads: " << threads;
+    if (!thread_sweep.empty()) {
+        out << "\n  CPU thread sweep:";
+        for (std::size_t n : thread_sweep) {
+            out << " " << n;
+        }
+    }
+    out << "\n  NUMA pinning: " << (numa_pinning ? "yes" : "no");
     return out;
 }
 
@@ -8,8 +8,12 @@
 // Library include(s).
 #include "traccc/options/throughput.hpp"
 
+// Performance include(s).
+#include "traccc/performance/event_schedule.hpp"
+
 // System include(s).
 #include <iostream>
+#include <stdexcept>
 
 namespace traccc::opts {
 
@@ -26,16 +30,79 @@ throughput::throughput() : interface("Throughput Measurement Options") {
         "cold-run-events",
         po::value(&cold_run_events)->default_value(cold_run_events),
         "Number of events to run 'cold'");
+    m_desc.add_options()(
+        "repetitions", po::value(&repetitions)->default_value(repetitions),
+        "Number of times to repeat the measurement");
+    m_desc.add_options()(
+        "event-sampling",
+        po::value(&event_sampling)->default_value(event_sampling),
+        "How to pick the events to process (random, sequential, shuffled or "
+        "list)");
+    m_desc.add_options()(
+        "sampling-seed",
+        po::value(&sampling_seed)->default_value(sampling_seed),
+        "Seed for the event sampling");
+    m_desc.add_options()("event-list",
+                         po::value(&event_list)->multitoken(),
+                         "The events to process with --event-sampling=list");
+    m_desc.add_options()(
+        "batch-size", po::value(&batch_size)->default_value(batch_size),
+        "Number of events to process in one (multi-threaded) task");
+    m_desc.add_options()("arena-allocator", po::bool_switch(&arena_allocator),
+                         "Use an arena allocator for the host memory, reset "
+                         "after every event");
+    m_desc.add_options()(
+        "arena-block-size",
+        po::value(&arena_block_size)->default_value(arena_block_size),
+        "Size of the arena allocator's memory blocks in MiB");
     m_desc.add_options()(
         "log-file", po::value(&log_file),
         "File where result logs will be printed (in append mode).");
+    m_desc.add_options()(
+        "report-file", po::value(&report_file),
+        "File where a machine-readable (JSON) report will be written");
+}
+
+void throughput::read(const po::variables_map&) {
+
+    if (repetitions == 0) {
+        throw std::invalid_argument{"Must use repetitions>0"};
+    }
+    if (arena_block_size == 0) {
+        throw std::invalid_argument{"Must use arena-block-size>0"};
+    }
+    if (batch_size == 0) {
+        throw std::invalid_argument{"Must use batch-size>0"};
+    }
+    const performance::event_sampling sampling =
+        performance::event_sampling_from_string(event_sampling);
+    if ((sampling == performance::event_sampling::list) &&
+        event_list.empty()) {
+        throw std::invalid_argument{
+            "Must provide --event-list with --event-sampling=list"};
+    }
 }
 
 std::ostream& throughput::print_impl(std::ostream& out) const {
 
     out << "  Cold run event(s) : " << cold_run_events << "\n"
         << "  Processed event(s): " << processed_events << "\n"
-        << "  Log file          : " << log_file;
+        << "  Repetitions       : " << repetitions << "\n"
+        << "  Event sampling    : " << event_sampling << "\n"
+        << "  Sampling seed     : " << sampling_seed << "\n";
+    if (event_list.empty() == false) {
+        out << "  Event list        :";
+        for (std::size_t event : event_list) {
+            out << " " << event;
+        }
+        out << "\n";
+    }
+    out << "  Batch size        : " << batch_size << "\n"
+        << "  Arena allocator   : " << (arena_allocator ? "yes" : "no")
+        << "\n"
+        << "  Arena block size  : " << arena_block_size << " MiB\n"
+        << "  Log file          : " << log_file << "\n"
+        << "  Report file       : " << report_file;
     return out;
 }
 
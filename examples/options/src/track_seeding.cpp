@@ -8,8 +8,129 @@
 // Local include(s).
 #include "traccc/options/track_seeding.hpp"
 
+// System include(s).
+#include <iostream>
+#include <stdexcept>
+
 namespace traccc::opts {
 
-track_seeding::track_seeding() : interface("Track Seeding Options") {}
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+track_seeding::track_seeding() : interface("Track Seeding Options") {
+
+    m_desc.add_options()(
+        "phi-bin-deflection-coverage",
+        po::value(&seedfinder.phiBinDeflectionCoverage)
+            ->default_value(seedfinder.phiBinDeflectionCoverage),
+        "Number of phi bins covering the deflection of a minimum pT track");
+    m_desc.add_options()("neighbor-scope-low",
+                         po::value(&seedfinder.neighbor_scope[0])
+                             ->default_value(seedfinder.neighbor_scope[0]),
+                         "Number of lower neighbour bins used in the seeding");
+    m_desc.add_options()("neighbor-scope-high",
+                         po::value(&seedfinder.neighbor_scope[1])
+                             ->default_value(seedfinder.neighbor_scope[1]),
+                         "Number of upper neighbour bins used in the seeding");
+    m_desc.add_options()(
+        "z-bin-size",
+        po::value(&seedfinder.zBinSize)->default_value(seedfinder.zBinSize),
+        "Width of the z bins of the seeding grid, derived from cotThetaMax * "
+        "deltaRMax if not positive [mm]");
+    m_desc.add_options()("z-bin-edges",
+                         po::value(&m_z_bin_edges)->multitoken(),
+                         "Edges of variable width z bins of the seeding grid, "
+                         "in increasing order [mm]");
+    m_desc.add_options()(
+        "z-bin-neighbors", po::value(&m_z_bin_neighbors)->multitoken(),
+        "Lower and upper neighbour scopes along z for every variable width z "
+        "bin");
+    m_desc.add_options()(
+        "vertex-z-prefinding",
+        po::bool_switch(&vertexfinder.enable),
+        "Narrow down the collision region of the seeding around pre-found "
+        "primary vertex z candidates");
+    m_desc.add_options()("vertex-z-candidates",
+                         po::value(&vertexfinder.max_candidates)
+                             ->default_value(vertexfinder.max_candidates),
+                         "Maximum number of primary vertex z candidates");
+    m_desc.add_options()(
+        "vertex-z-window",
+        po::value(&vertexfinder.window_half_width)
+            ->default_value(vertexfinder.window_half_width),
+        "Half width of the collision region around each vertex candidate [mm]");
+    m_desc.add_options()(
+        "layer-links", po::bool_switch(&layer_links),
+        "Only pair up spacepoints on layers that the detector geometry allows "
+        "to form doublets");
+    m_desc.add_options()(
+        "batched-params-estimation",
+        po::bool_switch(&batched_params_estimation),
+        "Estimate the track parameters of the seeds in vectorised batches");
+}
+
+void track_seeding::read(const po::variables_map&) {
+
+    // Set up the variable width z bins.
+    if (m_z_bin_edges.size() > seedfinder_config::max_z_bin_edges) {
+        throw std::invalid_argument{"Too many z bin edges"};
+    }
+    for (std::size_t i = 0; i < m_z_bin_edges.size(); ++i) {
+        if ((i > 0) && (m_z_bin_edges[i] <= m_z_bin_edges[i - 1])) {
+            throw std::invalid_argument{"Z bin edges must be increasing"};
+        }
+        seedfinder.zBinEdges[i] = m_z_bin_edges[i];
+    }
+    seedfinder.nZBinEdges = static_cast<unsigned int>(m_z_bin_edges.size());
+
+    // Set up the neighbour scopes of the variable width z bins.
+    if (m_z_bin_neighbors.empty()) {
+        return;
+    }
+    if ((m_z_bin_edges.size() < 2) ||
+        (m_z_bin_neighbors.size() != 2 * (m_z_bin_edges.size() - 1))) {
+        throw std::invalid_argument{
+            "Two z bin neighbour scopes are needed for every z bin"};
+    }
+    for (std::size_t i = 0; i + 1 < m_z_bin_edges.size(); ++i) {
+        seedfinder.zBinNeighbors[i] = {m_z_bin_neighbors[2 * i],
+                                       m_z_bin_neighbors[2 * i + 1]};
+    }
+    seedfinder.useZBinNeighbors = true;
+}
+
+std::ostream& track_seeding::print_impl(std::ostream& out) const {
+
+    out << "  Phi bin coverage         : "
+        << seedfinder.phiBinDeflectionCoverage
+        << "\n  Neighbor scope           : [" << seedfinder.neighbor_scope[0]
+        << ", " << seedfinder.neighbor_scope[1] << "]"
+        << "\n  Z bin size               : " << seedfinder.zBinSize << " [mm]";
+    if (seedfinder.nZBinEdges >= 2) {
+        out << "\n  Z bin edges              :";
+        for (unsigned int i = 0; i < seedfinder.nZBinEdges; ++i) {
+            out << " " << seedfinder.zBinEdges[i];
+        }
+        out << " [mm]";
+    }
+    if (seedfinder.useZBinNeighbors) {
+        out << "\n  Z bin neighbors          :";
+        for (unsigned int i = 0; i + 1 < seedfinder.nZBinEdges; ++i) {
+            out << " [" << seedfinder.zBinNeighbors[i][0] << ", "
+                << seedfinder.zBinNeighbors[i][1] << "]";
+        }
+    }
+    out << "\n  Vertex z pre-finding     : "
+        << (vertexfinder.enable ? "yes" : "no");
+    if (vertexfinder.enable) {
+        out << "\n  Vertex z candidates      : " << vertexfinder.max_candidates
+            << "\n  Vertex z window          : "
+            << vertexfinder.window_half_width << " [mm]";
+    }
+    out << "\n  Layer links              : " << (layer_links ? "yes" : "no");
+    out << "\n  Batched params estimation: "
+        << (batched_params_estimation ? "yes" : "no");
+    return out;
+}
 
 }  // namespace traccc::opts
@@ -11,6 +11,7 @@
 #include "traccc/options/clusterization.hpp"
 #include "traccc/options/detector.hpp"
 #include "traccc/options/input_data.hpp"
+#include "traccc/options/profiling.hpp"
 #include "traccc/options/program_options.hpp"
 #include "traccc/options/threading.hpp"
 #include "traccc/options/throughput.hpp"
@@ -22,13 +23,23 @@
 #include "traccc/io/demonstrator_edm.hpp"
 #include "traccc/io/read.hpp"
 #include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_magnetic_field.hpp"
 #include "traccc/io/utils.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/arena_memory_resource.hpp"
+#include "traccc/performance/counting_memory_resource.hpp"
+#include "traccc/performance/event_schedule.hpp"
+#include "traccc/performance/profiler.hpp"
+#include "traccc/performance/profiling_summary.hpp"
 #include "traccc/performance/throughput.hpp"
+#include "traccc/performance/throughput_report.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
 
+// Project include(s).
+#include "traccc/utils/field_map.hpp"
+
 // Detray include(s).
 #include "detray/core/detector.hpp"
 #include "detray/io/frontend/detector_reader.hpp"
@@ -38,16 +49,22 @@
 
 // TBB include(s).
 #include <tbb/global_control.h>
+#include <tbb/info.h>
 #include <tbb/task_arena.h>
 #include <tbb/task_group.h>
 
 // System include(s).
+#include <algorithm>
 #include <atomic>
-#include <cstdlib>
-#include <ctime>
+#include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace traccc {
@@ -64,24 +81,19 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
     opts::track_finding finding_opts;
     opts::track_propagation propagation_opts;
     opts::throughput throughput_opts;
+    opts::profiling profiling_opts;
     opts::threading threading_opts;
     opts::program_options program_opts{
         description,
         {detector_opts, input_opts, clusterization_opts, seeding_opts,
-         finding_opts, propagation_opts, throughput_opts, threading_opts},
+         finding_opts, propagation_opts, throughput_opts, profiling_opts,
+         threading_opts},
         argc,
         argv};
 
     // Set up the timing info holder.
     performance::timing_info times;
 
-    // Set up the TBB arena and thread group.
-    tbb::global_control global_thread_limit(
-        tbb::global_control::max_allowed_parallelism,
-        threading_opts.threads + 1);
-    tbb::task_arena arena{static_cast<int>(threading_opts.threads), 0};
-    tbb::task_group group;
-
     // Memory resource to use in the test.
     HOST_MR uncached_host_mr;
 
@@ -113,6 +125,46 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
         detector = std::move(det.first);
     }
 
+    // Read in the magnetic field map, if one was specified.
+    constexpr bool supports_field_map =
+        requires(FULL_CHAIN_ALG& alg, std::shared_ptr<const field_map> f) {
+            alg.set_field(f);
+        };
+    std::shared_ptr<const field_map> field;
+    if (detector_opts.bfield_file.empty() == false) {
+        if (!supports_field_map) {
+            throw std::invalid_argument{
+                "This chain does not support --bfield-file"};
+        }
+        field = std::make_shared<const field_map>(
+            io::read_magnetic_field(detector_opts.bfield_file));
+    }
+
+    // Check that the batched track parameter estimation can be used, if it
+    // was asked for.
+    constexpr bool supports_batched_params = requires(FULL_CHAIN_ALG& alg) {
+        alg.set_batched_params_estimation(true);
+    };
+    if (seeding_opts.batched_params_estimation && !supports_batched_params) {
+        throw std::invalid_argument{
+            "This chain does not support --batched-params-estimation"};
+    }
+
+    // Check the same for the primary vertex z pre-finding.
+    constexpr bool supports_vertex_z_finding =
+        requires(FULL_CHAIN_ALG& alg, const vertex_z_finder_config& c) {
+            alg.set_vertex_z_finder_config(c);
+        };
+    if (seeding_opts.vertexfinder.enable && !supports_vertex_z_finding) {
+        throw std::invalid_argument{
+            "This chain does not support --vertex-z-prefinding"};
+    }
+
+    // Check whether the chain executes its kernels on an (injected) thread
+    // pool.
+    constexpr bool uses_thread_pool =
+        requires { typename FULL_CHAIN_ALG::thread_pool_type; };
+
     // Read in all input events into memory.
     demonstrator_input input(&uncached_host_mr);
 
@@ -131,11 +183,6 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
                                                : traccc::data_format::csv));
     }
 
-    // Set up cached memory resources on top of the host memory resource
-    // separately for each CPU thread.
-    std::vector<std::unique_ptr<vecmem::binary_page_memory_resource> >
-        cached_host_mrs{threading_opts.threads + 1};
-
     typename FULL_CHAIN_ALG::clustering_algorithm::config_type clustering_cfg(
         clusterization_opts);
 
@@ -148,121 +195,393 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
     typename FULL_CHAIN_ALG::fitting_algorithm::config_type fitting_cfg;
     fitting_cfg.propagation = propagation_config;
 
-    // Set up the full-chain algorithm(s). One for each thread.
-    std::vector<FULL_CHAIN_ALG> algs;
-    algs.reserve(threading_opts.threads + 1);
-    for (std::size_t i = 0; i < threading_opts.threads + 1; ++i) {
-
-        cached_host_mrs.at(i) =
-            std::make_unique<vecmem::binary_page_memory_resource>(
-                uncached_host_mr);
-        vecmem::memory_resource& alg_host_mr =
-            use_host_caching
-                ? static_cast<vecmem::memory_resource&>(
-                      *(cached_host_mrs.at(i)))
-                : static_cast<vecmem::memory_resource&>(uncached_host_mr);
-        algs.push_back(
-            {alg_host_mr,
-             clustering_cfg,
-             seeding_opts.seedfinder,
-             {seeding_opts.seedfinder},
-             seeding_opts.seedfilter,
-             finding_cfg,
-             fitting_cfg,
-             (detector_opts.use_detray_detector ? &detector : nullptr)});
+    // Set up the (reproducible) schedule of the events to process.
+    performance::event_schedule schedule{
+        performance::event_sampling_from_string(
+            throughput_opts.event_sampling),
+        input_opts.events, throughput_opts.sampling_seed,
+        throughput_opts.event_list};
+
+    // Set up the machine-readable report.
+    performance::throughput_report report{description};
+    {
+        std::ostringstream config;
+        config << detector_opts << "\n"
+               << input_opts << "\n"
+               << clusterization_opts << "\n"
+               << seeding_opts << "\n"
+               << finding_opts << "\n"
+               << propagation_opts << "\n"
+               << throughput_opts << "\n"
+               << profiling_opts << "\n"
+               << threading_opts;
+        report.add_configuration(config.str());
     }
 
-    // Seed the random number generator.
-    std::srand(std::time(0));
+    // Timing information not specific to any one thread count.
+    const performance::timing_info common_times = times;
+
+    // Perform the measurement with every requested thread count.
+    for (const std::size_t threads : threading_opts.thread_counts()) {
+
+        // Start from fresh timing information.
+        times = common_times;
+
+        // Process the same events with every thread count.
+        schedule.reset();
+
+        // Measure the peak memory usage of every thread count separately,
+        // if possible.
+        const bool peak_rss_reset = performance::reset_peak_resident_memory();
+
+        // Limit the number of threads used by TBB.
+        tbb::global_control global_thread_limit(
+            tbb::global_control::max_allowed_parallelism, threads + 1);
+
+        // The NUMA nodes to distribute the threads over. Without pinning, or
+        // if TBB can not tell the topology of the host, a single unconstrained
+        // "node" is used.
+        std::vector<tbb::numa_node_id> numa_nodes{tbb::task_arena::automatic};
+        if (threading_opts.numa_pinning) {
+            const std::vector<tbb::numa_node_id> host_nodes =
+                tbb::info::numa_nodes();
+            if ((host_nodes.size() > 1) ||
+                (host_nodes.front() != tbb::task_arena::automatic)) {
+                numa_nodes = host_nodes;
+            }
+            numa_nodes.resize(std::min(numa_nodes.size(), threads));
+        }
 
-    // Dummy count uses output of tp algorithm to ensure the compiler
-    // optimisations don't skip any step
-    std::atomic_size_t rec_track_params = 0;
+        // The thread pool shared by all algorithm chains, if they use one, so
+        // that they would not oversubscribe the CPU.
+        const auto pool = [threads]() {
+            if constexpr (uses_thread_pool) {
+                return std::make_shared<
+                    typename FULL_CHAIN_ALG::thread_pool_type>(threads);
+            } else {
+                return nullptr;
+            }
+        }();
+
+        /// Everything needed for processing events on one NUMA node
+        struct numa_domain {
+            /// The arena of the threads of the node
+            std::unique_ptr<tbb::task_arena> arena;
+            /// The task group of the events processed on the node
+            std::unique_ptr<tbb::task_group> group;
+            /// Cached memory resources, one for each thread (if used)
+            std::vector<std::unique_ptr<vecmem::binary_page_memory_resource> >
+                cached_host_mrs;
+            /// Arenas for the per-event allocations, one for each thread
+            std::vector<std::unique_ptr<performance::arena_memory_resource> >
+                arena_host_mrs;
+            /// Memory resources counting the allocations of each thread
+            std::vector<std::unique_ptr<performance::counting_memory_resource> >
+                counting_host_mrs;
+            /// The full-chain algorithms, one for each thread
+            std::vector<FULL_CHAIN_ALG> algs;
+        };
+        std::vector<numa_domain> domains(numa_nodes.size());
+
+        for (std::size_t d = 0; d < domains.size(); ++d) {
+
+            // Distribute the threads evenly between the nodes.
+            const std::size_t domain_threads =
+                threads / domains.size() +
+                ((d < (threads % domains.size())) ? 1 : 0);
+
+            // Set up the TBB arena and thread group of the node.
+            numa_domain& domain = domains[d];
+            domain.arena = std::make_unique<tbb::task_arena>(
+                tbb::task_arena::constraints{numa_nodes[d],
+                                             static_cast<int>(domain_threads)},
+                0);
+            domain.group = std::make_unique<tbb::task_group>();
+
+            // Set up cached (or arena) memory resources on top of the host
+            // memory resource separately for each CPU thread, and count the
+            // allocations made through them. Set up the full-chain
+            // algorithm(s) the same way. Do all of this from inside the arena,
+            // so that the memory of these objects would be allocated on the
+            // node that they are used on.
+            domain.arena->execute([&]() {
+                domain.cached_host_mrs.resize(domain_threads + 1);
+                domain.arena_host_mrs.resize(domain_threads + 1);
+                domain.counting_host_mrs.resize(domain_threads + 1);
+                domain.algs.reserve(domain_threads + 1);
+                for (std::size_t i = 0; i < domain_threads + 1; ++i) {
+
+                    vecmem::memory_resource* upstream_mr = &uncached_host_mr;
+                    if (throughput_opts.arena_allocator) {
+                        domain.arena_host_mrs.at(i) =
+                            std::make_unique<performance::arena_memory_resource>(
+                                uncached_host_mr,
+                                throughput_opts.arena_block_size * 1024u *
+                                    1024u);
+                        upstream_mr = domain.arena_host_mrs.at(i).get();
+                    } else if (use_host_caching) {
+                        domain.cached_host_mrs.at(i) = std::make_unique<
+                            vecmem::binary_page_memory_resource>(
+                            uncached_host_mr);
+                        upstream_mr = domain.cached_host_mrs.at(i).get();
+                    }
+                    domain.counting_host_mrs.at(i) =
+                        std::make_unique<performance::counting_memory_resource>(
+                            *upstream_mr);
+                    auto make_alg = [&](auto&&... alg_pool) {
+                        return FULL_CHAIN_ALG{
+                            *(domain.counting_host_mrs.at(i)),
+                            clustering_cfg,
+                            seeding_opts.seedfinder,
+                            {seeding_opts.seedfinder},
+                            seeding_opts.seedfilter,
+                            finding_cfg,
+                            fitting_cfg,
+                            (detector_opts.use_detray_detector ? &detector
+                                                               : nullptr),
+                            alg_pool...};
+                    };
+                    if constexpr (uses_thread_pool) {
+                        domain.algs.push_back(make_alg(pool));
+                    } else {
+                        domain.algs.push_back(make_alg());
+                    }
+                    if constexpr (supports_field_map) {
+                        if (field) {
+                            domain.algs.back().set_field(field);
+                        }
+                    }
+                    if constexpr (supports_batched_params) {
+                        domain.algs.back().set_batched_params_estimation(
+                            seeding_opts.batched_params_estimation);
+                    }
+                    if constexpr (supports_vertex_z_finding) {
+                        if (seeding_opts.vertexfinder.enable) {
+                            domain.algs.back().set_vertex_z_finder_config(
+                                seeding_opts.vertexfinder);
+                        }
+                    }
+
+                    // Keep the allocations of the algorithm's construction
+                    // in the arena.
+                    if (domain.arena_host_mrs.at(i)) {
+                        domain.arena_host_mrs.at(i)->mark();
+                    }
+                }
+            });
+        }
 
-    // Cold Run events. To discard any "initialisation issues" in the
-    // measurements.
-    {
-        // Measure the time of execution.
-        performance::timer t{"Warm-up processing", times};
-
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
-
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(
-                        algs.at(tbb::this_task_arena::current_thread_index())(
-                                input[event].cells, input[event].modules)
-                            .size());
+        // Dummy count uses output of tp algorithm to ensure the compiler
+        // optimisations don't skip any step
+        std::atomic_size_t rec_track_params = 0;
+
+        // Helper function processing the scheduled events. Batches of events
+        // are processed by a single task each, with the batches distributed
+        // between the NUMA nodes in a round-robin fashion.
+        auto process_events = [&](const std::vector<std::size_t>& events) {
+            const std::size_t batch_size = throughput_opts.batch_size;
+            for (std::size_t begin = 0, batch = 0; begin < events.size();
+                 begin += batch_size, ++batch) {
+
+                const std::size_t end =
+                    std::min(begin + batch_size, events.size());
+                numa_domain& domain = domains[batch % domains.size()];
+
+                // Launch the processing of the batch.
+                domain.arena->execute([&, begin, end]() {
+                    domain.group->run([&, begin, end]() {
+                        const int thread =
+                            tbb::this_task_arena::current_thread_index();
+                        FULL_CHAIN_ALG& alg = domain.algs.at(thread);
+                        const auto& arena_mr = domain.arena_host_mrs.at(thread);
+                        std::size_t n_track_params = 0;
+                        for (std::size_t i = begin; i < end; ++i) {
+                            const std::size_t event = events[i];
+                            n_track_params +=
+                                alg(input[event].cells, input[event].modules)
+                                    .size();
+                            // Free all memory of the event at once.
+                            if (arena_mr) {
+                                arena_mr->reset();
+                            }
+                        }
+                        rec_track_params.fetch_add(n_track_params);
+                    });
                 });
-            });
+            }
+
+            // Wait for all tasks to finish.
+            for (numa_domain& domain : domains) {
+                domain.arena->execute([&]() { domain.group->wait(); });
+            }
+        };
+
+        // Cold Run events. To discard any "initialisation issues" in the
+        // measurements.
+        {
+            // Measure the time of execution.
+            performance::timer t{"Warm-up processing", times};
+
+            // Process the requested number of events.
+            process_events(schedule.next(throughput_opts.cold_run_events));
         }
 
-        // Wait for all tasks to finish.
-        group.wait();
-    }
+        // Reset the dummy counter and the allocation statistics.
+        rec_track_params = 0;
+        for (const numa_domain& domain : domains) {
+            for (const auto& mr : domain.counting_host_mrs) {
+                mr->reset_statistics();
+            }
+        }
 
-    // Reset the dummy counter.
-    rec_track_params = 0;
+        // Profile only the measured event processing.
+        if (profiling_opts.run) {
+            performance::profiler& profiler =
+                performance::profiler::instance();
+            profiler.reset();
+            profiler.enable(profiling_opts.buffer_size,
+                            profiling_opts.hardware_counters);
+            if (profiling_opts.hardware_counters &&
+                !performance::profiler::sampling_counters()) {
+                std::cerr << "WARNING: Hardware counters are not available ("
+                          << profiler.counters_error() << ")" << std::endl;
+            }
+        }
 
-    {
-        // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
-
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.processed_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
-
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(
-                        algs.at(tbb::this_task_arena::current_thread_index())(
-                                input[event].cells, input[event].modules)
-                            .size());
-                });
-            });
+        // Measure the processing of the requested number of events, as many
+        // times as requested.
+        std::vector<std::chrono::nanoseconds> repetition_times;
+        for (std::size_t rep = 0; rep < throughput_opts.repetitions; ++rep) {
+
+            // Choose which events to process.
+            const std::vector<std::size_t> events =
+                schedule.next(throughput_opts.processed_events);
+
+            performance::timing_info rep_times;
+            {
+                // Measure the total time of execution.
+                performance::timer t{"Event processing", rep_times};
+
+                // Process the requested number of events.
+                process_events(events);
+            }
+            repetition_times.push_back(
+                rep_times.get_time("Event processing"));
+        }
+        {
+            std::chrono::nanoseconds total{0};
+            for (const std::chrono::nanoseconds& time : repetition_times) {
+                total += time;
+            }
+            times.data.emplace_back("Event processing", total);
+        }
+
+        // Stop profiling.
+        performance::profiler::instance().disable();
+
+        // Collect the results of the measurement.
+        performance::throughput_measurement measurement;
+        measurement.threads = threads;
+        measurement.events = throughput_opts.processed_events;
+        measurement.repetitions = repetition_times;
+        measurement.timings = times;
+        for (const numa_domain& domain : domains) {
+            for (const auto& mr : domain.counting_host_mrs) {
+                measurement.allocations += mr->statistics();
+            }
+            for (const auto& mr : domain.arena_host_mrs) {
+                if (mr) {
+                    if (!measurement.arena) {
+                        measurement.arena.emplace();
+                    }
+                    *(measurement.arena) += mr->statistics();
+                }
+            }
+        }
+
+        if (peak_rss_reset) {
+            measurement.peak_rss_bytes = performance::peak_resident_memory();
+        }
+
+        // Delete the algorithms and host memory caches explicitly before
+        // their parent object would go out of scope.
+        domains.clear();
+
+        // Print some results.
+        if (threading_opts.thread_sweep.empty() == false) {
+            std::cout << "Results with " << threads
+                      << " CPU thread(s):" << std::endl;
+        }
+        std::cout << "Reconstructed track parameters: "
+                  << rec_track_params.load() << std::endl;
+        std::cout << "Host allocations: " << measurement.allocations
+                  << std::endl;
+        if (measurement.arena) {
+            std::cout << "Arena allocator: " << *(measurement.arena)
+                      << std::endl;
+        }
+        std::cout << "Time totals:" << std::endl;
+        std::cout << times << std::endl;
+        std::cout << "Throughput:" << std::endl;
+        std::cout << performance::throughput{throughput_opts.cold_run_events,
+                                             times, "Warm-up processing"}
+                  << "\n"
+                  << performance::throughput{
+                         throughput_opts.processed_events *
+                             throughput_opts.repetitions,
+                         times, "Event processing"}
+                  << std::endl;
+        if (throughput_opts.repetitions > 1) {
+            std::cout << "Event rate over " << throughput_opts.repetitions
+                      << " repetitions: " << measurement.rate() << std::endl;
+        }
+
+        // Print the per-stage profile.
+        if (profiling_opts.run) {
+            const std::vector<performance::profiling_record> records =
+                performance::profiler::instance().collect();
+            measurement.profile.emplace(
+                records, performance::profiler::instance().dropped());
+            std::cout << "Profile:" << std::endl;
+            std::cout << *(measurement.profile) << std::endl;
+            if (profiling_opts.trace_file.empty() == false) {
+                // Write a separate trace for every thread count of a sweep.
+                std::filesystem::path trace_path{profiling_opts.trace_file};
+                if (threading_opts.thread_sweep.empty() == false) {
+                    trace_path.replace_filename(
+                        trace_path.stem().string() + "_" +
+                        std::to_string(threads) + "threads" +
+                        trace_path.extension().string());
+                }
+                std::ofstream trace_file{trace_path};
+                performance::write_chrome_trace(trace_file, records);
+            }
+        }
+
+        // Print results to log file
+        if (throughput_opts.log_file != "\0") {
+            std::ofstream logFile;
+            logFile.open(throughput_opts.log_file, std::fstream::app);
+            logFile << "\"" << input_opts.directory << "\""
+                    << "," << threads << "," << input_opts.events << ","
+                    << throughput_opts.cold_run_events << ","
+                    << throughput_opts.processed_events *
+                           throughput_opts.repetitions
+                    << "," << times.get_time("Warm-up processing").count()
+                    << ","
+                    << times.get_time("Event processing").count()
+                    << std::endl;
+            logFile.close();
         }
 
-        // Wait for all tasks to finish.
-        group.wait();
+        // Add the measurement to the report.
+        report.add_measurement(std::move(measurement));
     }
 
-    // Delete the algorithms and host memory caches explicitly before their
-    // parent object would go out of scope.
-    algs.clear();
-    cached_host_mrs.clear();
-
-    // Print some results.
-    std::cout << "Reconstructed track parameters: " << rec_track_params.load()
-              << std::endl;
-    std::cout << "Time totals:" << std::endl;
-    std::cout << times << std::endl;
-    std::cout << "Throughput:" << std::endl;
-    std::cout << performance::throughput{throughput_opts.cold_run_events, times,
-                                         "Warm-up processing"}
-              << "\n"
-              << performance::throughput{throughput_opts.processed_events,
-                                         times, "Event processing"}
-              << std::endl;
-
-    // Print results to log file
-    if (throughput_opts.log_file != "\0") {
-        std::ofstream logFile;
-        logFile.open(throughput_opts.log_file, std::fstream::app);
-        logFile << "\"" << input_opts.directory << "\""
-                << "," << threading_opts.threads << "," << input_opts.events
-                << "," << throughput_opts.cold_run_events << ","
-                << throughput_opts.processed_events << ","
-                << times.get_time("Warm-up processing").count() << ","
-                << times.get_time("Event processing").count() << std::endl;
-        logFile.close();
+    // Write the machine-readable report.
+    if (throughput_opts.report_file.empty() == false) {
+        std::ofstream report_file{throughput_opts.report_file};
+        report.write(report_file);
     }
 
     // Return gracefully.
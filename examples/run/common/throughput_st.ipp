@@ -11,6 +11,7 @@
 #include "traccc/options/clusterization.hpp"
 #include "traccc/options/detector.hpp"
 #include "traccc/options/input_data.hpp"
+#include "traccc/options/profiling.hpp"
 #include "traccc/options/program_options.hpp"
 #include "traccc/options/throughput.hpp"
 #include "traccc/options/track_finding.hpp"
@@ -21,13 +22,23 @@
 #include "traccc/io/demonstrator_edm.hpp"
 #include "traccc/io/read.hpp"
 #include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_magnetic_field.hpp"
 #include "traccc/io/utils.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/arena_memory_resource.hpp"
+#include "traccc/performance/counting_memory_resource.hpp"
+#include "traccc/performance/event_schedule.hpp"
+#include "traccc/performance/profiler.hpp"
+#include "traccc/performance/profiling_summary.hpp"
 #include "traccc/performance/throughput.hpp"
+#include "traccc/performance/throughput_report.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
 
+// Project include(s).
+#include "traccc/utils/field_map.hpp"
+
 // Detray include(s).
 #include "detray/core/detector.hpp"
 #include "detray/io/frontend/detector_reader.hpp"
@@ -36,10 +47,14 @@
 #include <vecmem/memory/binary_page_memory_resource.hpp>
 
 // System include(s).
-#include <cstdlib>
-#include <ctime>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace traccc {
 
@@ -55,10 +70,11 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     opts::track_finding finding_opts;
     opts::track_propagation propagation_opts;
     opts::throughput throughput_opts;
+    opts::profiling profiling_opts;
     opts::program_options program_opts{
         description,
         {detector_opts, input_opts, clusterization_opts, seeding_opts,
-         finding_opts, propagation_opts, throughput_opts},
+         finding_opts, propagation_opts, throughput_opts, profiling_opts},
         argc,
         argv};
 
@@ -67,8 +83,7 @@ int throughput_st(std::string_view description, int argc, char* argv[],
 
     // Memory resource to use in the test.
     HOST_MR uncached_host_mr;
-    std::unique_ptr<vecmem::binary_page_memory_resource> cached_host_mr =
-        std::make_unique<vecmem::binary_page_memory_resource>(uncached_host_mr);
+    std::unique_ptr<vecmem::binary_page_memory_resource> cached_host_mr;
 
     // Read in the geometry.
     auto [surface_transforms, barcode_map] = traccc::io::read_geometry(
@@ -98,10 +113,63 @@ int throughput_st(std::string_view description, int argc, char* argv[],
         detector = std::move(det.first);
     }
 
-    vecmem::memory_resource& alg_host_mr =
-        use_host_caching
-            ? static_cast<vecmem::memory_resource&>(*cached_host_mr)
-            : static_cast<vecmem::memory_resource&>(uncached_host_mr);
+    // Read in the magnetic field map, if one was specified.
+    constexpr bool supports_field_map =
+        requires(FULL_CHAIN_ALG& alg, std::shared_ptr<const field_map> f) {
+            alg.set_field(f);
+        };
+    std::shared_ptr<const field_map> field;
+    if (detector_opts.bfield_file.empty() == false) {
+        if (!supports_field_map) {
+            throw std::invalid_argument{
+                "This chain does not support --bfield-file"};
+        }
+        field = std::make_shared<const field_map>(
+            io::read_magnetic_field(detector_opts.bfield_file));
+    }
+
+    // Check that the batched track parameter estimation can be used, if it
+    // was asked for.
+    constexpr bool supports_batched_params = requires(FULL_CHAIN_ALG& alg) {
+        alg.set_batched_params_estimation(true);
+    };
+    if (seeding_opts.batched_params_estimation && !supports_batched_params) {
+        throw std::invalid_argument{
+            "This chain does not support --batched-params-estimation"};
+    }
+
+    // Check the same for the primary vertex z pre-finding.
+    constexpr bool supports_vertex_z_finding =
+        requires(FULL_CHAIN_ALG& alg, const vertex_z_finder_config& c) {
+            alg.set_vertex_z_finder_config(c);
+        };
+    if (seeding_opts.vertexfinder.enable && !supports_vertex_z_finding) {
+        throw std::invalid_argument{
+            "This chain does not support --vertex-z-prefinding"};
+    }
+
+    // Check whether the chain executes its kernels on an (injected) thread
+    // pool.
+    constexpr bool uses_thread_pool =
+        requires { typename FULL_CHAIN_ALG::thread_pool_type; };
+
+    // Set up an arena for the per-event allocations, if requested.
+    std::unique_ptr<performance::arena_memory_resource> arena_host_mr;
+    if (throughput_opts.arena_allocator) {
+        arena_host_mr = std::make_unique<performance::arena_memory_resource>(
+            uncached_host_mr, throughput_opts.arena_block_size * 1024u * 1024u);
+    }
+
+    // Count the host allocations made by the algorithm.
+    vecmem::memory_resource* alg_upstream_mr = &uncached_host_mr;
+    if (arena_host_mr) {
+        alg_upstream_mr = arena_host_mr.get();
+    } else if (use_host_caching) {
+        cached_host_mr = std::make_unique<vecmem::binary_page_memory_resource>(
+            uncached_host_mr);
+        alg_upstream_mr = cached_host_mr.get();
+    }
+    performance::counting_memory_resource alg_host_mr{*alg_upstream_mr};
 
     // Read in all input events into memory.
     demonstrator_input input(&uncached_host_mr);
@@ -134,15 +202,49 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     typename FULL_CHAIN_ALG::fitting_algorithm::config_type fitting_cfg;
     fitting_cfg.propagation = propagation_config;
 
-    // Set up the full-chain algorithm.
-    std::unique_ptr<FULL_CHAIN_ALG> alg = std::make_unique<FULL_CHAIN_ALG>(
-        alg_host_mr, clustering_cfg, seeding_opts.seedfinder,
-        spacepoint_grid_config{seeding_opts.seedfinder},
-        seeding_opts.seedfilter, finding_cfg, fitting_cfg,
-        (detector_opts.use_detray_detector ? &detector : nullptr));
+    // Set up the full-chain algorithm. Chains executing their kernels on a
+    // thread pool are given one from here.
+    auto make_alg = [&](auto&&... pool) {
+        return std::make_unique<FULL_CHAIN_ALG>(
+            alg_host_mr, clustering_cfg, seeding_opts.seedfinder,
+            spacepoint_grid_config{seeding_opts.seedfinder},
+            seeding_opts.seedfilter, finding_cfg, fitting_cfg,
+            (detector_opts.use_detray_detector ? &detector : nullptr),
+            std::forward<decltype(pool)>(pool)...);
+    };
+    std::unique_ptr<FULL_CHAIN_ALG> alg;
+    if constexpr (uses_thread_pool) {
+        alg = make_alg(
+            std::make_shared<typename FULL_CHAIN_ALG::thread_pool_type>());
+    } else {
+        alg = make_alg();
+    }
+    if constexpr (supports_field_map) {
+        if (field) {
+            alg->set_field(field);
+        }
+    }
+    if constexpr (supports_batched_params) {
+        alg->set_batched_params_estimation(
+            seeding_opts.batched_params_estimation);
+    }
+    if constexpr (supports_vertex_z_finding) {
+        if (seeding_opts.vertexfinder.enable) {
+            alg->set_vertex_z_finder_config(seeding_opts.vertexfinder);
+        }
+    }
+
+    // Keep the allocations of the algorithm's construction in the arena.
+    if (arena_host_mr) {
+        arena_host_mr->mark();
+    }
 
-    // Seed the random number generator.
-    std::srand(std::time(0));
+    // Set up the (reproducible) schedule of the events to process.
+    performance::event_schedule schedule{
+        performance::event_sampling_from_string(
+            throughput_opts.event_sampling),
+        input_opts.events, throughput_opts.sampling_seed,
+        throughput_opts.event_list};
 
     // Dummy count uses output of tp algorithm to ensure the compiler
     // optimisations don't skip any step
@@ -155,52 +257,145 @@ int throughput_st(std::string_view description, int argc, char* argv[],
         performance::timer t{"Warm-up processing", times};
 
         // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
+        for (std::size_t event :
+             schedule.next(throughput_opts.cold_run_events)) {
 
             // Process one event.
             rec_track_params +=
                 (*alg)(input[event].cells, input[event].modules).size();
+
+            // Free all of its memory at once.
+            if (arena_host_mr) {
+                arena_host_mr->reset();
+            }
         }
     }
 
-    // Reset the dummy counter.
+    // Reset the dummy counter and the allocation statistics.
     rec_track_params = 0;
+    alg_host_mr.reset_statistics();
+
+    // Profile only the measured event processing.
+    if (profiling_opts.run) {
+        performance::profiler& profiler = performance::profiler::instance();
+        profiler.enable(profiling_opts.buffer_size,
+                        profiling_opts.hardware_counters);
+        if (profiling_opts.hardware_counters &&
+            !performance::profiler::sampling_counters()) {
+            std::cerr << "WARNING: Hardware counters are not available ("
+                      << profiler.counters_error() << ")" << std::endl;
+        }
+    }
 
-    {
-        // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
+    // Measure the processing of the requested number of events, as many
+    // times as requested.
+    std::vector<std::chrono::nanoseconds> repetition_times;
+    for (std::size_t rep = 0; rep < throughput_opts.repetitions; ++rep) {
 
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.processed_events; ++i) {
+        // Choose which events to process.
+        const std::vector<std::size_t> events =
+            schedule.next(throughput_opts.processed_events);
 
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
+        performance::timing_info rep_times;
+        {
+            // Measure the total time of execution.
+            performance::timer t{"Event processing", rep_times};
 
-            // Process one event.
-            rec_track_params +=
-                (*alg)(input[event].cells, input[event].modules).size();
+            // Process the requested number of events.
+            for (std::size_t event : events) {
+
+                // Process one event.
+                rec_track_params +=
+                    (*alg)(input[event].cells, input[event].modules).size();
+
+                // Free all of its memory at once.
+                if (arena_host_mr) {
+                    arena_host_mr->reset();
+                }
+            }
         }
+        repetition_times.push_back(rep_times.get_time("Event processing"));
+    }
+    {
+        std::chrono::nanoseconds total{0};
+        for (const std::chrono::nanoseconds& time : repetition_times) {
+            total += time;
+        }
+        times.data.emplace_back("Event processing", total);
+    }
+
+    // Stop profiling.
+    performance::profiler::instance().disable();
+
+    // Collect the results of the measurement.
+    performance::throughput_measurement measurement;
+    measurement.threads = 1;
+    measurement.events = throughput_opts.processed_events;
+    measurement.repetitions = repetition_times;
+    measurement.timings = times;
+    measurement.allocations = alg_host_mr.statistics();
+    if (arena_host_mr) {
+        measurement.arena = arena_host_mr->statistics();
     }
 
     // Explicitly delete the objects in the correct order.
     alg.reset();
+    arena_host_mr.reset();
     cached_host_mr.reset();
 
     // Print some results.
     std::cout << "Reconstructed track parameters: " << rec_track_params
               << std::endl;
+    std::cout << "Host allocations: " << measurement.allocations << std::endl;
+    if (measurement.arena) {
+        std::cout << "Arena allocator: " << *(measurement.arena) << std::endl;
+    }
     std::cout << "Time totals:" << std::endl;
     std::cout << times << std::endl;
     std::cout << "Throughput:" << std::endl;
     std::cout << performance::throughput{throughput_opts.cold_run_events, times,
                                          "Warm-up processing"}
               << "\n"
-              << performance::throughput{throughput_opts.processed_events,
+              << performance::throughput{throughput_opts.processed_events *
+                                             throughput_opts.repetitions,
                                          times, "Event processing"}
               << std::endl;
+    if (throughput_opts.repetitions > 1) {
+        std::cout << "Event rate over " << throughput_opts.repetitions
+                  << " repetitions: " << measurement.rate() << std::endl;
+    }
+
+    // Print the per-stage profile.
+    if (profiling_opts.run) {
+        const std::vector<performance::profiling_record> records =
+            performance::profiler::instance().collect();
+        measurement.profile.emplace(
+            records, performance::profiler::instance().dropped());
+        std::cout << "Profile:" << std::endl;
+        std::cout << *(measurement.profile) << std::endl;
+        if (profiling_opts.trace_file.empty() == false) {
+            std::ofstream trace_file{profiling_opts.trace_file};
+            performance::write_chrome_trace(trace_file, records);
+        }
+    }
+
+    // Write the machine-readable report.
+    if (throughput_opts.report_file.empty() == false) {
+        performance::throughput_report report{description};
+        std::ostringstream config;
+        config << detector_opts << "\n"
+               << input_opts << "\n"
+               << clusterization_opts << "\n"
+               << seeding_opts << "\n"
+               << finding_opts << "\n"
+               << propagation_opts << "\n"
+               << throughput_opts << "\n"
+               << profiling_opts;
+        report.add_configuration(config.str());
+        report.add_measurement(std::move(measurement));
+        std::ofstream report_file{throughput_opts.report_file};
+        report.write(report_file);
+    }
 
     // Return gracefully.
     return 0;
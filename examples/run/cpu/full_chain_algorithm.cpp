@@ -8,7 +8,37 @@
 // Local include(s).
 #include "full_chain_algorithm.hpp"
 
+// Project include(s).
+#include "traccc/performance/profiling_scope.hpp"
+
+// System include(s).
+#include <cassert>
+#include <utility>
+
 namespace traccc {
+namespace {
+
+/// Find and fit tracks with a given pair of algorithms, in a given field
+template <typename finding_algorithm_t, typename fitting_algorithm_t,
+          typename detector_t, typename field_t>
+full_chain_algorithm::output_type find_and_fit(
+    const finding_algorithm_t& finding, const fitting_algorithm_t& fitting,
+    const detector_t& detector, const field_t& field,
+    const measurement_collection_types::host& measurements,
+    const bound_track_parameters_collection_types::host& track_params) {
+
+    const typename finding_algorithm_t::output_type track_candidates = [&]() {
+        performance::profiling_scope scope{"Track finding",
+                                           track_params.size()};
+        return finding(detector, field, measurements, track_params);
+    }();
+
+    performance::profiling_scope scope{"Track fitting",
+                                       track_candidates.size()};
+    return fitting(detector, field, track_candidates);
+}
+
+}  // namespace
 
 full_chain_algorithm::full_chain_algorithm(
     vecmem::memory_resource& mr, const clustering_algorithm::config_type&,
@@ -20,13 +50,17 @@ full_chain_algorithm::full_chain_algorithm(
     detector_type* detector)
     : m_field_vec{0.f, 0.f, finder_config.bFieldInZ},
       m_field(detray::bfield::create_const_field(m_field_vec)),
+      m_mr(mr),
       m_detector(detector),
       m_clusterization(mr),
       m_spacepoint_formation(mr),
       m_seeding(finder_config, grid_config, filter_config, mr),
       m_track_parameter_estimation(mr),
+      m_batched_track_parameter_estimation(mr),
       m_finding(finding_config),
       m_fitting(fitting_config),
+      m_field_map_finding(finding_config),
+      m_field_map_fitting(fitting_config),
       m_finder_config(finder_config),
       m_grid_config(grid_config),
       m_filter_config(filter_config),
@@ -37,25 +71,39 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
     const cell_collection_types::host& cells,
     const cell_module_collection_types::host& modules) const {
 
+    // Profile the event as a whole.
+    performance::profiling_scope event_scope{"Full chain", cells.size()};
+
     // Run the clusterization.
-    const host::clusterization_algorithm::output_type measurements =
-        m_clusterization(vecmem::get_data(cells), vecmem::get_data(modules));
+    const host::clusterization_algorithm::output_type measurements = [&]() {
+        performance::profiling_scope scope{"Clusterization", cells.size()};
+        return m_clusterization(vecmem::get_data(cells),
+                                vecmem::get_data(modules));
+    }();
 
     // Run the seed-finding.
     const host::spacepoint_formation_algorithm::output_type spacepoints =
-        m_spacepoint_formation(vecmem::get_data(measurements),
-                               vecmem::get_data(modules));
-    const track_params_estimation::output_type track_params =
-        m_track_parameter_estimation(spacepoints, m_seeding(spacepoints),
-                                     m_field_vec);
+        [&]() {
+            performance::profiling_scope scope{"Spacepoint formation",
+                                               measurements.size()};
+            return m_spacepoint_formation(vecmem::get_data(measurements),
+                                          vecmem::get_data(modules));
+        }();
+    const seeding_algorithm::output_type seeds = [&]() {
+        performance::profiling_scope scope{"Seeding", spacepoints.size()};
+        return m_seeding(spacepoints);
+    }();
+    const track_params_estimation::output_type track_params = [&]() {
+        performance::profiling_scope scope{"Track params estimation",
+                                           seeds.size()};
+        return estimate_track_params(spacepoints, seeds);
+    }();
 
     // If we have a Detray detector, run the track finding and fitting.
     if (m_detector != nullptr) {
 
         // Return the final container, after track finding and fitting.
-        return m_fitting(
-            *m_detector, m_field,
-            m_finding(*m_detector, m_field, measurements, track_params));
+        return find_and_fit_tracks(measurements, track_params);
 
     }
     // If not, just return an empty object.
@@ -66,4 +114,110 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
     }
 }
 
+full_chain_algorithm::output_type full_chain_algorithm::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules,
+    std::span<const region_of_interest> rois) const {
+
+    // Profile the event as a whole.
+    performance::profiling_scope event_scope{"Full chain", cells.size()};
+
+    // Run the clusterization and the spacepoint formation for the whole
+    // event.
+    const host::clusterization_algorithm::output_type measurements = [&]() {
+        performance::profiling_scope scope{"Clusterization", cells.size()};
+        return m_clusterization(vecmem::get_data(cells),
+                                vecmem::get_data(modules));
+    }();
+    const host::spacepoint_formation_algorithm::output_type spacepoints =
+        [&]() {
+            performance::profiling_scope scope{"Spacepoint formation",
+                                               measurements.size()};
+            return m_spacepoint_formation(vecmem::get_data(measurements),
+                                          vecmem::get_data(modules));
+        }();
+
+    // Reconstruct the tracks of the regions of interest, one by one. Re-using
+    // the state of the seeding between them.
+    output_type result{&(m_mr.get())};
+    seeding_algorithm::state_type seeding_state =
+        m_seeding.make_state(m_mr.get());
+    for (const region_of_interest& roi : rois) {
+
+        performance::profiling_scope roi_scope{"Region of interest"};
+
+        const seeding_algorithm::output_type seeds = [&]() {
+            performance::profiling_scope scope{"Seeding", spacepoints.size()};
+            return m_seeding(spacepoints, roi, seeding_state);
+        }();
+        roi_scope.set_items(seeds.size());
+        const track_params_estimation::output_type track_params = [&]() {
+            performance::profiling_scope scope{"Track params estimation",
+                                               seeds.size()};
+            return estimate_track_params(spacepoints, seeds);
+        }();
+
+        // Without a Detray detector, there are no tracks to collect.
+        if (m_detector == nullptr) {
+            continue;
+        }
+
+        // Only run the track finding for the seeds of the region.
+        const output_type tracks =
+            find_and_fit_tracks(measurements, track_params);
+
+        // Collect the tracks of the region.
+        for (std::size_t i = 0; i < tracks.size(); ++i) {
+            auto header = tracks.get_headers()[i];
+            auto items = tracks.get_items()[i];
+            result.push_back(std::move(header), std::move(items));
+        }
+    }
+
+    return result;
+}
+
+void full_chain_algorithm::set_field(std::shared_ptr<const field_map> field) {
+
+    m_field_map = std::move(field);
+}
+
+void full_chain_algorithm::set_batched_params_estimation(bool enable) {
+
+    m_use_batched_params_estimation = enable;
+}
+
+void full_chain_algorithm::set_vertex_z_finder_config(
+    const vertex_z_finder_config& config) {
+
+    m_seeding = seeding_algorithm(m_finder_config, m_grid_config,
+                                  m_filter_config, m_mr.get(), config);
+}
+
+track_params_estimation::output_type
+full_chain_algorithm::estimate_track_params(
+    const spacepoint_collection_types::host& spacepoints,
+    const seeding_algorithm::output_type& seeds) const {
+
+    if (m_use_batched_params_estimation) {
+        return m_batched_track_parameter_estimation(spacepoints, seeds,
+                                                    m_field_vec);
+    }
+    return m_track_parameter_estimation(spacepoints, seeds, m_field_vec);
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::find_and_fit_tracks(
+    const measurement_collection_types::host& measurements,
+    const track_params_estimation::output_type& track_params) const {
+
+    assert(m_detector != nullptr);
+    if (m_field_map) {
+        return find_and_fit(m_field_map_finding, m_field_map_fitting,
+                            *m_detector, cached_field_view(*m_field_map),
+                            measurements, track_params);
+    }
+    return find_and_fit(m_finding, m_fitting, *m_detector, m_field,
+                        measurements, track_params);
+}
+
 }  // namespace traccc
@@ -11,13 +11,17 @@
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 #include "traccc/clusterization/spacepoint_formation_algorithm.hpp"
 #include "traccc/edm/cell.hpp"
+#include "traccc/edm/region_of_interest.hpp"
 #include "traccc/edm/track_state.hpp"
 #include "traccc/finding/finding_algorithm.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/seeding/batched_track_params_estimation.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 #include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/cached_field_view.hpp"
+#include "traccc/utils/field_map.hpp"
 
 // Detray include(s).
 #include "detray/core/detector.hpp"
@@ -29,6 +33,11 @@
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s).
+#include <functional>
+#include <memory>
+#include <span>
+
 namespace traccc {
 
 /// Algorithm performing the full chain of track reconstruction
@@ -52,6 +61,10 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
         detray::rk_stepper<detray::bfield::const_field_t::view_t,
                            detector_type::algebra_type,
                            detray::constrained_step<>>;
+    /// Stepper type used with a magnetic field map
+    using field_map_stepper_type =
+        detray::rk_stepper<cached_field_view, detector_type::algebra_type,
+                           detray::constrained_step<>>;
     /// Navigator type used by the track finding and fitting algorithms
     using navigator_type = detray::navigator<const detector_type>;
 
@@ -62,6 +75,12 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
     /// Track fitting algorithm type
     using fitting_algorithm = traccc::fitting_algorithm<
         traccc::kalman_fitter<stepper_type, navigator_type>>;
+    /// Track finding algorithm type used with a magnetic field map
+    using field_map_finding_algorithm =
+        traccc::finding_algorithm<field_map_stepper_type, navigator_type>;
+    /// Track fitting algorithm type used with a magnetic field map
+    using field_map_fitting_algorithm = traccc::fitting_algorithm<
+        traccc::kalman_fitter<field_map_stepper_type, navigator_type>>;
 
     /// @}
 
@@ -90,11 +109,68 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
         const cell_collection_types::host& cells,
         const cell_module_collection_types::host& modules) const override;
 
+    /// Reconstruct tracks in regions of interest
+    ///
+    /// The clusterization and the spacepoint formation are run for the
+    /// entire event. The seeding, track finding and track fitting are only
+    /// run in the regions of interest, one region after the other. So that
+    /// the time taken for each region (recorded by the profiler) would
+    /// scale with the size of the region.
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param modules The modules of the event
+    /// @param rois The regions of interest
+    /// @return The track parameters reconstructed in all regions
+    ///
+    output_type operator()(const cell_collection_types::host& cells,
+                           const cell_module_collection_types::host& modules,
+                           std::span<const region_of_interest> rois) const;
+
+    /// Use a magnetic field map in the track finding and fitting
+    ///
+    /// By default a constant field, set up from the seed finder
+    /// configuration, is used. Once a map is set, the track finding and
+    /// fitting switch to a stepper looking it up through a
+    /// @c traccc::cached_field_view.
+    ///
+    /// @param field The field map to use
+    ///
+    void set_field(std::shared_ptr<const field_map> field);
+
+    /// Estimate the track parameters of the seeds in (vectorised) batches
+    ///
+    /// @param enable Whether to use the batched track parameter estimation
+    ///
+    void set_batched_params_estimation(bool enable);
+
+    /// Use the primary vertex z pre-finding in the seeding
+    ///
+    /// Only affects the seeding of entire events, not the one in regions of
+    /// interest.
+    ///
+    /// @param config The configuration of the vertex z pre-finding
+    ///
+    void set_vertex_z_finder_config(const vertex_z_finder_config& config);
+
     private:
+    /// Estimate the track parameters of a set of seeds
+    track_params_estimation::output_type estimate_track_params(
+        const spacepoint_collection_types::host& spacepoints,
+        const seeding_algorithm::output_type& seeds) const;
+    /// Find and fit the tracks of a set of seeds, in the configured field
+    output_type find_and_fit_tracks(
+        const measurement_collection_types::host& measurements,
+        const track_params_estimation::output_type& track_params) const;
+
     /// Constant B field for the (seed) track parameter estimation
     traccc::vector3 m_field_vec;
     /// Constant B field for the track finding and fitting
     detray::bfield::const_field_t m_field;
+    /// B field map for the track finding and fitting, if one was set
+    std::shared_ptr<const field_map> m_field_map;
+
+    /// Memory resource used by the sub-algorithms
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
 
     /// Detector
     detector_type* m_detector;
@@ -110,11 +186,19 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
     seeding_algorithm m_seeding;
     /// Track parameter estimation algorithm
     track_params_estimation m_track_parameter_estimation;
+    /// Batched track parameter estimation algorithm
+    batched_track_params_estimation m_batched_track_parameter_estimation;
+    /// Whether to use the batched track parameter estimation
+    bool m_use_batched_params_estimation = false;
 
     /// Track finding algorithm
     finding_algorithm m_finding;
     /// Track fitting algorithm
     fitting_algorithm m_fitting;
+    /// Track finding algorithm used with a field map
+    field_map_finding_algorithm m_field_map_finding;
+    /// Track fitting algorithm used with a field map
+    field_map_fitting_algorithm m_field_map_fitting;
 
     /// @}
 
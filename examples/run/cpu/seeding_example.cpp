@@ -129,8 +129,13 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
     // Seeding algorithm
     traccc::seeding_algorithm sa(seeding_opts.seedfinder,
                                  {seeding_opts.seedfinder},
-                                 seeding_opts.seedfilter, host_mr);
+                                 seeding_opts.seedfilter, host_mr,
+                                 seeding_opts.vertexfinder);
     traccc::track_params_estimation tp(host_mr);
+    const traccc::layer_link_table layer_links =
+        seeding_opts.layer_links
+            ? traccc::make_layer_link_table(host_det, seeding_opts.seedfinder)
+            : traccc::layer_link_table{};
 
     // Propagation configuration
     detray::propagation::config propagation_config(propagation_opts);
@@ -167,7 +172,9 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
              Seeding
           ---------------*/
 
-        auto seeds = sa(spacepoints_per_event);
+        auto seeds = seeding_opts.layer_links
+                         ? sa(spacepoints_per_event, layer_links)
+                         : sa(spacepoints_per_event);
 
         /*----------------------------
            Track Parameter Estimation
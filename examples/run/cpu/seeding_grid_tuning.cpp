@@ -0,0 +1,136 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+
+// io
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+#include "traccc/io/utils.hpp"
+
+// algorithms
+#include "traccc/seeding/seeding_grid_tuner.hpp"
+
+// options
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/track_seeding.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace traccc;
+
+int tuning_run(const traccc::opts::track_seeding& seeding_opts,
+               const traccc::opts::input_data& input_opts,
+               const traccc::opts::detector& detector_opts) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the detector
+    detray::io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file(traccc::io::data_directory() +
+                        detector_opts.detector_file);
+    auto [host_det, names] =
+        detray::io::read_detector<detray::detector<>>(host_mr, reader_cfg);
+
+    traccc::geometry surface_transforms =
+        traccc::io::alt_read_geometry(host_det);
+
+    // Read the sample of events
+    std::vector<traccc::spacepoint_collection_types::host> events;
+    for (std::size_t event = input_opts.skip;
+         event < input_opts.events + input_opts.skip; ++event) {
+
+        traccc::io::spacepoint_reader_output readOut(&host_mr);
+        traccc::io::read_spacepoints(readOut, event, input_opts.directory,
+                                     surface_transforms, input_opts.format);
+        events.push_back(std::move(readOut.spacepoints));
+    }
+
+    // Evaluate all grid configurations
+    traccc::seeding_grid_tuner tuner(seeding_opts.seedfinder,
+                                     seeding_opts.seedfilter, {}, host_mr);
+    const auto results = tuner(events);
+
+    // Print the results
+    std::cout << "\n  scope | phi coverage |     z bins | <occupancy> | "
+                 "max occupancy | tests / seed | rel. efficiency\n";
+    for (const seeding_grid_tuning_result& result : results) {
+        const seedfinder_config& config = result.finder_config;
+        std::cout << std::setw(4) << config.neighbor_scope[0] << ","
+                  << config.neighbor_scope[1] << std::setw(15)
+                  << config.phiBinDeflectionCoverage << std::setw(13);
+        if (config.nZBinEdges >= 2) {
+            std::cout << (std::to_string(config.nZBinEdges - 1) + " var.");
+        } else {
+            std::cout << (std::to_string(config.zBinSize) + " mm");
+        }
+        std::cout << std::setw(14) << result.mean_bin_occupancy
+                  << std::setw(16) << result.max_bin_occupancy
+                  << std::setw(15) << result.tests_per_seed() << std::setw(18)
+                  << result.relative_efficiency
+                  << (result.accepted ? "" : "  (rejected)") << "\n";
+    }
+
+    // Emit the best configuration
+    if (results.empty() || !results.front().accepted) {
+        std::cout << "\nNo configuration kept the efficiency of the reference"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    const seedfinder_config& best = results.front().finder_config;
+    std::cout << "\nBest configuration:\n"
+              << "  --phi-bin-deflection-coverage="
+              << best.phiBinDeflectionCoverage
+              << " --neighbor-scope-low=" << best.neighbor_scope[0]
+              << " --neighbor-scope-high=" << best.neighbor_scope[1]
+              << " --z-bin-size=" << best.zBinSize;
+    if (best.nZBinEdges >= 2) {
+        std::cout << " --z-bin-edges";
+        for (unsigned int i = 0; i < best.nZBinEdges; ++i) {
+            std::cout << " " << best.zBinEdges[i];
+        }
+    }
+    std::cout << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::detector detector_opts;
+    traccc::opts::input_data input_opts;
+    traccc::opts::track_seeding seeding_opts;
+    traccc::opts::program_options program_opts{
+        "Seeding Grid Configuration Tuning",
+        {detector_opts, input_opts, seeding_opts},
+        argc,
+        argv};
+
+    // Run the application.
+    return tuning_run(seeding_opts, input_opts, detector_opts);
+}
@@ -19,11 +19,15 @@
 #include "traccc/finding/finding_algorithm.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/batched_track_params_estimation.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 
 // performance
 #include "traccc/efficiency/finding_performance_writer.hpp"
 #include "traccc/efficiency/seeding_performance_writer.hpp"
+#include "traccc/performance/profiler.hpp"
+#include "traccc/performance/profiling_scope.hpp"
+#include "traccc/performance/profiling_summary.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/resolution/fitting_performance_writer.hpp"
 
@@ -33,6 +37,7 @@
 #include "traccc/options/input_data.hpp"
 #include "traccc/options/output_data.hpp"
 #include "traccc/options/performance.hpp"
+#include "traccc/options/profiling.hpp"
 #include "traccc/options/program_options.hpp"
 #include "traccc/options/track_finding.hpp"
 #include "traccc/options/track_propagation.hpp"
@@ -54,6 +59,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -66,7 +72,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
             const traccc::opts::track_finding& finding_opts,
             const traccc::opts::track_propagation& propagation_opts,
             const traccc::opts::track_resolution& resolution_opts,
-            const traccc::opts::performance& performance_opts) {
+            const traccc::opts::performance& performance_opts,
+            const traccc::opts::profiling& profiling_opts) {
 
     // Memory resource used by the application.
     vecmem::host_memory_resource host_mr;
@@ -144,8 +151,12 @@ int seq_run(const traccc::opts::input_data& input_opts,
     traccc::host::spacepoint_formation_algorithm sf(host_mr);
     traccc::seeding_algorithm sa(seeding_opts.seedfinder,
                                  {seeding_opts.seedfinder},
-                                 seeding_opts.seedfilter, host_mr);
+                                 seeding_opts.seedfilter, host_mr,
+                                 seeding_opts.vertexfinder);
+    traccc::seeding_algorithm::state_type seeding_state =
+        sa.make_state(host_mr);
     traccc::track_params_estimation tp(host_mr);
+    traccc::batched_track_params_estimation batched_tp(host_mr);
     finding_algorithm finding_alg(finding_cfg);
     fitting_algorithm fitting_alg(fitting_cfg);
     traccc::greedy_ambiguity_resolution_algorithm resolution_alg;
@@ -165,6 +176,19 @@ int seq_run(const traccc::opts::input_data& input_opts,
     // Timers
     traccc::performance::timing_info elapsedTimes;
 
+    // Per-stage profiling
+    if (profiling_opts.run) {
+        traccc::performance::profiler& profiler =
+            traccc::performance::profiler::instance();
+        profiler.enable(profiling_opts.buffer_size,
+                        profiling_opts.hardware_counters);
+        if (profiling_opts.hardware_counters &&
+            !traccc::performance::profiler::sampling_counters()) {
+            std::cerr << "WARNING: Hardware counters are not available ("
+                      << profiler.counters_error() << ")" << std::endl;
+        }
+    }
+
     // Loop over events
     for (unsigned int event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
@@ -182,11 +206,13 @@ int seq_run(const traccc::opts::input_data& input_opts,
 
         {  // Start measuring wall time.
             traccc::performance::timer timer_wall{"Wall time", elapsedTimes};
+            traccc::performance::profiling_scope event_scope{"Event"};
 
             traccc::io::cell_reader_output readOut(&host_mr);
 
             {
                 traccc::performance::timer timer{"Read cells", elapsedTimes};
+                traccc::performance::profiling_scope scope{"Read cells"};
                 // Read the cells from the relevant event file
                 traccc::io::read_cells(readOut, event, input_opts.directory,
                                        input_opts.format, &surface_transforms,
@@ -204,6 +230,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
             {
                 traccc::performance::timer timer{"Clusterization",
                                                  elapsedTimes};
+                traccc::performance::profiling_scope scope{
+                    "Clusterization", cells_per_event.size()};
                 measurements_per_event =
                     ca(vecmem::get_data(cells_per_event),
                        vecmem::get_data(modules_per_event));
@@ -216,6 +244,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
             {
                 traccc::performance::timer timer{"Spacepoint formation",
                                                  elapsedTimes};
+                traccc::performance::profiling_scope scope{
+                    "Spacepoint formation", measurements_per_event.size()};
                 spacepoints_per_event =
                     sf(vecmem::get_data(measurements_per_event),
                        vecmem::get_data(modules_per_event));
@@ -233,7 +263,9 @@ int seq_run(const traccc::opts::input_data& input_opts,
 
             {
                 traccc::performance::timer timer{"Seeding", elapsedTimes};
-                seeds = sa(spacepoints_per_event);
+                traccc::performance::profiling_scope scope{
+                    "Seeding", spacepoints_per_event.size()};
+                seeds = sa(spacepoints_per_event, seeding_state);
             }
             if (output_opts.directory != "") {
                 traccc::io::write(event, output_opts.directory,
@@ -248,7 +280,12 @@ int seq_run(const traccc::opts::input_data& input_opts,
             {
                 traccc::performance::timer timer{"Track params estimation",
                                                  elapsedTimes};
-                params = tp(spacepoints_per_event, seeds, field_vec);
+                traccc::performance::profiling_scope scope{
+                    "Track params estimation", seeds.size()};
+                params = seeding_opts.batched_params_estimation
+                             ? batched_tp(spacepoints_per_event, seeds,
+                                          field_vec)
+                             : tp(spacepoints_per_event, seeds, field_vec);
             }
 
             // Perform track finding and fitting only when using a Detray
@@ -257,6 +294,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
                 {
                     traccc::performance::timer timer{"Track finding",
                                                      elapsedTimes};
+                    traccc::performance::profiling_scope scope{
+                        "Track finding", params.size()};
                     track_candidates = finding_alg(
                         detector, field, measurements_per_event, params);
                 }
@@ -268,6 +307,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
                 {
                     traccc::performance::timer timer{"Track fitting",
                                                      elapsedTimes};
+                    traccc::performance::profiling_scope scope{
+                        "Track fitting", track_candidates.size()};
                     track_states =
                         fitting_alg(detector, field, track_candidates);
                 }
@@ -277,6 +318,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
             if (resolution_opts.run) {
                 traccc::performance::timer timer{"Track ambiguity resolution",
                                                  elapsedTimes};
+                traccc::performance::profiling_scope scope{
+                    "Track ambiguity resolution", track_states.size()};
                 resolved_track_states = resolution_alg(track_states);
             }
 
@@ -350,6 +393,22 @@ int seq_run(const traccc::opts::input_data& input_opts,
               << std::endl;
     std::cout << "==> Elapsed times...\n" << elapsedTimes << std::endl;
 
+    if (profiling_opts.run) {
+        traccc::performance::profiler& profiler =
+            traccc::performance::profiler::instance();
+        profiler.disable();
+        const std::vector<traccc::performance::profiling_record> records =
+            profiler.collect();
+        std::cout << "==> Profile...\n"
+                  << traccc::performance::profiling_summary{records,
+                                                            profiler.dropped()}
+                  << std::endl;
+        if (profiling_opts.trace_file.empty() == false) {
+            std::ofstream trace_file{profiling_opts.trace_file};
+            traccc::performance::write_chrome_trace(trace_file, records);
+        }
+    }
+
     return EXIT_SUCCESS;
 }
 
@@ -367,16 +426,17 @@ int main(int argc, char* argv[]) {
     traccc::opts::track_propagation propagation_opts;
     traccc::opts::track_resolution resolution_opts;
     traccc::opts::performance performance_opts;
+    traccc::opts::profiling profiling_opts;
     traccc::opts::program_options program_opts{
         "Full Tracking Chain on the Host",
         {detector_opts, input_opts, output_opts, clusterization_opts,
          seeding_opts, finding_opts, propagation_opts, resolution_opts,
-         performance_opts},
+         performance_opts, profiling_opts},
         argc,
         argv};
 
     // Run the application.
     return seq_run(input_opts, output_opts, detector_opts, clusterization_opts,
                    seeding_opts, finding_opts, propagation_opts,
-                   resolution_opts, performance_opts);
+                   resolution_opts, performance_opts, profiling_opts);
 }
@@ -0,0 +1,148 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "full_chain_algorithm.hpp"
+
+// System include(s).
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace traccc::host_parallel {
+
+full_chain_algorithm::full_chain_algorithm(
+    vecmem::memory_resource& host_mr,
+    const clustering_config& clustering_config,
+    const seedfinder_config& finder_config,
+    const spacepoint_grid_config& grid_config,
+    const seedfilter_config& filter_config,
+    const finding_algorithm::config_type& finding_config,
+    const fitting_algorithm::config_type& fitting_config,
+    host_detector_type* detector, std::shared_ptr<thread_pool> pool)
+    : m_host_mr(host_mr),
+      m_pool((pool != nullptr)
+                 ? std::move(pool)
+                 : throw std::invalid_argument{"No thread pool was provided"}),
+      m_cached_mr(
+          std::make_unique<vecmem::binary_page_memory_resource>(m_host_mr)),
+      m_copy(),
+      m_field_vec{0.f, 0.f, finder_config.bFieldInZ},
+      m_field(detray::bfield::create_const_field(m_field_vec)),
+      m_detector(detector),
+      m_clusterization(memory_resource{*m_cached_mr, &m_host_mr}, m_copy,
+                       *m_pool, clustering_config),
+      m_measurement_sorting(m_copy, *m_pool),
+      m_spacepoint_formation(memory_resource{*m_cached_mr, &m_host_mr}, m_copy,
+                             *m_pool),
+      m_seeding(finder_config, grid_config, filter_config,
+                memory_resource{*m_cached_mr, &m_host_mr}, m_copy, *m_pool),
+      m_track_parameter_estimation(memory_resource{*m_cached_mr, &m_host_mr},
+                                   m_copy, *m_pool),
+      m_finding(finding_config, memory_resource{*m_cached_mr, &m_host_mr},
+                m_copy, *m_pool),
+      m_fitting(fitting_config, memory_resource{*m_cached_mr, &m_host_mr},
+                m_copy, *m_pool),
+      m_clustering_config(clustering_config),
+      m_finder_config(finder_config),
+      m_grid_config(grid_config),
+      m_filter_config(filter_config),
+      m_finding_config(finding_config),
+      m_fitting_config(fitting_config) {
+
+    // Tell the user how many threads are being used.
+    std::cout << "Using " << m_pool->concurrency() << " CPU thread(s)"
+              << std::endl;
+
+    // The detector can be used directly from host memory.
+    if (m_detector != nullptr) {
+        m_detector_view = detray::get_data(*m_detector);
+    }
+}
+
+full_chain_algorithm::full_chain_algorithm(const full_chain_algorithm& parent)
+    : m_host_mr(parent.m_host_mr),
+      m_pool(parent.m_pool),
+      m_cached_mr(
+          std::make_unique<vecmem::binary_page_memory_resource>(m_host_mr)),
+      m_copy(),
+      m_field_vec(parent.m_field_vec),
+      m_field(parent.m_field),
+      m_detector(parent.m_detector),
+      m_detector_view(parent.m_detector_view),
+      m_clusterization(memory_resource{*m_cached_mr, &m_host_mr}, m_copy,
+                       *m_pool, parent.m_clustering_config),
+      m_measurement_sorting(m_copy, *m_pool),
+      m_spacepoint_formation(memory_resource{*m_cached_mr, &m_host_mr}, m_copy,
+                             *m_pool),
+      m_seeding(parent.m_finder_config, parent.m_grid_config,
+                parent.m_filter_config,
+                memory_resource{*m_cached_mr, &m_host_mr}, m_copy, *m_pool),
+      m_track_parameter_estimation(memory_resource{*m_cached_mr, &m_host_mr},
+                                   m_copy, *m_pool),
+      m_finding(parent.m_finding_config,
+                memory_resource{*m_cached_mr, &m_host_mr}, m_copy, *m_pool),
+      m_fitting(parent.m_fitting_config,
+                memory_resource{*m_cached_mr, &m_host_mr}, m_copy, *m_pool),
+      m_clustering_config(parent.m_clustering_config),
+      m_finder_config(parent.m_finder_config),
+      m_grid_config(parent.m_grid_config),
+      m_filter_config(parent.m_filter_config),
+      m_finding_config(parent.m_finding_config),
+      m_fitting_config(parent.m_fitting_config) {}
+
+full_chain_algorithm::~full_chain_algorithm() = default;
+
+full_chain_algorithm::output_type full_chain_algorithm::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    // Run the clusterization.
+    const clusterization_algorithm::output_type measurements =
+        m_clusterization(vecmem::get_data(cells), vecmem::get_data(modules));
+    m_measurement_sorting(measurements);
+
+    // Run the seed-finding.
+    const spacepoint_formation_algorithm::output_type spacepoints =
+        m_spacepoint_formation(measurements, vecmem::get_data(modules));
+    const track_params_estimation::output_type track_params =
+        m_track_parameter_estimation(spacepoints, m_seeding(spacepoints),
+                                     m_field_vec);
+
+    // If we have a Detray detector, run the track finding and fitting.
+    if (m_detector != nullptr) {
+
+        // Create the buffer needed by track finding and fitting.
+        auto navigation_buffer = detray::create_candidates_buffer(
+            *m_detector,
+            m_finding_config.navigation_buffer_size_scaler *
+                m_copy.get_size(track_params),
+            *m_cached_mr, &m_host_mr);
+
+        // Run the track finding.
+        const finding_algorithm::output_type track_candidates =
+            m_finding(m_detector_view, m_field, navigation_buffer,
+                      measurements, track_params);
+
+        // Run the track fitting.
+        const fitting_algorithm::output_type track_states =
+            m_fitting(m_detector_view, m_field, navigation_buffer,
+                      track_candidates);
+
+        // Copy a limited amount of result data out of the cached memory.
+        output_type result{&m_host_mr};
+        m_copy(track_states.headers, result)->wait();
+        return result;
+
+    }
+    // If not, return a dummy object.
+    else {
+        return {};
+    }
+}
+
+}  // namespace traccc::host_parallel
@@ -0,0 +1,18 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/throughput_mt.hpp"
+
+#include "full_chain_algorithm.hpp"
+
+int main(int argc, char* argv[]) {
+
+    // Execute the throughput test.
+    return traccc::throughput_mt<traccc::host_parallel::full_chain_algorithm>(
+        "Multi-threaded host_parallel CPU throughput tests", argc, argv);
+}
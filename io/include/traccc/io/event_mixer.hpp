@@ -0,0 +1,75 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/demonstrator_edm.hpp"
+#include "traccc/io/reader_edm.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace traccc::io {
+
+/// Tool overlaying the cells of (minimum bias) library events
+///
+/// It can be used to create high pileup events cheaply, out of a library of
+/// low pileup events that were simulated / read in only once. The cells of
+/// the overlaid events are merged per module, with cells appearing on the
+/// same channel of the same module being combined into a single cell.
+///
+class event_mixer {
+
+    public:
+    /// Random number generator used for choosing the library events
+    using generator_type = std::mt19937_64;
+
+    /// Constructor with the library of events to mix
+    ///
+    /// @param library The events to overlay into mixed events
+    ///
+    explicit event_mixer(const demonstrator_input& library);
+
+    /// @return The number of events in the library
+    std::size_t size() const;
+
+    /// Choose library events to overlay into one mixed event
+    ///
+    /// Every library event is chosen at most once, unless more events are
+    /// requested than there are in the library. In which case all events are
+    /// used as many times as needed, in a random order.
+    ///
+    /// @param n_events The number of library events to choose
+    /// @param generator The random number generator to use
+    /// @return The indices of the chosen library events
+    ///
+    std::vector<std::size_t> choose(std::size_t n_events,
+                                    generator_type& generator) const;
+
+    /// Overlay a set of library events
+    ///
+    /// The modules of the output are ordered by their surface link, and the
+    /// cells are ordered by module and channel, the same way as the cell
+    /// readers would order them.
+    ///
+    /// @param out The mixed event (cells and modules), which gets overwritten
+    /// @param events The indices of the library events to overlay
+    ///
+    void operator()(cell_reader_output& out,
+                    const std::vector<std::size_t>& events) const;
+
+    private:
+    /// The library of events to mix
+    std::reference_wrapper<const demonstrator_input> m_library;
+
+};  // class event_mixer
+
+}  // namespace traccc::io
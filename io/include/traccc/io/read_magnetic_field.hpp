@@ -0,0 +1,30 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/utils/field_map.hpp"
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::io {
+
+/// Read a magnetic field map from a covfie format file
+///
+/// The file needs to hold a field on a regular grid, with an axis aligned
+/// (affine) transformation into the grid, as written for the nearest
+/// neighbour lookup by covfie. The field values are read on all grid nodes,
+/// to be interpolated between them by the returned map.
+///
+/// @param filename The name of the file to read
+/// @return The magnetic field map
+///
+field_map read_magnetic_field(std::string_view filename);
+
+}  // namespace traccc::io
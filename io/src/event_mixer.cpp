@@ -0,0 +1,143 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/event_mixer.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+
+namespace traccc::io {
+
+namespace {
+
+/// Comparator used for sorting cells. The same ordering that the cell readers
+/// use, which the clusterization algorithm relies on.
+struct cell_order {
+    bool operator()(const cell& lhs, const cell& rhs) const {
+        if (lhs.module_link != rhs.module_link) {
+            return lhs.module_link < rhs.module_link;
+        } else if (lhs.channel1 != rhs.channel1) {
+            return (lhs.channel1 < rhs.channel1);
+        } else {
+            return (lhs.channel0 < rhs.channel0);
+        }
+    }
+};  // struct cell_order
+
+/// Check whether two cells are on the same channel of the same module
+bool same_channel(const cell& lhs, const cell& rhs) {
+    return ((lhs.module_link == rhs.module_link) &&
+            (lhs.channel0 == rhs.channel0) && (lhs.channel1 == rhs.channel1));
+}
+
+}  // namespace
+
+event_mixer::event_mixer(const demonstrator_input& library)
+    : m_library(library) {}
+
+std::size_t event_mixer::size() const {
+
+    return m_library.get().size();
+}
+
+std::vector<std::size_t> event_mixer::choose(std::size_t n_events,
+                                             generator_type& generator) const {
+
+    if (size() == 0) {
+        throw std::logic_error("Cannot choose events from an empty library");
+    }
+
+    // Draw random permutations of the library, until enough events are
+    // chosen.
+    std::vector<std::size_t> result;
+    result.reserve(n_events);
+    std::vector<std::size_t> permutation(size());
+    while (result.size() < n_events) {
+        std::iota(permutation.begin(), permutation.end(), 0u);
+        std::shuffle(permutation.begin(), permutation.end(), generator);
+        const std::size_t n =
+            std::min(permutation.size(), n_events - result.size());
+        result.insert(result.end(), permutation.begin(),
+                      permutation.begin() + static_cast<std::ptrdiff_t>(n));
+    }
+    return result;
+}
+
+void event_mixer::operator()(cell_reader_output& out,
+                             const std::vector<std::size_t>& events) const {
+
+    const demonstrator_input& library = m_library.get();
+
+    // Collect the (unique) modules of all overlaid events. Module descriptions
+    // only depend on the geometry, so the first instance of each is kept.
+    std::map<detray::geometry::barcode, const cell_module*> modules;
+    std::size_t n_cells = 0;
+    for (std::size_t event : events) {
+        if (event >= library.size()) {
+            throw std::out_of_range("Library event index out of range");
+        }
+        for (const cell_module& module : library[event].modules) {
+            modules.insert({module.surface_link, &module});
+        }
+        n_cells += library[event].cells.size();
+    }
+
+    // Set up the output modules, and remember their positions.
+    out.modules.clear();
+    out.modules.reserve(modules.size());
+    std::map<detray::geometry::barcode, cell::link_type> module_links;
+    for (const auto& [barcode, module] : modules) {
+        module_links.insert({barcode, static_cast<cell::link_type>(
+                                          out.modules.size())});
+        out.modules.push_back(*module);
+    }
+
+    // Collect all cells, pointing them at the merged modules.
+    out.cells.clear();
+    out.cells.reserve(n_cells);
+    std::vector<cell::link_type> link_map;
+    for (std::size_t event : events) {
+        const cell_reader_output& input = library[event];
+        link_map.resize(input.modules.size());
+        for (std::size_t i = 0; i < input.modules.size(); ++i) {
+            link_map[i] = module_links.at(input.modules[i].surface_link);
+        }
+        for (const cell& c : input.cells) {
+            assert(c.module_link < link_map.size());
+            out.cells.push_back(c);
+            out.cells.back().module_link = link_map[c.module_link];
+        }
+    }
+    std::sort(out.cells.begin(), out.cells.end(), cell_order());
+
+    // Merge the cells appearing on the same channel. Summing up their
+    // activations, and keeping the earliest time.
+    auto last = out.cells.begin();
+    for (auto it = out.cells.begin(); it != out.cells.end(); ++it) {
+        if (it == last) {
+            continue;
+        }
+        if (same_channel(*last, *it)) {
+            last->activation += it->activation;
+            last->time = std::min(last->time, it->time);
+        } else {
+            *(++last) = *it;
+        }
+    }
+    if (!out.cells.empty()) {
+        out.cells.resize(
+            static_cast<std::size_t>(last - out.cells.begin()) + 1u);
+    }
+}
+
+}  // namespace traccc::io
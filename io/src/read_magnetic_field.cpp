@@ -0,0 +1,102 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/read_magnetic_field.hpp"
+
+#include "traccc/io/utils.hpp"
+
+// Covfie include(s).
+#include <covfie/core/backend/primitive/array.hpp>
+#include <covfie/core/backend/transformer/affine.hpp>
+#include <covfie/core/backend/transformer/nearest_neighbour.hpp>
+#include <covfie/core/backend/transformer/strided.hpp>
+#include <covfie/core/field.hpp>
+#include <covfie/core/field_view.hpp>
+#include <covfie/core/vector.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Backend of the magnetic field map files
+using covfie_backend_t = covfie::backend::affine<
+    covfie::backend::nearest_neighbour<covfie::backend::strided<
+        covfie::vector::size3,
+        covfie::backend::array<covfie::vector::float3>>>>;
+
+}  // namespace
+
+namespace traccc::io {
+
+field_map read_magnetic_field(std::string_view filename) {
+
+    // Read the covfie field.
+    const std::string full_filename = get_absolute_path(filename);
+    std::ifstream file(full_filename, std::ifstream::binary);
+    if (!file.good()) {
+        throw std::runtime_error("Failed to open file: " + full_filename);
+    }
+    const covfie::field<covfie_backend_t> field(file);
+
+    // The transformation from global into grid coordinates, and the size of
+    // the grid.
+    const auto& transform = field.backend().get_configuration();
+    const auto& sizes =
+        field.backend().get_backend().get_backend().get_configuration();
+
+    darray<scalar, 3> min, spacing;
+    darray<field_map::index_type, 3> n_nodes;
+    for (std::size_t i = 0; i < 3u; ++i) {
+        for (std::size_t j = 0; j < 3u; ++j) {
+            if ((i != j) && (transform(i, j) != 0.f)) {
+                throw std::runtime_error(
+                    "Only axis aligned field maps are supported");
+            }
+        }
+        if (!(transform(i, i) > 0.f) || (sizes[i] == 0u)) {
+            throw std::runtime_error("Invalid field map grid in: " +
+                                     full_filename);
+        }
+        spacing[i] = static_cast<scalar>(1.f / transform(i, i));
+        min[i] = static_cast<scalar>(-transform(i, 3) / transform(i, i));
+        n_nodes[i] = static_cast<field_map::index_type>(sizes[i]);
+    }
+
+    // Sample the field on all of the grid nodes.
+    const std::size_t n_total =
+        static_cast<std::size_t>(n_nodes[0]) * n_nodes[1] * n_nodes[2];
+    std::vector<scalar> bx, by, bz;
+    bx.reserve(n_total);
+    by.reserve(n_total);
+    bz.reserve(n_total);
+    const covfie::field<covfie_backend_t>::view_t view(field);
+    for (field_map::index_type iz = 0; iz < n_nodes[2]; ++iz) {
+        for (field_map::index_type iy = 0; iy < n_nodes[1]; ++iy) {
+            for (field_map::index_type ix = 0; ix < n_nodes[0]; ++ix) {
+                const auto b =
+                    view.at(min[0] + static_cast<scalar>(ix) * spacing[0],
+                            min[1] + static_cast<scalar>(iy) * spacing[1],
+                            min[2] + static_cast<scalar>(iz) * spacing[2]);
+                bx.push_back(b[0]);
+                by.push_back(b[1]);
+                bz.push_back(b[2]);
+            }
+        }
+    }
+
+    return field_map(min, spacing, n_nodes, std::move(bx), std::move(by),
+                     std::move(bz));
+}
+
+}  // namespace traccc::io
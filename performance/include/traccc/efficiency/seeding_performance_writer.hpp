@@ -47,7 +47,8 @@ class seeding_performance_writer {
             {"Eta", plot_helpers::binning("#eta", 40, -4.f, 4.f)},
             {"Phi", plot_helpers::binning("#phi", 100, -3.15f, 3.15f)},
             {"Pt", plot_helpers::binning("p_{T} [GeV/c]", 40, 0.f, 100.f)},
-            {"Num", plot_helpers::binning("N", 30, -0.5f, 29.5f)}};
+            {"Num", plot_helpers::binning("N", 30, -0.5f, 29.5f)},
+            {"Vz", plot_helpers::binning("v_{z} [mm]", 100, -250.f, 250.f)}};
 
         /// Cut values
         scalar pT_cut = 1.f * traccc::unit<scalar>::GeV;
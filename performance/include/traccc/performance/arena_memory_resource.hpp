@@ -0,0 +1,152 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Statistics about the usage of an arena memory resource
+struct arena_statistics {
+
+    /// Number of times that the arena was reset
+    std::size_t resets = 0;
+    /// Number of memory blocks allocated from the upstream resource
+    std::size_t upstream_allocations = 0;
+    /// Total size of the memory blocks held by the arena
+    std::size_t capacity_bytes = 0;
+    /// High-water mark of the bytes handed out between two resets
+    std::size_t peak_bytes = 0;
+
+    /// Accumulate the statistics of another arena
+    arena_statistics& operator+=(const arena_statistics& rhs);
+
+};  // struct arena_statistics
+
+/// Printout helper for @c traccc::performance::arena_statistics
+std::ostream& operator<<(std::ostream& out, const arena_statistics& stats);
+
+/// Bump allocator for the per-event allocations of the algorithms
+///
+/// Allocations are served by moving a pointer forward in large blocks of
+/// memory taken from an upstream resource, and de-allocations are ignored.
+/// All memory handed out since the last call to @c mark() is reclaimed at
+/// once by @c reset(), which is meant to be called at the end of every
+/// event. The blocks are kept for the next event, so once the arena has
+/// grown to the size of the largest event, it does not need to talk to its
+/// upstream resource anymore.
+///
+/// The resource is not thread-safe. It is meant to be used by one thread
+/// (algorithm instance) at a time.
+///
+class arena_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// The default size of the memory blocks
+    static constexpr std::size_t default_block_size = 16u * 1024u * 1024u;
+
+    /// Constructor on top of an upstream memory resource
+    ///
+    /// @param upstream The resource to allocate the memory blocks from
+    /// @param block_size The (minimum) size of the memory blocks
+    ///
+    explicit arena_memory_resource(
+        vecmem::memory_resource& upstream,
+        std::size_t block_size = default_block_size);
+    /// Destructor, returning all memory blocks to the upstream resource
+    ~arena_memory_resource() override;
+
+    /// Make all allocations done so far survive future resets
+    ///
+    /// Useful for keeping the allocations made while constructing the
+    /// algorithms that use the arena.
+    ///
+    void mark();
+    /// Reclaim all memory allocated since the last call to @c mark()
+    ///
+    /// @throws std::logic_error if some of that memory was not de-allocated
+    ///         yet
+    ///
+    void reset();
+
+    /// Get the statistics collected so far
+    arena_statistics statistics() const;
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory from the current memory block
+    void* do_allocate(std::size_t size, std::size_t alignment) override;
+    /// Ignore the de-allocation, apart from bookkeeping
+    ///
+    /// @throws std::logic_error if the memory was not allocated by the
+    ///         arena, or more memory is de-allocated than was allocated
+    ///         before/after the last mark
+    ///
+    void do_deallocate(void* ptr, std::size_t size,
+                       std::size_t alignment) override;
+    /// Compare the equality of two memory resources
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// A memory block received from the upstream resource
+    struct block {
+        /// Start of the block
+        std::byte* data = nullptr;
+        /// Size of the block
+        std::size_t size = 0;
+        /// Alignment of the block
+        std::size_t alignment = 0;
+    };
+
+    /// Position inside of the memory blocks
+    struct position {
+        /// Index of the block
+        std::size_t block = 0;
+        /// Offset inside of the block
+        std::size_t offset = 0;
+    };
+
+    /// Check whether a pointer was handed out before the last mark
+    ///
+    /// @throws std::logic_error if the pointer is not inside of the arena
+    ///
+    bool before_mark(const void* ptr) const;
+
+    /// The upstream memory resource
+    vecmem::memory_resource& m_upstream;
+    /// The (minimum) size of the memory blocks
+    std::size_t m_block_size;
+    /// The memory blocks of the arena
+    std::vector<block> m_blocks;
+    /// The current position of the arena
+    position m_current;
+    /// The position to go back to in @c reset()
+    position m_mark;
+
+    /// Number of live allocations made before the last mark
+    std::size_t m_marked_allocations = 0;
+    /// Number of live allocations made since the last mark
+    std::size_t m_live_allocations = 0;
+    /// Number of bytes handed out since the last reset
+    std::size_t m_used_bytes = 0;
+    /// Statistics of the arena
+    arena_statistics m_stats;
+
+};  // class arena_memory_resource
+
+}  // namespace traccc::performance
@@ -0,0 +1,90 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+
+namespace traccc::performance {
+
+/// Statistics about the allocations done through a memory resource
+struct allocator_statistics {
+
+    /// Number of allocations
+    std::size_t allocations = 0;
+    /// Number of deallocations
+    std::size_t deallocations = 0;
+    /// Total number of bytes allocated
+    std::size_t allocated_bytes = 0;
+    /// High-water mark of the bytes allocated at the same time
+    std::size_t peak_bytes = 0;
+
+    /// Accumulate the statistics of another resource
+    ///
+    /// Note that the peak values of the two resources are simply summed up,
+    /// providing an upper limit for the combined high-water mark.
+    ///
+    allocator_statistics& operator+=(const allocator_statistics& rhs);
+
+};  // struct allocator_statistics
+
+/// Printout helper for @c traccc::performance::allocator_statistics
+std::ostream& operator<<(std::ostream& out, const allocator_statistics& stats);
+
+/// Memory resource counting the allocations made through it
+///
+/// Forwards all allocations to an upstream resource, while keeping track of
+/// the number and size of the allocations. It is thread-safe, as long as the
+/// upstream resource is.
+///
+class counting_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Constructor on top of an upstream memory resource
+    explicit counting_memory_resource(vecmem::memory_resource& upstream);
+
+    /// Get the statistics collected so far
+    allocator_statistics statistics() const;
+    /// Reset the statistics (keeping the currently allocated bytes in mind)
+    void reset_statistics();
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory through the upstream resource
+    void* do_allocate(std::size_t size, std::size_t alignment) override;
+    /// De-allocate memory through the upstream resource
+    void do_deallocate(void* ptr, std::size_t size,
+                       std::size_t alignment) override;
+    /// Compare the equality of two memory resources
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// The upstream memory resource
+    vecmem::memory_resource& m_upstream;
+
+    /// @name Counters
+    /// @{
+    std::atomic<std::size_t> m_allocations{0};
+    std::atomic<std::size_t> m_deallocations{0};
+    std::atomic<std::size_t> m_allocated_bytes{0};
+    std::atomic<std::size_t> m_current_bytes{0};
+    std::atomic<std::size_t> m_peak_bytes{0};
+    /// @}
+
+};  // class counting_memory_resource
+
+}  // namespace traccc::performance
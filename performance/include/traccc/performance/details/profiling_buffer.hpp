@@ -0,0 +1,112 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/hardware_counters.hpp"
+#include "traccc/performance/profiling_record.hpp"
+
+// System include(s).
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace traccc::performance::details {
+
+/// Fixed size, single-producer/single-consumer ring buffer of profiling records
+///
+/// Every thread that records profiling scopes owns exactly one of these
+/// buffers. The owning thread is the only one ever writing into it, without
+/// taking any locks. When the buffer is full, the oldest records get
+/// overwritten, and are accounted for as "dropped" records once the buffer
+/// is drained.
+///
+/// Every slot of the buffer carries a sequence number, which works as a
+/// seqlock. The producer invalidates it before writing a record into the
+/// slot, and publishes the index of the record in it afterwards. The
+/// consumer only keeps the records whose sequence number was the expected
+/// one both before and after copying them, and counts the rest (overwritten
+/// while being read) as dropped.
+///
+/// The consumer side (@c drain(), @c clear() and @c dropped()) must not be
+/// called concurrently from multiple threads.
+///
+class profiling_buffer {
+
+    public:
+    /// Constructor with the (rounded up to a power of 2) capacity of the buffer
+    ///
+    /// @param capacity The minimum number of records to keep in memory
+    /// @param thread   The (profiler assigned) index of the owning thread
+    ///
+    profiling_buffer(std::size_t capacity, std::uint32_t thread);
+
+    /// Add a record to the buffer. Only to be called by the owning thread.
+    void push(const profiling_record& record) {
+
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        slot& s = m_slots[head & m_mask];
+        s.m_sequence.store(0u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        s.m_record = record;
+        s.m_sequence.store(head + 1u, std::memory_order_release);
+        m_head.store(head + 1u, std::memory_order_release);
+    }
+
+    /// Move all records not read out yet into an output vector
+    ///
+    /// Can be called from any thread while the owning thread is still
+    /// recording.
+    ///
+    /// @param out The vector to append the records to
+    ///
+    void drain(std::vector<profiling_record>& out);
+
+    /// Forget about all records currently held by the buffer
+    void clear();
+
+    /// The index of the thread owning this buffer
+    std::uint32_t thread() const { return m_thread; }
+    /// The number of records that were overwritten before being drained
+    std::size_t dropped() const;
+
+    /// Current nesting depth of the owning thread's profiling scopes
+    ///
+    /// Only ever accessed by the owning thread.
+    ///
+    std::uint32_t m_depth = 0;
+    /// Hardware counters of the owning thread, if they are being sampled
+    std::unique_ptr<counter_group> m_counters;
+
+    private:
+    /// A single record, with its sequence number
+    struct slot {
+        /// One plus the index of the record held, or 0 while being written
+        std::atomic<std::size_t> m_sequence{0u};
+        /// The record itself
+        profiling_record m_record;
+    };
+
+    /// Storage for the records
+    std::vector<slot> m_slots;
+    /// Mask used for turning the monotonic indices into storage indices
+    std::size_t m_mask;
+    /// The index of the thread owning this buffer
+    std::uint32_t m_thread;
+    /// Total number of records written into the buffer (producer side)
+    std::atomic<std::size_t> m_head{0u};
+    /// Total number of records read out of the buffer (consumer side)
+    std::atomic<std::size_t> m_tail{0u};
+    /// Number of records lost to overwriting
+    std::atomic<std::size_t> m_dropped{0u};
+
+};  // class profiling_buffer
+
+}  // namespace traccc::performance::details
@@ -0,0 +1,93 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace traccc::performance {
+
+/// The ways in which the throughput tests can pick the events to process
+enum class event_sampling {
+    /// Uniformly random events, drawn with replacement
+    random,
+    /// The input events in order, wrapping around at the end
+    sequential,
+    /// A new random permutation of the input events on every pass
+    shuffled,
+    /// A user provided list of events, wrapping around at the end
+    list
+};
+
+/// Get the sampling mode belonging to a (command line) name
+///
+/// @param name One of "random", "sequential", "shuffled" or "list"
+/// @return The sampling mode with the given name
+/// @throws std::invalid_argument if the name is not recognised
+///
+event_sampling event_sampling_from_string(std::string_view name);
+
+/// Printout helper for @c traccc::performance::event_sampling
+std::ostream& operator<<(std::ostream& out, event_sampling sampling);
+
+/// Reproducible schedule of the events to process in a throughput test
+///
+/// The same mode, seed and number of input events always result in the
+/// same sequence of event indices, so that measurements can be repeated
+/// on exactly the same workload.
+///
+class event_schedule {
+
+    public:
+    /// Constructor
+    ///
+    /// @param mode The way in which the events should be picked
+    /// @param n_input_events The number of events available in memory
+    /// @param seed The seed of the random number generator
+    /// @param list The events to process, used in @c event_sampling::list
+    ///             mode
+    /// @throws std::invalid_argument for an invalid configuration
+    ///
+    event_schedule(event_sampling mode, std::size_t n_input_events,
+                   unsigned int seed = 42u,
+                   const std::vector<std::size_t>& list = {});
+
+    /// Get the next events to process
+    ///
+    /// @param n_events The number of events to schedule
+    /// @return The indices of the next @c n_events events
+    ///
+    std::vector<std::size_t> next(std::size_t n_events);
+
+    /// Start the schedule from the beginning again
+    void reset();
+
+    private:
+    /// Get the index of the next event to process
+    std::size_t next_event();
+
+    /// The sampling mode
+    event_sampling m_mode;
+    /// The number of events available in memory
+    std::size_t m_n_input_events;
+    /// The seed of the random number generator
+    unsigned int m_seed;
+    /// The order of the events in the non-random modes
+    std::vector<std::size_t> m_order;
+    /// Position in @c m_order
+    std::size_t m_position = 0;
+    /// The random number generator
+    std::mt19937_64 m_generator;
+
+};  // class event_schedule
+
+}  // namespace traccc::performance
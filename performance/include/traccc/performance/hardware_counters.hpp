@@ -0,0 +1,124 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace traccc::performance {
+
+/// Values of the hardware performance counters sampled for a chain stage
+struct hardware_counters {
+
+    /// Identifiers of the individual counters
+    enum counter : std::size_t {
+        cycles = 0,
+        instructions = 1,
+        cache_misses = 2,
+        branch_misses = 3,
+        n_counters = 4
+    };
+
+    /// The counter values
+    std::array<std::uint64_t, n_counters> values{0, 0, 0, 0};
+    /// Bit mask of the counters that could actually be measured
+    unsigned int available = 0u;
+
+    /// Check if a given counter was measured
+    bool has(counter c) const { return (available & (1u << c)) != 0u; }
+    /// Get the value of a given counter
+    std::uint64_t operator[](counter c) const { return values[c]; }
+
+    /// Instructions per cycle, or a negative value if not available
+    double ipc() const;
+
+    /// Accumulate the values of another measurement
+    hardware_counters& operator+=(const hardware_counters& rhs);
+
+};  // struct hardware_counters
+
+/// Difference between two samplings of the counters
+hardware_counters operator-(const hardware_counters& lhs,
+                            const hardware_counters& rhs);
+
+/// Group of hardware performance counters of the calling thread
+///
+/// Uses Linux's @c perf_event_open to count cycles, instructions, (last level)
+/// cache misses and branch mispredictions of the thread that created the
+/// object. When the counters are not accessible (non-Linux systems, virtual
+/// machines, restrictive @c perf_event_paranoid settings...), the group is
+/// marked as unavailable, and all samplings return empty results.
+///
+class counter_group {
+
+    public:
+    /// Open the counters for the calling thread
+    counter_group();
+    /// Close the counters
+    ~counter_group();
+
+    /// No copying of the group
+    counter_group(const counter_group&) = delete;
+    counter_group& operator=(const counter_group&) = delete;
+
+    /// Check whether (at least some of) the counters could be opened
+    bool available() const { return m_leader >= 0; }
+    /// Description of why the counters are not available
+    const std::string& error() const { return m_error; }
+
+    /// Sample the current values of the counters
+    hardware_counters read() const;
+
+    private:
+    /// File descriptor of the group leader
+    int m_leader = -1;
+    /// File descriptors of all counters (-1 for the unavailable ones)
+    std::array<int, hardware_counters::n_counters> m_fds{-1, -1, -1, -1};
+    /// Bit mask of the available counters
+    unsigned int m_available = 0u;
+    /// Error message, if the counters are unavailable
+    std::string m_error;
+
+};  // class counter_group
+
+/// Object used for measuring the hardware counters of a code block
+///
+/// Counters sampled at construction and at destruction, with the difference
+/// added to the result object.
+///
+class counter_scope {
+
+    public:
+    /// Start the measurement
+    ///
+    /// @param group The counters (of the current thread) to use
+    /// @param result The object to add the measured values to
+    ///
+    counter_scope(const counter_group& group, hardware_counters& result);
+
+    /// End the measurement
+    ~counter_scope();
+
+    /// No copying of the scope
+    counter_scope(const counter_scope&) = delete;
+    counter_scope& operator=(const counter_scope&) = delete;
+
+    private:
+    /// The counters used
+    const counter_group& m_group;
+    /// The counter values at the start of the scope
+    hardware_counters m_start;
+    /// The object to add the measured values to
+    hardware_counters& m_result;
+
+};  // class counter_scope
+
+}  // namespace traccc::performance
@@ -0,0 +1,118 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/details/profiling_buffer.hpp"
+#include "traccc/performance/profiling_record.hpp"
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Process-wide collector of @c traccc::performance::profiling_scope records
+///
+/// The profiler is disabled by default, in which case profiling scopes do not
+/// do anything beyond checking a single atomic flag. Once enabled, every
+/// thread writes its records into its own ring buffer, which get merged only
+/// when @c collect() is called.
+///
+class profiler {
+
+    public:
+    /// Default number of records kept per thread
+    static constexpr std::size_t default_buffer_capacity = 1u << 16;
+
+    /// Access the profiler of the process
+    static profiler& instance();
+
+    /// Check whether profiling is currently enabled
+    static bool enabled() noexcept {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Start recording profiling scopes
+    ///
+    /// When hardware counters are requested but are not accessible, the
+    /// profiler falls back to only recording the execution times. Which can
+    /// be checked with @c sampling_counters() afterwards.
+    ///
+    /// @param buffer_capacity The number of records to keep for each thread
+    ///                        before starting to overwrite the oldest ones
+    /// @param hardware_counters Whether to sample hardware performance
+    ///                          counters at the start and end of every scope
+    ///
+    void enable(std::size_t buffer_capacity = default_buffer_capacity,
+                bool hardware_counters = false);
+    /// Stop recording profiling scopes
+    void disable();
+
+    /// Nanoseconds elapsed since the profiler was set up
+    std::uint64_t now() const {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_epoch)
+                .count());
+    }
+
+    /// Check whether hardware counters are sampled by the profiling scopes
+    static bool sampling_counters() noexcept {
+        return s_sample_counters.load(std::memory_order_relaxed);
+    }
+    /// Reason for the hardware counters not being available
+    const std::string& counters_error() const { return m_counters_error; }
+
+    /// Get the buffer of the calling thread, creating it if necessary
+    details::profiling_buffer& local_buffer();
+
+    /// Collect all records from all threads that were not collected yet
+    ///
+    /// @return The records, ordered by their start time
+    ///
+    std::vector<profiling_record> collect();
+
+    /// Get the total number of records lost to buffer overflows
+    std::size_t dropped() const;
+
+    /// Forget about all records not collected yet
+    ///
+    /// Must only be called while no thread is executing a profiling scope.
+    ///
+    void reset();
+
+    private:
+    /// Private constructor, the profiler is a singleton
+    profiler();
+
+    /// Flag showing whether profiling is enabled
+    static std::atomic<bool> s_enabled;
+    /// Flag showing whether hardware counters are sampled
+    static std::atomic<bool> s_sample_counters;
+    /// Reason for the hardware counters not being available
+    std::string m_counters_error;
+
+    /// Reference point for all of the recorded times
+    std::chrono::steady_clock::time_point m_epoch;
+    /// Capacity of newly created thread buffers
+    std::size_t m_buffer_capacity = default_buffer_capacity;
+    /// Mutex protecting the list of buffers
+    mutable std::mutex m_mutex;
+    /// The buffers of all threads that recorded something so far
+    std::vector<std::unique_ptr<details::profiling_buffer> > m_buffers;
+
+};  // class profiler
+
+}  // namespace traccc::performance
@@ -0,0 +1,43 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/hardware_counters.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <string_view>
+
+namespace traccc::performance {
+
+/// A single measurement taken by @c traccc::performance::profiling_scope
+struct profiling_record {
+
+    /// Name of the profiled stage
+    ///
+    /// The viewed string must outlive the profiler. Stage names are meant to
+    /// be string literals.
+    ///
+    std::string_view name;
+    /// Start of the scope, in nanoseconds since the profiler was set up
+    std::uint64_t start = 0;
+    /// End of the scope, in nanoseconds since the profiler was set up
+    std::uint64_t end = 0;
+    /// Number of items (cells, measurements, seeds, tracks...) processed
+    std::uint64_t items = 0;
+    /// Nesting depth of the scope on its thread
+    std::uint32_t depth = 0;
+    /// Index of the thread that recorded the scope
+    std::uint32_t thread = 0;
+    /// Hardware counter values measured for the scope (if requested)
+    hardware_counters counters;
+
+};  // struct profiling_record
+
+}  // namespace traccc::performance
@@ -0,0 +1,83 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/details/profiling_buffer.hpp"
+#include "traccc/performance/hardware_counters.hpp"
+#include "traccc/performance/profiler.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <string_view>
+
+namespace traccc::performance {
+
+/// Scope measuring the execution time of a (possibly nested) chain stage
+///
+/// Start time measured at construction, end time at destruction. The
+/// measurement is recorded into @c traccc::performance::profiler, but only if
+/// profiling was enabled when the scope was opened. Otherwise the scope costs
+/// a single relaxed atomic load. If requested from the profiler, the hardware
+/// counters of the thread are sampled as well.
+///
+class profiling_scope {
+
+    public:
+    /// Start the measurement
+    ///
+    /// @param name Name of the stage, which has to outlive the profiler
+    ///             (a string literal)
+    /// @param items Number of items processed by the stage, if known upfront
+    ///
+    explicit profiling_scope(std::string_view name,
+                             std::uint64_t items = 0) noexcept
+        : m_items(items) {
+        if (profiler::enabled()) {
+            start(name);
+        }
+    }
+
+    /// End the measurement
+    ~profiling_scope() {
+        if (m_buffer != nullptr) {
+            stop();
+        }
+    }
+
+    /// No copying / moving of the scope
+    profiling_scope(const profiling_scope&) = delete;
+    profiling_scope& operator=(const profiling_scope&) = delete;
+
+    /// Set the number of items processed by the stage
+    void set_items(std::uint64_t items) noexcept { m_items = items; }
+
+    private:
+    /// Set up the record of the scope
+    void start(std::string_view name) noexcept;
+    /// Write the record of the scope into the thread's buffer
+    void stop() noexcept;
+
+    /// Buffer of the thread, if the scope is recording
+    details::profiling_buffer* m_buffer = nullptr;
+    /// Name of the stage
+    std::string_view m_name;
+    /// Start time of the scope
+    std::uint64_t m_start = 0;
+    /// Number of items processed by the stage
+    std::uint64_t m_items;
+    /// Nesting depth of the scope
+    std::uint32_t m_depth = 0;
+    /// Whether the hardware counters are sampled for the scope
+    bool m_sample_counters = false;
+    /// Hardware counter values at the start of the scope
+    hardware_counters m_counters;
+
+};  // class profiling_scope
+
+}  // namespace traccc::performance
@@ -0,0 +1,90 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/hardware_counters.hpp"
+#include "traccc/performance/profiling_record.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Statistics about all executions of a single profiled stage
+struct stage_statistics {
+
+    /// Name of the stage
+    std::string name;
+    /// (Smallest) nesting depth that the stage was recorded with
+    std::uint32_t depth = 0;
+    /// Number of times the stage was executed
+    std::size_t count = 0;
+    /// Total number of items processed by the stage
+    std::uint64_t items = 0;
+
+    /// @name Execution time distribution
+    /// @{
+    std::chrono::nanoseconds total{0};
+    std::chrono::nanoseconds min{0};
+    std::chrono::nanoseconds mean{0};
+    std::chrono::nanoseconds p50{0};
+    std::chrono::nanoseconds p99{0};
+    std::chrono::nanoseconds max{0};
+    /// @}
+
+    /// Sum of the hardware counters measured for the stage
+    hardware_counters counters;
+
+};  // struct stage_statistics
+
+/// Per-stage summary of a set of profiling records
+struct profiling_summary {
+
+    /// Constructor from the records collected by the profiler
+    ///
+    /// @param records The records to summarise
+    /// @param dropped The number of records lost to buffer overflows
+    ///
+    explicit profiling_summary(const std::vector<profiling_record>& records,
+                               std::size_t dropped = 0);
+
+    /// Get the statistics of a given stage
+    ///
+    /// @param stage_name The name of the stage
+    /// @return The statistics of the stage in question
+    ///
+    const stage_statistics& get(std::string_view stage_name) const;
+
+    /// The statistics of all stages, in the order of their first execution
+    std::vector<stage_statistics> stages;
+    /// Number of records lost to buffer overflows
+    std::size_t dropped = 0;
+
+};  // struct profiling_summary
+
+/// Printout helper for @c traccc::performance::profiling_summary
+std::ostream& operator<<(std::ostream& out, const profiling_summary& summary);
+
+/// Write profiling records in the Chrome trace event (JSON) format
+///
+/// The output can be loaded into chrome://tracing or https://ui.perfetto.dev.
+///
+/// @param out The stream to write the trace to
+/// @param records The records to write
+///
+void write_chrome_trace(std::ostream& out,
+                        const std::vector<profiling_record>& records);
+
+}  // namespace traccc::performance
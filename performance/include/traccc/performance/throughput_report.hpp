@@ -0,0 +1,142 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/arena_memory_resource.hpp"
+#include "traccc/performance/counting_memory_resource.hpp"
+#include "traccc/performance/profiling_summary.hpp"
+#include "traccc/performance/timing_info.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Statistics of the event processing rate over multiple repetitions
+struct rate_statistics {
+
+    /// Mean of the events/second values
+    double mean = 0.;
+    /// Sample standard deviation of the events/second values
+    double stddev = 0.;
+    /// Lower edge of the 95% confidence interval of the mean
+    double ci95_low = 0.;
+    /// Upper edge of the 95% confidence interval of the mean
+    double ci95_high = 0.;
+
+};  // struct rate_statistics
+
+/// Printout helper for @c traccc::performance::rate_statistics
+std::ostream& operator<<(std::ostream& out, const rate_statistics& stats);
+
+/// The result of one throughput measurement point
+struct throughput_measurement {
+
+    /// Number of CPU threads used for the measurement
+    std::size_t threads = 1;
+    /// Number of events processed in each repetition
+    std::size_t events = 0;
+    /// Wall-clock time of each repetition
+    std::vector<std::chrono::nanoseconds> repetitions;
+    /// Timings of the (named) parts of the job
+    timing_info timings;
+    /// Per-stage profile, if profiling was enabled
+    std::optional<profiling_summary> profile;
+    /// Statistics of the host allocations made by the algorithms
+    allocator_statistics allocations;
+    /// Statistics of the arena allocator(s), if they were used
+    std::optional<arena_statistics> arena;
+    /// Peak resident set size of the process while taking this measurement
+    ///
+    /// Only set if the peak could be reset at the start of the measurement
+    /// (see @c traccc::performance::reset_peak_resident_memory). Otherwise
+    /// only the process-wide peak is known, which is not specific to any one
+    /// measurement point.
+    ///
+    std::optional<std::size_t> peak_rss_bytes;
+
+    /// Calculate the events/second statistics of the repetitions
+    rate_statistics rate() const;
+
+};  // struct throughput_measurement
+
+/// Machine-readable (JSON) report of a throughput test
+///
+/// Collects the build information, job configuration and the results of all
+/// measurement points (thread counts) of a throughput test.
+///
+class throughput_report {
+
+    public:
+    /// Constructor with the name of the application
+    explicit throughput_report(std::string_view application);
+
+    /// Add configuration parameters
+    ///
+    /// The parameters are extracted from the printout of the program option
+    /// groups, with lines in the format of ">>> group <<<" and "key : value".
+    ///
+    /// @param printout The printout of one or more program option groups
+    ///
+    void add_configuration(std::string_view printout);
+
+    /// Add the result of a measurement point
+    void add_measurement(throughput_measurement measurement);
+
+    /// Access the measurements added so far
+    const std::vector<throughput_measurement>& measurements() const {
+        return m_measurements;
+    }
+
+    /// Write the report in JSON format
+    ///
+    /// Besides the per-measurement results, the report holds the peak
+    /// resident set size of the process over its entire lifetime in its
+    /// "memory" section. Which is the same for all measurement points, so it
+    /// is only reported once.
+    ///
+    /// @param out The stream to write the report to
+    ///
+    void write(std::ostream& out) const;
+
+    private:
+    /// Name of the application
+    std::string m_application;
+    /// Configuration parameters, grouped by program option group
+    std::vector<std::pair<std::string,
+                          std::vector<std::pair<std::string, std::string> > > >
+        m_configuration;
+    /// Results of the measurement points
+    std::vector<throughput_measurement> m_measurements;
+
+};  // class throughput_report
+
+/// Get the peak resident set size of the process in bytes (0 if unknown)
+///
+/// The peak is counted from the start of the process, or from the last
+/// successful call to @c traccc::performance::reset_peak_resident_memory.
+///
+std::size_t peak_resident_memory();
+
+/// Reset the peak resident set size of the process to its current size
+///
+/// Only possible on Linux, through /proc/self/clear_refs.
+///
+/// @return @c true if the peak was reset, @c false if it is not supported
+///
+bool reset_peak_resident_memory();
+
+}  // namespace traccc::performance
@@ -31,7 +31,27 @@ struct seeding_performance_writer_data {
     seeding_performance_writer_data(
         const seeding_performance_writer::config& cfg)
         : m_eff_plot_tool({cfg.var_binning}),
-          m_duplication_plot_tool({cfg.var_binning}) {}
+          m_duplication_plot_tool({cfg.var_binning}) {
+
+#ifdef TRACCC_HAVE_ROOT
+        // The seeding efficiency vs. the z position of the particle vertex,
+        // to show the effect of narrowing down the collision region of the
+        // seeding around the vertex candidates of the events.
+        m_eff_vs_vz = plot_helpers::book_eff(
+            "seeding_trackeff_vs_vz",
+            "Tracking efficiency;Truth v_{z} [mm];Efficiency",
+            cfg.var_binning.at("Vz"));
+#endif  // TRACCC_HAVE_ROOT
+    }
+
+    /// Fill all efficiency plots for a particle
+    void fill_eff(const particle& ptc, bool is_matched) {
+
+        m_eff_plot_tool.fill(m_eff_plot_cache, ptc, is_matched);
+#ifdef TRACCC_HAVE_ROOT
+        m_eff_vs_vz->Fill(is_matched, ptc.vertex[2]);
+#endif  // TRACCC_HAVE_ROOT
+    }
 
     /// Plot tool for efficiency
     eff_plot_tool m_eff_plot_tool;
@@ -41,6 +61,11 @@ struct seeding_performance_writer_data {
     duplication_plot_tool m_duplication_plot_tool;
     duplication_plot_tool::duplication_plot_cache m_duplication_plot_cache;
 
+#ifdef TRACCC_HAVE_ROOT
+    /// Efficiency vs. the z position of the particle vertex
+    std::unique_ptr<TEfficiency> m_eff_vs_vz;
+#endif  // TRACCC_HAVE_ROOT
+
     measurement_particle_map m_measurement_particle_map;
     particle_map m_particle_map;
 
@@ -96,7 +121,7 @@ void seeding_performance_writer::write(
             n_matched_seeds_for_particle = it->second;
         }
 
-        m_data->m_eff_plot_tool.fill(m_data->m_eff_plot_cache, ptc, is_matched);
+        m_data->fill_eff(ptc, is_matched);
         m_data->m_duplication_plot_tool.fill(m_data->m_duplication_plot_cache,
                                              ptc,
                                              n_matched_seeds_for_particle - 1);
@@ -140,7 +165,7 @@ void seeding_performance_writer::write(
             n_matched_seeds_for_particle = it->second;
         }
 
-        m_data->m_eff_plot_tool.fill(m_data->m_eff_plot_cache, ptc, is_matched);
+        m_data->fill_eff(ptc, is_matched);
         m_data->m_duplication_plot_tool.fill(m_data->m_duplication_plot_cache,
                                              ptc,
                                              n_matched_seeds_for_particle - 1);
@@ -166,6 +191,9 @@ void seeding_performance_writer::finalize() {
 
     m_data->m_eff_plot_tool.write(m_data->m_eff_plot_cache);
     m_data->m_duplication_plot_tool.write(m_data->m_duplication_plot_cache);
+#ifdef TRACCC_HAVE_ROOT
+    m_data->m_eff_vs_vz->Write();
+#endif  // TRACCC_HAVE_ROOT
 }
 
 }  // namespace traccc
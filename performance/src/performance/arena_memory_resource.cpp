@@ -0,0 +1,154 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/arena_memory_resource.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace traccc::performance {
+
+arena_statistics& arena_statistics::operator+=(const arena_statistics& rhs) {
+
+    resets += rhs.resets;
+    upstream_allocations += rhs.upstream_allocations;
+    capacity_bytes += rhs.capacity_bytes;
+    peak_bytes += rhs.peak_bytes;
+    return *this;
+}
+
+std::ostream& operator<<(std::ostream& out, const arena_statistics& stats) {
+
+    out << stats.resets << " resets, " << stats.upstream_allocations
+        << " upstream allocations, " << stats.capacity_bytes
+        << " bytes capacity, " << stats.peak_bytes << " bytes peak";
+    return out;
+}
+
+arena_memory_resource::arena_memory_resource(vecmem::memory_resource& upstream,
+                                             std::size_t block_size)
+    : m_upstream(upstream), m_block_size(block_size) {
+
+    if (m_block_size == 0) {
+        throw std::invalid_argument{"The arena block size must be positive"};
+    }
+}
+
+arena_memory_resource::~arena_memory_resource() {
+
+    for (const block& b : m_blocks) {
+        m_upstream.deallocate(b.data, b.size, b.alignment);
+    }
+}
+
+void arena_memory_resource::mark() {
+
+    m_mark = m_current;
+    m_marked_allocations += m_live_allocations;
+    m_live_allocations = 0;
+}
+
+void arena_memory_resource::reset() {
+
+    if (m_live_allocations != 0) {
+        throw std::logic_error{
+            "Resetting an arena with " + std::to_string(m_live_allocations) +
+            " allocation(s) still in use"};
+    }
+    m_current = m_mark;
+    m_used_bytes = 0;
+    ++m_stats.resets;
+}
+
+arena_statistics arena_memory_resource::statistics() const {
+
+    return m_stats;
+}
+
+void* arena_memory_resource::do_allocate(std::size_t size,
+                                         std::size_t alignment) {
+
+    // Look for the first block, starting from the current one, that the
+    // allocation fits into.
+    while (m_current.block < m_blocks.size()) {
+        const block& b = m_blocks[m_current.block];
+        const std::uintptr_t start =
+            reinterpret_cast<std::uintptr_t>(b.data) + m_current.offset;
+        const std::size_t padding =
+            (alignment - (start % alignment)) % alignment;
+        if (m_current.offset + padding + size <= b.size) {
+            void* result = b.data + m_current.offset + padding;
+            m_current.offset += padding + size;
+            m_used_bytes += padding + size;
+            m_stats.peak_bytes = std::max(m_stats.peak_bytes, m_used_bytes);
+            ++m_live_allocations;
+            return result;
+        }
+        // Move on to the next block. The end of the current one is wasted
+        // until the next reset.
+        ++m_current.block;
+        m_current.offset = 0;
+    }
+
+    // Allocate a new block, large enough for the allocation.
+    block b;
+    b.alignment = std::max(alignment, alignof(std::max_align_t));
+    b.size = std::max(m_block_size, size);
+    b.data =
+        static_cast<std::byte*>(m_upstream.allocate(b.size, b.alignment));
+    m_blocks.push_back(b);
+    ++m_stats.upstream_allocations;
+    m_stats.capacity_bytes += b.size;
+
+    // Now the allocation fits for sure.
+    return do_allocate(size, alignment);
+}
+
+void arena_memory_resource::do_deallocate(void* ptr, std::size_t,
+                                          std::size_t) {
+
+    // The memory is only reclaimed in reset(). But keep track of the
+    // allocations from before and after the mark separately, so that reset()
+    // would notice event memory still being in use.
+    std::size_t& counter =
+        (before_mark(ptr) ? m_marked_allocations : m_live_allocations);
+    if (counter == 0) {
+        throw std::logic_error{
+            "De-allocating more memory from the arena than was allocated"};
+    }
+    --counter;
+}
+
+bool arena_memory_resource::before_mark(const void* ptr) const {
+
+    const std::byte* p = static_cast<const std::byte*>(ptr);
+    for (std::size_t i = 0; i < m_blocks.size(); ++i) {
+        const block& b = m_blocks[i];
+        if ((p < b.data) || (p >= b.data + b.size)) {
+            continue;
+        }
+        return ((i < m_mark.block) ||
+                ((i == m_mark.block) &&
+                 (static_cast<std::size_t>(p - b.data) < m_mark.offset)));
+    }
+    throw std::logic_error{
+        "De-allocating memory that was not allocated by the arena"};
+}
+
+bool arena_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+}  // namespace traccc::performance
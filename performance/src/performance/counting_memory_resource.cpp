@@ -0,0 +1,81 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/counting_memory_resource.hpp"
+
+// System include(s).
+#include <iostream>
+
+namespace traccc::performance {
+
+allocator_statistics& allocator_statistics::operator+=(
+    const allocator_statistics& rhs) {
+
+    allocations += rhs.allocations;
+    deallocations += rhs.deallocations;
+    allocated_bytes += rhs.allocated_bytes;
+    peak_bytes += rhs.peak_bytes;
+    return *this;
+}
+
+std::ostream& operator<<(std::ostream& out, const allocator_statistics& stats) {
+
+    out << stats.allocations << " allocations, " << stats.deallocations
+        << " deallocations, " << stats.allocated_bytes
+        << " bytes allocated, " << stats.peak_bytes << " bytes peak";
+    return out;
+}
+
+counting_memory_resource::counting_memory_resource(
+    vecmem::memory_resource& upstream)
+    : m_upstream(upstream) {}
+
+allocator_statistics counting_memory_resource::statistics() const {
+
+    return {m_allocations.load(), m_deallocations.load(),
+            m_allocated_bytes.load(), m_peak_bytes.load()};
+}
+
+void counting_memory_resource::reset_statistics() {
+
+    m_allocations = 0;
+    m_deallocations = 0;
+    m_allocated_bytes = 0;
+    m_peak_bytes = m_current_bytes.load();
+}
+
+void* counting_memory_resource::do_allocate(std::size_t size,
+                                            std::size_t alignment) {
+
+    void* result = m_upstream.allocate(size, alignment);
+    m_allocations.fetch_add(1u, std::memory_order_relaxed);
+    m_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    const std::size_t current =
+        m_current_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    std::size_t peak = m_peak_bytes.load(std::memory_order_relaxed);
+    while ((current > peak) && !m_peak_bytes.compare_exchange_weak(
+                                   peak, current, std::memory_order_relaxed)) {
+    }
+    return result;
+}
+
+void counting_memory_resource::do_deallocate(void* ptr, std::size_t size,
+                                             std::size_t alignment) {
+
+    m_upstream.deallocate(ptr, size, alignment);
+    m_deallocations.fetch_add(1u, std::memory_order_relaxed);
+    m_current_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+bool counting_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,68 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/details/profiling_buffer.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <bit>
+
+namespace traccc::performance::details {
+
+profiling_buffer::profiling_buffer(std::size_t capacity, std::uint32_t thread)
+    : m_slots(std::bit_ceil(std::max<std::size_t>(capacity, 1u))),
+      m_mask(m_slots.size() - 1u),
+      m_thread(thread) {}
+
+void profiling_buffer::drain(std::vector<profiling_record>& out) {
+
+    const std::size_t head = m_head.load(std::memory_order_acquire);
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+    // Skip the records that were overwritten already.
+    const std::size_t capacity = m_slots.size();
+    std::size_t first = tail;
+    if (head - first > capacity) {
+        first = head - capacity;
+    }
+    std::size_t dropped = first - tail;
+
+    // Copy the records, dropping the ones that the producer started
+    // overwriting in the meantime.
+    for (std::size_t i = first; i < head; ++i) {
+        const slot& s = m_slots[i & m_mask];
+        if (s.m_sequence.load(std::memory_order_acquire) != i + 1u) {
+            ++dropped;
+            continue;
+        }
+        const profiling_record record = s.m_record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s.m_sequence.load(std::memory_order_relaxed) != i + 1u) {
+            ++dropped;
+            continue;
+        }
+        out.push_back(record);
+    }
+
+    m_dropped.fetch_add(dropped, std::memory_order_relaxed);
+    m_tail.store(head, std::memory_order_release);
+}
+
+void profiling_buffer::clear() {
+
+    m_tail.store(m_head.load(std::memory_order_acquire),
+                 std::memory_order_release);
+    m_dropped.store(0u, std::memory_order_relaxed);
+}
+
+std::size_t profiling_buffer::dropped() const {
+
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+}  // namespace traccc::performance::details
@@ -0,0 +1,118 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/event_schedule.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace traccc::performance {
+
+event_sampling event_sampling_from_string(std::string_view name) {
+
+    if (name == "random") {
+        return event_sampling::random;
+    } else if (name == "sequential") {
+        return event_sampling::sequential;
+    } else if (name == "shuffled") {
+        return event_sampling::shuffled;
+    } else if (name == "list") {
+        return event_sampling::list;
+    }
+    throw std::invalid_argument{"Unknown event sampling mode: \"" +
+                                std::string{name} + "\""};
+}
+
+std::ostream& operator<<(std::ostream& out, event_sampling sampling) {
+
+    switch (sampling) {
+        case event_sampling::random:
+            out << "random";
+            break;
+        case event_sampling::sequential:
+            out << "sequential";
+            break;
+        case event_sampling::shuffled:
+            out << "shuffled";
+            break;
+        case event_sampling::list:
+            out << "list";
+            break;
+    }
+    return out;
+}
+
+event_schedule::event_schedule(event_sampling mode, std::size_t n_input_events,
+                               unsigned int seed,
+                               const std::vector<std::size_t>& list)
+    : m_mode(mode), m_n_input_events(n_input_events), m_seed(seed) {
+
+    if (m_n_input_events == 0) {
+        throw std::invalid_argument{"No input events to schedule"};
+    }
+    if (m_mode == event_sampling::list) {
+        if (list.empty()) {
+            throw std::invalid_argument{
+                "An event list is needed for the \"list\" sampling mode"};
+        }
+        for (std::size_t event : list) {
+            if (event >= m_n_input_events) {
+                throw std::invalid_argument{
+                    "Event " + std::to_string(event) +
+                    " of the event list is not available in memory"};
+            }
+        }
+        m_order = list;
+    }
+    reset();
+}
+
+std::vector<std::size_t> event_schedule::next(std::size_t n_events) {
+
+    std::vector<std::size_t> result(n_events);
+    std::generate(result.begin(), result.end(),
+                  [this]() { return next_event(); });
+    return result;
+}
+
+void event_schedule::reset() {
+
+    m_generator.seed(m_seed);
+    m_position = 0;
+    if ((m_mode == event_sampling::sequential) ||
+        (m_mode == event_sampling::shuffled)) {
+        m_order.resize(m_n_input_events);
+        std::iota(m_order.begin(), m_order.end(), 0u);
+    }
+    if (m_mode == event_sampling::shuffled) {
+        std::shuffle(m_order.begin(), m_order.end(), m_generator);
+    }
+}
+
+std::size_t event_schedule::next_event() {
+
+    if (m_mode == event_sampling::random) {
+        return std::uniform_int_distribution<std::size_t>{
+            0u, m_n_input_events - 1}(m_generator);
+    }
+
+    // Start a new pass over the events if needed.
+    if (m_position == m_order.size()) {
+        m_position = 0;
+        if (m_mode == event_sampling::shuffled) {
+            std::shuffle(m_order.begin(), m_order.end(), m_generator);
+        }
+    }
+    return m_order[m_position++];
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,186 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/hardware_counters.hpp"
+
+// System include(s).
+#include <cerrno>
+#include <cstring>
+
+// Linux include(s).
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // __linux__
+
+namespace traccc::performance {
+
+double hardware_counters::ipc() const {
+
+    if (!has(cycles) || !has(instructions) || (values[cycles] == 0u)) {
+        return -1.;
+    }
+    return static_cast<double>(values[instructions]) /
+           static_cast<double>(values[cycles]);
+}
+
+hardware_counters& hardware_counters::operator+=(
+    const hardware_counters& rhs) {
+
+    for (std::size_t i = 0; i < n_counters; ++i) {
+        values[i] += rhs.values[i];
+    }
+    available |= rhs.available;
+    return *this;
+}
+
+hardware_counters operator-(const hardware_counters& lhs,
+                            const hardware_counters& rhs) {
+
+    hardware_counters result;
+    result.available = lhs.available & rhs.available;
+    for (std::size_t i = 0; i < hardware_counters::n_counters; ++i) {
+        result.values[i] =
+            (lhs.values[i] > rhs.values[i] ? lhs.values[i] - rhs.values[i]
+                                           : 0u);
+    }
+    return result;
+}
+
+#ifdef __linux__
+namespace {
+
+/// Helper for opening one counter of the group
+int open_counter(std::uint64_t config, int group_fd) {
+
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (group_fd == -1 ? 1 : 0);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+                       PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(
+        syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+}  // namespace
+
+counter_group::counter_group() {
+
+    static constexpr std::array<std::uint64_t, hardware_counters::n_counters>
+        configs = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                   PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+    // Open the counters, using the first one that works as the group leader.
+    for (std::size_t i = 0; i < hardware_counters::n_counters; ++i) {
+        m_fds[i] = open_counter(configs[i], m_leader);
+        if (m_fds[i] < 0) {
+            if (m_error.empty()) {
+                m_error = std::strerror(errno);
+            }
+            continue;
+        }
+        if (m_leader < 0) {
+            m_leader = m_fds[i];
+        }
+        m_available |= (1u << i);
+    }
+    if (m_leader < 0) {
+        return;
+    }
+    m_error.clear();
+
+    // Start counting.
+    ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+counter_group::~counter_group() {
+
+    for (int fd : m_fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+hardware_counters counter_group::read() const {
+
+    hardware_counters result;
+    if (m_leader < 0) {
+        return result;
+    }
+
+    // The layout of the data returned for a group read.
+    struct {
+        std::uint64_t nr;
+        std::uint64_t time_enabled;
+        std::uint64_t time_running;
+        struct {
+            std::uint64_t value;
+            std::uint64_t id;
+        } values[hardware_counters::n_counters];
+    } data;
+    if (::read(m_leader, &data, sizeof(data)) <= 0) {
+        return result;
+    }
+
+    // Scale the values if the counters were multiplexed.
+    const double scale =
+        ((data.time_running > 0u) && (data.time_running < data.time_enabled))
+            ? static_cast<double>(data.time_enabled) /
+                  static_cast<double>(data.time_running)
+            : 1.;
+
+    // The values are returned in the order in which the counters were opened.
+    std::size_t index = 0;
+    for (std::size_t i = 0; i < hardware_counters::n_counters; ++i) {
+        if ((m_available & (1u << i)) == 0u) {
+            continue;
+        }
+        if (index >= data.nr) {
+            break;
+        }
+        result.values[i] = static_cast<std::uint64_t>(
+            static_cast<double>(data.values[index++].value) * scale);
+    }
+    result.available = m_available;
+    return result;
+}
+
+#else
+
+counter_group::counter_group()
+    : m_error("Hardware counters are only supported on Linux") {}
+
+counter_group::~counter_group() = default;
+
+hardware_counters counter_group::read() const {
+
+    return {};
+}
+
+#endif  // __linux__
+
+counter_scope::counter_scope(const counter_group& group,
+                             hardware_counters& result)
+    : m_group(group), m_start(group.read()), m_result(result) {}
+
+counter_scope::~counter_scope() {
+
+    m_result += (m_group.read() - m_start);
+}
+
+}  // namespace traccc::performance
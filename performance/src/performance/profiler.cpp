@@ -0,0 +1,103 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/profiler.hpp"
+
+// System include(s).
+#include <algorithm>
+
+namespace traccc::performance {
+
+std::atomic<bool> profiler::s_enabled{false};
+std::atomic<bool> profiler::s_sample_counters{false};
+
+profiler::profiler() : m_epoch(std::chrono::steady_clock::now()) {}
+
+profiler& profiler::instance() {
+
+    static profiler instance;
+    return instance;
+}
+
+void profiler::enable(std::size_t buffer_capacity, bool hardware_counters) {
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_buffer_capacity = buffer_capacity;
+    }
+    s_sample_counters.store(hardware_counters, std::memory_order_relaxed);
+
+    // Check on the current thread whether the counters can be used at all.
+    if (hardware_counters) {
+        details::profiling_buffer& buffer = local_buffer();
+        if (!buffer.m_counters->available()) {
+            m_counters_error = buffer.m_counters->error();
+            s_sample_counters.store(false, std::memory_order_relaxed);
+        }
+    }
+    s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void profiler::disable() {
+
+    s_enabled.store(false, std::memory_order_relaxed);
+}
+
+details::profiling_buffer& profiler::local_buffer() {
+
+    // The buffer of the current thread. Buffers are never deleted, so that
+    // records of finished threads could still be collected.
+    thread_local details::profiling_buffer* buffer = nullptr;
+    if (buffer == nullptr) {
+        std::lock_guard lock{m_mutex};
+        m_buffers.push_back(std::make_unique<details::profiling_buffer>(
+            m_buffer_capacity, static_cast<std::uint32_t>(m_buffers.size())));
+        buffer = m_buffers.back().get();
+    }
+    // Counters have to be opened by the thread that they would be measuring.
+    if (sampling_counters() && !buffer->m_counters) {
+        buffer->m_counters = std::make_unique<counter_group>();
+    }
+    return *buffer;
+}
+
+std::vector<profiling_record> profiler::collect() {
+
+    std::vector<profiling_record> result;
+    {
+        std::lock_guard lock{m_mutex};
+        for (auto& buffer : m_buffers) {
+            buffer->drain(result);
+        }
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const profiling_record& a, const profiling_record& b) {
+                         return a.start < b.start;
+                     });
+    return result;
+}
+
+std::size_t profiler::dropped() const {
+
+    std::lock_guard lock{m_mutex};
+    std::size_t result = 0;
+    for (const auto& buffer : m_buffers) {
+        result += buffer->dropped();
+    }
+    return result;
+}
+
+void profiler::reset() {
+
+    std::lock_guard lock{m_mutex};
+    for (auto& buffer : m_buffers) {
+        buffer->clear();
+    }
+}
+
+}  // namespace traccc::performance
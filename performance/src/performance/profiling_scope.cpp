@@ -0,0 +1,48 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/profiling_scope.hpp"
+
+namespace traccc::performance {
+
+void profiling_scope::start(std::string_view name) noexcept {
+
+    profiler& prof = profiler::instance();
+    try {
+        m_buffer = &(prof.local_buffer());
+    } catch (...) {
+        // Without a buffer the scope is simply not recorded.
+        return;
+    }
+    m_name = name;
+    m_depth = m_buffer->m_depth++;
+    m_sample_counters = profiler::sampling_counters() && m_buffer->m_counters;
+    if (m_sample_counters) {
+        m_counters = m_buffer->m_counters->read();
+    }
+    m_start = prof.now();
+}
+
+void profiling_scope::stop() noexcept {
+
+    const std::uint64_t end = profiler::instance().now();
+    if (m_sample_counters) {
+        m_counters = m_buffer->m_counters->read() - m_counters;
+    }
+    // Restore the depth of the owning thread to what it was when the scope
+    // started.
+    m_buffer->m_depth = m_depth;
+    try {
+        m_buffer->push({m_name, m_start, end, m_items, m_depth,
+                        m_buffer->thread(), m_counters});
+    } catch (...) {
+        // The record is lost, as if it had been overwritten.
+    }
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,253 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/profiling_summary.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace traccc::performance {
+namespace {
+
+/// Get a given quantile of a sorted set of durations
+std::chrono::nanoseconds quantile(const std::vector<std::uint64_t>& sorted,
+                                  double q) {
+
+    const std::size_t index = static_cast<std::size_t>(
+        std::ceil(q * static_cast<double>(sorted.size()))) - 1u;
+    return std::chrono::nanoseconds{
+        sorted.at(std::min(index, sorted.size() - 1u))};
+}
+
+/// Print a duration in a human readable way
+std::string format(std::chrono::nanoseconds ns) {
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    const double value = static_cast<double>(ns.count());
+    if (value >= 1e9) {
+        out << value * 1e-9 << " s";
+    } else if (value >= 1e6) {
+        out << value * 1e-6 << " ms";
+    } else {
+        out << value * 1e-3 << " us";
+    }
+    return out.str();
+}
+
+/// Print the value of a hardware counter
+std::string format_counter(const hardware_counters& counters,
+                           hardware_counters::counter c) {
+
+    return (counters.has(c) ? std::to_string(counters[c]) : "-");
+}
+
+/// Print the value of a hardware counter normalised to the processed items
+std::string format_per_item(const hardware_counters& counters,
+                            hardware_counters::counter c,
+                            std::uint64_t items) {
+
+    if (!counters.has(c) || (items == 0u)) {
+        return "-";
+    }
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2)
+        << static_cast<double>(counters[c]) / static_cast<double>(items);
+    return out.str();
+}
+
+/// Write a string into a JSON document
+void write_json_string(std::ostream& out, std::string_view str) {
+
+    out << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\';
+        }
+        out << c;
+    }
+    out << '"';
+}
+
+}  // namespace
+
+profiling_summary::profiling_summary(
+    const std::vector<profiling_record>& records, std::size_t dropped_records)
+    : dropped(dropped_records) {
+
+    // Collect the durations of all stages, remembering the order in which the
+    // stages were first seen.
+    std::map<std::string_view, std::size_t> stage_index;
+    std::vector<std::vector<std::uint64_t> > durations;
+    for (const profiling_record& record : records) {
+        auto [it, inserted] = stage_index.emplace(record.name, stages.size());
+        if (inserted) {
+            stages.push_back({});
+            stages.back().name = record.name;
+            stages.back().depth = record.depth;
+            durations.emplace_back();
+        }
+        stage_statistics& stage = stages[it->second];
+        stage.depth = std::min(stage.depth, record.depth);
+        stage.items += record.items;
+        stage.counters += record.counters;
+        durations[it->second].push_back(record.end - record.start);
+    }
+
+    // Calculate the statistics of all stages.
+    for (std::size_t i = 0; i < stages.size(); ++i) {
+        std::vector<std::uint64_t>& d = durations[i];
+        std::sort(d.begin(), d.end());
+        stage_statistics& stage = stages[i];
+        stage.count = d.size();
+        std::uint64_t total = 0;
+        for (std::uint64_t value : d) {
+            total += value;
+        }
+        stage.total = std::chrono::nanoseconds{total};
+        stage.min = std::chrono::nanoseconds{d.front()};
+        stage.max = std::chrono::nanoseconds{d.back()};
+        stage.mean = std::chrono::nanoseconds{total / d.size()};
+        stage.p50 = quantile(d, 0.5);
+        stage.p99 = quantile(d, 0.99);
+    }
+}
+
+const stage_statistics& profiling_summary::get(
+    std::string_view stage_name) const {
+
+    auto it = std::find_if(stages.begin(), stages.end(),
+                           [&stage_name](const stage_statistics& stage) {
+                               return stage.name == stage_name;
+                           });
+    if (it == stages.end()) {
+        throw std::invalid_argument("Unknown stage name received");
+    }
+    return *it;
+}
+
+std::ostream& operator<<(std::ostream& out, const profiling_summary& summary) {
+
+    // Restore the formatting of the stream at the end.
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << std::setw(34) << std::left << "Stage" << std::right
+        << std::setw(8) << "count" << std::setw(14) << "total"
+        << std::setw(13) << "min" << std::setw(13) << "mean"
+        << std::setw(13) << "p50" << std::setw(13) << "p99"
+        << std::setw(14) << "items" << std::setw(14) << "items/s";
+    for (const stage_statistics& stage : summary.stages) {
+        const std::string name =
+            std::string(2u * stage.depth, ' ') + stage.name;
+        out << "\n"
+            << std::setw(34) << std::left << name << std::right
+            << std::setw(8) << stage.count << std::setw(14)
+            << format(stage.total) << std::setw(13) << format(stage.min)
+            << std::setw(13) << format(stage.mean) << std::setw(13)
+            << format(stage.p50) << std::setw(13) << format(stage.p99)
+            << std::setw(14) << stage.items << std::setw(14);
+        if ((stage.items > 0) && (stage.total.count() > 0)) {
+            out << std::fixed << std::setprecision(1)
+                << static_cast<double>(stage.items) * 1e9 /
+                       static_cast<double>(stage.total.count());
+        } else {
+            out << "-";
+        }
+    }
+
+    // Print the hardware counters, if they were measured.
+    const bool have_counters = std::any_of(
+        summary.stages.begin(), summary.stages.end(),
+        [](const stage_statistics& stage) {
+            return stage.counters.available != 0u;
+        });
+    if (have_counters) {
+        using hwc = hardware_counters;
+        out << "\n"
+            << std::setw(34) << std::left << "Stage" << std::right
+            << std::setw(16) << "cycles" << std::setw(16) << "instructions"
+            << std::setw(8) << "IPC" << std::setw(16) << "cycles/item"
+            << std::setw(18) << "cache-miss/item" << std::setw(18)
+            << "branch-miss/item";
+        for (const stage_statistics& stage : summary.stages) {
+            const hwc& c = stage.counters;
+            const std::string name =
+                std::string(2u * stage.depth, ' ') + stage.name;
+            out << "\n"
+                << std::setw(34) << std::left << name << std::right
+                << std::setw(16) << format_counter(c, hwc::cycles)
+                << std::setw(16) << format_counter(c, hwc::instructions)
+                << std::setw(8);
+            if (c.ipc() >= 0.) {
+                out << std::fixed << std::setprecision(2) << c.ipc();
+            } else {
+                out << "-";
+            }
+            out << std::setw(16)
+                << format_per_item(c, hwc::cycles, stage.items)
+                << std::setw(18)
+                << format_per_item(c, hwc::cache_misses, stage.items)
+                << std::setw(18)
+                << format_per_item(c, hwc::branch_misses, stage.items);
+        }
+    }
+
+    if (summary.dropped > 0) {
+        out << "\nWARNING: " << summary.dropped
+            << " profiling records were dropped due to buffer overflows";
+    }
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+void write_chrome_trace(std::ostream& out,
+                        const std::vector<profiling_record>& records) {
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    out << std::fixed << std::setprecision(3);
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const profiling_record& record = records[i];
+        out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(out, record.name);
+        out << ",\"cat\":\"traccc\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+            << record.thread
+            << ",\"ts\":" << static_cast<double>(record.start) * 1e-3
+            << ",\"dur\":"
+            << static_cast<double>(record.end - record.start) * 1e-3
+            << ",\"args\":{\"items\":" << record.items
+            << ",\"depth\":" << record.depth;
+        if (record.counters.available != 0u) {
+            using hwc = hardware_counters;
+            static constexpr std::array<const char*, hwc::n_counters> names =
+                {"cycles", "instructions", "cache_misses", "branch_misses"};
+            for (std::size_t c = 0; c < hwc::n_counters; ++c) {
+                if (record.counters.has(static_cast<hwc::counter>(c))) {
+                    out << ",\"" << names[c]
+                        << "\":" << record.counters.values[c];
+                }
+            }
+        }
+        out << "}}";
+    }
+    out << "\n]}\n";
+    out.flags(flags);
+    out.precision(precision);
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,369 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/throughput_report.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+// Helper macros for turning the build configuration into strings.
+#define TRACCC_REPORT_STRINGIFY_IMPL(X) #X
+#define TRACCC_REPORT_STRINGIFY(X) TRACCC_REPORT_STRINGIFY_IMPL(X)
+
+namespace traccc::performance {
+namespace {
+
+/// The highest peak resident set size seen before the peak was last reset
+std::atomic<std::size_t> peak_before_reset{0u};
+
+/// Two-sided 95% quantiles of Student's t-distribution, for 1..30 degrees of
+/// freedom. Larger samples use the normal approximation.
+constexpr std::array<double, 30> student_t_95 = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+/// Remove leading and trailing whitespace from a string
+std::string_view trim(std::string_view str) {
+
+    const std::size_t begin = str.find_first_not_of(" \t\r");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    const std::size_t end = str.find_last_not_of(" \t\r");
+    return str.substr(begin, end - begin + 1);
+}
+
+/// Helper for writing JSON-escaped strings
+struct json_string {
+    std::string_view value;
+};
+
+std::ostream& operator<<(std::ostream& out, const json_string& str) {
+
+    out << '"';
+    for (const char c : str.value) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << ' ';
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+    return out;
+}
+
+/// Time in (fractional) milliseconds
+double to_ms(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& out, const rate_statistics& stats) {
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(2) << stats.mean << " +- "
+        << stats.stddev << " events/s (95% CI: [" << stats.ci95_low << ", "
+        << stats.ci95_high << "])";
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+rate_statistics throughput_measurement::rate() const {
+
+    rate_statistics result;
+    if (repetitions.empty()) {
+        return result;
+    }
+
+    // Calculate the rate of every repetition.
+    std::vector<double> rates;
+    rates.reserve(repetitions.size());
+    for (const std::chrono::nanoseconds& time : repetitions) {
+        const double seconds = std::chrono::duration<double>(time).count();
+        rates.push_back(seconds > 0. ? static_cast<double>(events) / seconds
+                                     : 0.);
+    }
+
+    // Mean and sample standard deviation.
+    const double n = static_cast<double>(rates.size());
+    for (double rate : rates) {
+        result.mean += rate;
+    }
+    result.mean /= n;
+    if (rates.size() > 1) {
+        double sum2 = 0.;
+        for (double rate : rates) {
+            sum2 += (rate - result.mean) * (rate - result.mean);
+        }
+        result.stddev = std::sqrt(sum2 / (n - 1.));
+    }
+
+    // Confidence interval of the mean.
+    const std::size_t dof = rates.size() - 1;
+    const double t =
+        (dof == 0) ? 0.
+                   : (dof <= student_t_95.size() ? student_t_95[dof - 1] : 1.96);
+    const double half_width = t * result.stddev / std::sqrt(n);
+    result.ci95_low = result.mean - half_width;
+    result.ci95_high = result.mean + half_width;
+    return result;
+}
+
+throughput_report::throughput_report(std::string_view application)
+    : m_application(application) {}
+
+void throughput_report::add_configuration(std::string_view printout) {
+
+    // The group that the current lines belong to.
+    std::vector<std::pair<std::string, std::string> >* group = nullptr;
+
+    while (!printout.empty()) {
+        // Take the next line.
+        const std::size_t eol = printout.find('\n');
+        const std::string_view line = trim(printout.substr(0, eol));
+        printout = (eol == std::string_view::npos) ? std::string_view{}
+                                                   : printout.substr(eol + 1);
+        if (line.empty()) {
+            continue;
+        }
+
+        // Check if it's a group header.
+        if (line.starts_with(">>>") && line.ends_with("<<<")) {
+            m_configuration.emplace_back(
+                std::string{trim(line.substr(3, line.size() - 6))},
+                std::vector<std::pair<std::string, std::string> >{});
+            group = &(m_configuration.back().second);
+            continue;
+        }
+
+        // Otherwise it should be a key-value pair.
+        const std::size_t colon = line.find(':');
+        if (colon == std::string_view::npos) {
+            continue;
+        }
+        if (group == nullptr) {
+            m_configuration.emplace_back(
+                "General",
+                std::vector<std::pair<std::string, std::string> >{});
+            group = &(m_configuration.back().second);
+        }
+        group->emplace_back(std::string{trim(line.substr(0, colon))},
+                            std::string{trim(line.substr(colon + 1))});
+    }
+}
+
+void throughput_report::add_measurement(throughput_measurement measurement) {
+
+    if (measurement.threads == 0) {
+        throw std::invalid_argument("Measurements need at least one thread");
+    }
+    m_measurements.push_back(std::move(measurement));
+}
+
+void throughput_report::write(std::ostream& out) const {
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    // General information.
+    out << "{\n  \"application\": " << json_string{m_application} << ",\n";
+    out << "  \"build\": {\n";
+#ifdef TRACCC_VERSION
+    out << "    \"version\": "
+        << json_string{TRACCC_REPORT_STRINGIFY(TRACCC_VERSION)} << ",\n";
+#endif
+#ifdef TRACCC_BUILD_TYPE
+    out << "    \"build_type\": "
+        << json_string{TRACCC_REPORT_STRINGIFY(TRACCC_BUILD_TYPE)} << ",\n";
+#endif
+#ifdef TRACCC_ALGEBRA_PLUGIN
+    out << "    \"algebra_plugin\": "
+        << json_string{TRACCC_REPORT_STRINGIFY(TRACCC_ALGEBRA_PLUGIN)}
+        << ",\n";
+#endif
+#ifdef TRACCC_CUSTOM_SCALARTYPE
+    out << "    \"scalar_type\": "
+        << json_string{TRACCC_REPORT_STRINGIFY(TRACCC_CUSTOM_SCALARTYPE)}
+        << ",\n";
+#endif
+#ifdef __VERSION__
+    out << "    \"compiler\": " << json_string{__VERSION__} << "\n";
+#else
+    out << "    \"compiler\": \"unknown\"\n";
+#endif
+    out << "  },\n";
+
+    // The job configuration.
+    out << "  \"configuration\": {";
+    for (std::size_t i = 0; i < m_configuration.size(); ++i) {
+        out << (i == 0 ? "\n" : ",\n") << "    "
+            << json_string{m_configuration[i].first} << ": {";
+        const auto& params = m_configuration[i].second;
+        for (std::size_t j = 0; j < params.size(); ++j) {
+            out << (j == 0 ? "\n" : ",\n") << "      "
+                << json_string{params[j].first} << ": "
+                << json_string{params[j].second};
+        }
+        out << (params.empty() ? "}" : "\n    }");
+    }
+    out << (m_configuration.empty() ? "},\n" : "\n  },\n");
+
+    // The measurement results.
+    out << "  \"results\": [";
+    for (std::size_t i = 0; i < m_measurements.size(); ++i) {
+        const throughput_measurement& m = m_measurements[i];
+        const rate_statistics rate = m.rate();
+        out << (i == 0 ? "\n" : ",\n") << "    {\n";
+        out << "      \"threads\": " << m.threads << ",\n";
+        out << "      \"events\": " << m.events << ",\n";
+        out << "      \"repetitions_ms\": [";
+        for (std::size_t j = 0; j < m.repetitions.size(); ++j) {
+            out << (j == 0 ? "" : ", ") << to_ms(m.repetitions[j]);
+        }
+        out << "],\n";
+        out << "      \"events_per_second\": {\"mean\": " << rate.mean
+            << ", \"stddev\": " << rate.stddev
+            << ", \"ci95_low\": " << rate.ci95_low
+            << ", \"ci95_high\": " << rate.ci95_high << "},\n";
+        out << "      \"timings_ms\": {";
+        for (std::size_t j = 0; j < m.timings.data.size(); ++j) {
+            out << (j == 0 ? "" : ", ")
+                << json_string{m.timings.data[j].first} << ": "
+                << to_ms(m.timings.data[j].second);
+        }
+        out << "},\n";
+        out << "      \"stages\": [";
+        if (m.profile) {
+            for (std::size_t j = 0; j < m.profile->stages.size(); ++j) {
+                const stage_statistics& s = m.profile->stages[j];
+                out << (j == 0 ? "\n" : ",\n") << "        {\"name\": "
+                    << json_string{s.name} << ", \"depth\": " << s.depth
+                    << ", \"count\": " << s.count
+                    << ", \"items\": " << s.items
+                    << ", \"total_ms\": " << to_ms(s.total)
+                    << ", \"mean_ms\": " << to_ms(s.mean)
+                    << ", \"p50_ms\": " << to_ms(s.p50)
+                    << ", \"p99_ms\": " << to_ms(s.p99)
+                    << ", \"max_ms\": " << to_ms(s.max) << "}";
+            }
+            out << (m.profile->stages.empty() ? "" : "\n      ");
+        }
+        out << "],\n";
+        out << "      \"allocator\": {\"allocations\": "
+            << m.allocations.allocations
+            << ", \"deallocations\": " << m.allocations.deallocations
+            << ", \"allocated_bytes\": " << m.allocations.allocated_bytes
+            << ", \"peak_bytes\": " << m.allocations.peak_bytes << "}";
+        if (m.arena) {
+            out << ",\n      \"arena\": {\"resets\": " << m.arena->resets
+                << ", \"upstream_allocations\": "
+                << m.arena->upstream_allocations
+                << ", \"capacity_bytes\": " << m.arena->capacity_bytes
+                << ", \"peak_bytes\": " << m.arena->peak_bytes << "}";
+        }
+        if (m.peak_rss_bytes) {
+            out << ",\n      \"peak_rss_bytes\": " << *(m.peak_rss_bytes);
+        }
+        out << "\n";
+        out << "    }";
+    }
+    out << (m_measurements.empty() ? "],\n" : "\n  ],\n");
+
+    // Process-level memory usage, over the entire lifetime of the process.
+    // (Taking into account that the peak may have been reset in the
+    // meantime.)
+    const std::size_t process_peak =
+        std::max(peak_resident_memory(), peak_before_reset.load());
+    out << "  \"memory\": {\"peak_rss_bytes\": " << process_peak
+        << "}\n}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+std::size_t peak_resident_memory() {
+
+#if defined(__linux__)
+    // Prefer the high water mark from /proc, which can be reset.
+    std::ifstream status{"/proc/self/status"};
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmHWM:")) {
+            // The value is reported in kilobytes.
+            return std::stoul(line.substr(6)) * 1024u;
+        }
+    }
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    // macOS reports the value in bytes.
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+    // Linux reports the value in kilobytes.
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024u;
+#endif
+#else
+    return 0;
+#endif
+}
+
+bool reset_peak_resident_memory() {
+
+#if defined(__linux__)
+    // Remember the peak up to this point, for the process-wide report.
+    const std::size_t peak = peak_resident_memory();
+    std::size_t previous = peak_before_reset.load();
+    while ((previous < peak) &&
+           !peak_before_reset.compare_exchange_weak(previous, peak)) {
+    }
+
+    // Writing "5" resets the high water mark of the resident set size.
+    std::ofstream clear_refs{"/proc/self/clear_refs"};
+    clear_refs << "5" << std::flush;
+    return clear_refs.good();
+#else
+    return false;
+#endif
+}
+
+}  // namespace traccc::performance
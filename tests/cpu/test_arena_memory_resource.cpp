@@ -0,0 +1,88 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/arena_memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+#include <stdexcept>
+
+using namespace traccc::performance;
+
+// Memory must be re-used after a reset, without new upstream allocations
+TEST(arena_memory_resource, reset) {
+
+    vecmem::host_memory_resource host_mr;
+    arena_memory_resource arena{host_mr, 1024u};
+
+    for (int event = 0; event < 3; ++event) {
+        void* p1 = arena.allocate(100u, 8u);
+        void* p2 = arena.allocate(2000u, 64u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p2) % 64u, 0u);
+        arena.deallocate(p1, 100u, 8u);
+        arena.deallocate(p2, 2000u, 64u);
+        arena.reset();
+    }
+
+    const arena_statistics stats = arena.statistics();
+    EXPECT_EQ(stats.resets, 3u);
+    EXPECT_EQ(stats.upstream_allocations, 2u);
+    EXPECT_GE(stats.peak_bytes, 2100u);
+}
+
+// Allocations made before the mark must survive resets
+TEST(arena_memory_resource, mark) {
+
+    vecmem::host_memory_resource host_mr;
+    arena_memory_resource arena{host_mr, 1024u};
+
+    int* persistent = static_cast<int*>(arena.allocate(sizeof(int)));
+    *persistent = 42;
+    arena.mark();
+
+    int* temporary = static_cast<int*>(arena.allocate(sizeof(int)));
+    *temporary = 0;
+    EXPECT_THROW(arena.reset(), std::logic_error);
+    arena.deallocate(temporary, sizeof(int));
+    arena.reset();
+
+    int* next = static_cast<int*>(arena.allocate(sizeof(int)));
+    EXPECT_EQ(next, temporary);
+    *next = 1;
+    EXPECT_EQ(*persistent, 42);
+    arena.deallocate(next, sizeof(int));
+}
+
+// De-allocations must be accounted to the right side of the mark
+TEST(arena_memory_resource, balance) {
+
+    vecmem::host_memory_resource host_mr;
+    arena_memory_resource arena{host_mr, 1024u};
+
+    void* persistent = arena.allocate(sizeof(int));
+    arena.mark();
+    void* temporary = arena.allocate(sizeof(int));
+
+    // Releasing the persistent allocation must not hide the event one.
+    arena.deallocate(persistent, sizeof(int));
+    EXPECT_THROW(arena.reset(), std::logic_error);
+    EXPECT_THROW(arena.deallocate(persistent, sizeof(int)), std::logic_error);
+
+    arena.deallocate(temporary, sizeof(int));
+    arena.reset();
+    EXPECT_THROW(arena.deallocate(temporary, sizeof(int)), std::logic_error);
+
+    int foreign = 0;
+    EXPECT_THROW(arena.deallocate(&foreign, sizeof(int)), std::logic_error);
+}
@@ -0,0 +1,72 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/event_schedule.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace traccc::performance;
+
+// The same seed must always result in the same schedule
+TEST(event_schedule, reproducible) {
+
+    for (event_sampling mode :
+         {event_sampling::random, event_sampling::shuffled}) {
+        event_schedule schedule1{mode, 10u, 1234u};
+        event_schedule schedule2{mode, 10u, 1234u};
+        const std::vector<std::size_t> events = schedule1.next(25u);
+        EXPECT_EQ(events, schedule2.next(25u));
+        for (std::size_t event : events) {
+            EXPECT_LT(event, 10u);
+        }
+        schedule1.reset();
+        EXPECT_EQ(events, schedule1.next(25u));
+    }
+}
+
+// Test the sequential sampling
+TEST(event_schedule, sequential) {
+
+    event_schedule schedule{event_sampling::sequential, 3u};
+    EXPECT_EQ(schedule.next(7u),
+              (std::vector<std::size_t>{0u, 1u, 2u, 0u, 1u, 2u, 0u}));
+}
+
+// Every pass of the shuffled sampling must visit every event once
+TEST(event_schedule, shuffled) {
+
+    event_schedule schedule{event_sampling::shuffled, 20u, 5u};
+    for (int pass = 0; pass < 3; ++pass) {
+        std::vector<std::size_t> events = schedule.next(20u);
+        std::sort(events.begin(), events.end());
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            EXPECT_EQ(events[i], i);
+        }
+    }
+}
+
+// Test the fixed-list sampling
+TEST(event_schedule, list) {
+
+    event_schedule schedule{event_sampling::list, 10u, 42u, {7u, 3u}};
+    EXPECT_EQ(schedule.next(5u),
+              (std::vector<std::size_t>{7u, 3u, 7u, 3u, 7u}));
+
+    EXPECT_THROW((event_schedule{event_sampling::list, 10u, 42u, {}}),
+                 std::invalid_argument);
+    EXPECT_THROW((event_schedule{event_sampling::list, 10u, 42u, {10u}}),
+                 std::invalid_argument);
+    EXPECT_THROW(event_sampling_from_string("unknown"),
+                 std::invalid_argument);
+}
@@ -0,0 +1,112 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/utils/cached_field_view.hpp"
+#include "traccc/utils/field_map.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <stdexcept>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Make a map of a field that depends linearly on the position
+///
+/// B = (x, 2y, z - x) on a 4x3x2 grid with nodes 10 mm apart.
+///
+field_map make_linear_map() {
+
+    const darray<scalar, 3> min{-10.f, 0.f, 5.f};
+    const darray<scalar, 3> spacing{10.f, 10.f, 10.f};
+    const darray<field_map::index_type, 3> n_nodes{4u, 3u, 2u};
+    std::vector<scalar> bx, by, bz;
+    for (unsigned int iz = 0; iz < n_nodes[2]; ++iz) {
+        for (unsigned int iy = 0; iy < n_nodes[1]; ++iy) {
+            for (unsigned int ix = 0; ix < n_nodes[0]; ++ix) {
+                const scalar x = min[0] + static_cast<scalar>(ix) * spacing[0];
+                const scalar y = min[1] + static_cast<scalar>(iy) * spacing[1];
+                const scalar z = min[2] + static_cast<scalar>(iz) * spacing[2];
+                bx.push_back(x);
+                by.push_back(2.f * y);
+                bz.push_back(z - x);
+            }
+        }
+    }
+    return {min, spacing, n_nodes, bx, by, bz};
+}
+
+}  // namespace
+
+// Test that a linear field is reproduced exactly inside of the grid
+TEST(field_map, linear_interpolation) {
+
+    const field_map map = make_linear_map();
+    field_map_view raw{map};
+    cached_field_view cached{map};
+
+    // Points in different, and in the same cells, one after the other.
+    const std::vector<darray<scalar, 3>> points{{-10.f, 0.f, 5.f},
+                                                {-3.f, 4.f, 7.5f},
+                                                {-1.f, 6.f, 9.f},
+                                                {12.5f, 17.f, 14.f},
+                                                {20.f, 20.f, 15.f},
+                                                {-3.f, 4.f, 7.5f}};
+    for (const darray<scalar, 3>& p : points) {
+        for (const vector3 b :
+             {raw.at(p[0], p[1], p[2]), cached.at(p[0], p[1], p[2])}) {
+            EXPECT_NEAR(b[0], p[0], 1e-4f);
+            EXPECT_NEAR(b[1], 2.f * p[1], 1e-4f);
+            EXPECT_NEAR(b[2], p[2] - p[0], 1e-4f);
+        }
+    }
+}
+
+// Test that the field is taken from the closest node outside of the grid
+TEST(field_map, outside_of_grid) {
+
+    const field_map map = make_linear_map();
+    cached_field_view cached{map};
+
+    const vector3 b = cached.at(-100.f, 100.f, 10.f);
+    EXPECT_NEAR(b[0], -10.f, 1e-4f);
+    EXPECT_NEAR(b[1], 40.f, 1e-4f);
+    EXPECT_NEAR(b[2], 20.f, 1e-4f);
+}
+
+// Test the map of a constant field
+TEST(field_map, constant_field) {
+
+    const field_map map{vector3{0.f, 0.f, 2.f}};
+    cached_field_view cached{map};
+
+    for (const scalar x : {-1000.f, 0.f, 1000.f}) {
+        const vector3 b = cached.at(x, 2.f * x, -x);
+        EXPECT_FLOAT_EQ(b[0], 0.f);
+        EXPECT_FLOAT_EQ(b[1], 0.f);
+        EXPECT_FLOAT_EQ(b[2], 2.f);
+    }
+}
+
+// Test the validation of the map's inputs
+TEST(field_map, invalid_input) {
+
+    EXPECT_THROW(field_map({0.f, 0.f, 0.f}, {1.f, 1.f, 1.f}, {2u, 2u, 2u},
+                           std::vector<scalar>(7u), std::vector<scalar>(8u),
+                           std::vector<scalar>(8u)),
+                 std::invalid_argument);
+    EXPECT_THROW(field_map({0.f, 0.f, 0.f}, {1.f, 0.f, 1.f}, {2u, 2u, 2u},
+                           std::vector<scalar>(8u), std::vector<scalar>(8u),
+                           std::vector<scalar>(8u)),
+                 std::invalid_argument);
+}
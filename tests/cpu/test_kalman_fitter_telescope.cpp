@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Project include(s).
 #include "traccc/edm/track_state.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/smoothed_fitting_algorithm.hpp"
 #include "traccc/io/utils.hpp"
 #include "traccc/resolution/fitting_performance_writer.hpp"
 #include "traccc/simulation/simulator.hpp"
@@ -29,6 +30,7 @@
 
 // System include(s).
 #include <filesystem>
+#include <stdexcept>
 #include <string>
 
 using namespace traccc;
@@ -116,6 +118,42 @@ TEST_P(KalmanFittingTelescopeTests, Run) {
     typename traccc::fitting_algorithm<host_fitter_type>::config_type fit_cfg;
     fitting_algorithm<host_fitter_type> fitting(fit_cfg);
 
+    // Fitting algorithms with a reduced output
+    typename traccc::fitting_algorithm<host_fitter_type>::config_type
+        smoothed_fit_cfg = fit_cfg;
+    smoothed_fit_cfg.output_level = fitting_output_level::smoothed;
+    smoothed_fitting_algorithm<host_fitter_type> smoothed_fitting(
+        smoothed_fit_cfg);
+    typename traccc::fitting_algorithm<host_fitter_type>::config_type
+        perigee_fit_cfg = fit_cfg;
+    perigee_fit_cfg.output_level = fitting_output_level::perigee;
+    fitting_algorithm<host_fitter_type> perigee_fitting(perigee_fit_cfg);
+
+    // The output levels that the algorithms can not produce are rejected
+    EXPECT_THROW(fitting_algorithm<host_fitter_type>{smoothed_fit_cfg},
+                 std::invalid_argument);
+    EXPECT_THROW(smoothed_fitting_algorithm<host_fitter_type>{fit_cfg},
+                 std::invalid_argument);
+
+    // Fitting algorithm without smoothing
+    typename traccc::fitting_algorithm<host_fitter_type>::config_type
+        filter_fit_cfg = fit_cfg;
+    filter_fit_cfg.filter_only = true;
+    fitting_algorithm<host_fitter_type> filter_fitting(filter_fit_cfg);
+    typename traccc::fitting_algorithm<host_fitter_type>::config_type
+        smoothed_filter_fit_cfg = smoothed_fit_cfg;
+    smoothed_filter_fit_cfg.filter_only = true;
+    EXPECT_THROW(
+        smoothed_fitting_algorithm<host_fitter_type>{smoothed_filter_fit_cfg},
+        std::invalid_argument);
+
+    // Fitting algorithm with the Kalman updates and smoothing in double
+    // precision
+    using double_fitter_type =
+        kalman_fitter<rk_stepper_type, host_navigator_type,
+                      double_precision_algebra>;
+    fitting_algorithm<double_fitter_type> double_fitting(fit_cfg);
+
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
         // Event map
@@ -149,6 +187,56 @@ TEST_P(KalmanFittingTelescopeTests, Run) {
             fit_performance_writer.write(track_states_per_track, fit_res,
                                          host_det, evt_map);
         }
+
+        // The reduced outputs must agree with the full one.
+        auto smoothed_states =
+            smoothed_fitting(host_det, field, track_candidates);
+        auto perigee_states =
+            perigee_fitting(host_det, field, track_candidates);
+        auto filter_states = filter_fitting(host_det, field, track_candidates);
+        auto double_states = double_fitting(host_det, field, track_candidates);
+        ASSERT_EQ(smoothed_states.size(), n_tracks);
+        ASSERT_EQ(perigee_states.size(), n_tracks);
+        ASSERT_EQ(filter_states.size(), n_tracks);
+        ASSERT_EQ(double_states.size(), n_tracks);
+
+        for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+
+            const auto& full_items = track_states[i_trk].items;
+            const auto& smoothed_items = smoothed_states[i_trk].items;
+            ASSERT_EQ(smoothed_items.size(), full_items.size());
+            for (std::size_t i_st = 0; i_st < full_items.size(); i_st++) {
+                EXPECT_EQ(smoothed_items[i_st].surface_link(),
+                          full_items[i_st].surface_link());
+                EXPECT_EQ(smoothed_items[i_st].smoothed().vector(),
+                          full_items[i_st].smoothed().vector());
+            }
+            EXPECT_FLOAT_EQ(smoothed_states[i_trk].header.chi2,
+                            track_states[i_trk].header.chi2);
+
+            EXPECT_TRUE(perigee_states[i_trk].items.empty());
+            EXPECT_EQ(perigee_states[i_trk].header.fit_params.vector(),
+                      track_states[i_trk].header.fit_params.vector());
+
+            // The filter-only fit runs the same forward filtering.
+            scalar filtered_chi2 = 0.f;
+            for (const auto& st : full_items) {
+                if (!st.is_hole) {
+                    filtered_chi2 += st.filtered_chi2();
+                }
+            }
+            const auto& filter_res = filter_states[i_trk].header;
+            EXPECT_FLOAT_EQ(filter_res.ndf, track_states[i_trk].header.ndf);
+            EXPECT_FLOAT_EQ(filter_res.chi2, filtered_chi2);
+            EXPECT_EQ(filter_res.fit_params.vector(),
+                      full_items.back().filtered().vector());
+
+            // The fit in double precision must find the same tracks.
+            const auto& double_res = double_states[i_trk].header;
+            EXPECT_FLOAT_EQ(double_res.ndf, track_states[i_trk].header.ndf);
+            EXPECT_NEAR(double_res.chi2, track_states[i_trk].header.chi2,
+                        1e-2f * track_states[i_trk].header.chi2 + 1e-3f);
+        }
     }
 
     fit_performance_writer.finalize();
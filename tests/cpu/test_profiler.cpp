@@ -0,0 +1,177 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/hardware_counters.hpp"
+#include "traccc/performance/profiler.hpp"
+#include "traccc/performance/profiling_scope.hpp"
+#include "traccc/performance/profiling_summary.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace traccc::performance;
+
+// Scopes opened while the profiler is disabled must not record anything
+TEST(profiler, disabled) {
+
+    profiler& prof = profiler::instance();
+    prof.disable();
+    prof.reset();
+    {
+        profiling_scope scope{"Disabled stage", 10u};
+    }
+    EXPECT_TRUE(prof.collect().empty());
+}
+
+// Test the recording of nested scopes from multiple threads
+TEST(profiler, nested_scopes) {
+
+    profiler& prof = profiler::instance();
+    prof.reset();
+    prof.enable();
+
+    static constexpr unsigned int n_threads = 4u;
+    static constexpr unsigned int n_events = 25u;
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < n_threads; ++t) {
+        threads.emplace_back([]() {
+            for (unsigned int e = 0; e < n_events; ++e) {
+                profiling_scope event{"Event"};
+                {
+                    profiling_scope stage{"Clusterization", 100u};
+                }
+                profiling_scope stage{"Seeding"};
+                stage.set_items(5u);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    prof.disable();
+
+    const std::vector<profiling_record> records = prof.collect();
+    ASSERT_EQ(records.size(), 3u * n_threads * n_events);
+    for (std::size_t i = 1; i < records.size(); ++i) {
+        EXPECT_LE(records[i - 1].start, records[i].start);
+    }
+
+    const profiling_summary summary{records, prof.dropped()};
+    ASSERT_EQ(summary.stages.size(), 3u);
+    EXPECT_EQ(summary.dropped, 0u);
+
+    const stage_statistics& event = summary.get("Event");
+    EXPECT_EQ(event.depth, 0u);
+    EXPECT_EQ(event.count, n_threads * n_events);
+    EXPECT_LE(event.min, event.p50);
+    EXPECT_LE(event.p50, event.p99);
+    EXPECT_LE(event.p99, event.max);
+
+    const stage_statistics& ccl = summary.get("Clusterization");
+    EXPECT_EQ(ccl.depth, 1u);
+    EXPECT_EQ(ccl.items, 100u * n_threads * n_events);
+    EXPECT_EQ(summary.get("Seeding").items, 5u * n_threads * n_events);
+    EXPECT_THROW(summary.get("Fitting"), std::invalid_argument);
+
+    // Every record needs to show up in the trace.
+    std::ostringstream trace;
+    write_chrome_trace(trace, records);
+    std::size_t n_trace_events = 0;
+    for (std::size_t pos = trace.str().find("\"ph\":\"X\"");
+         pos != std::string::npos;
+         pos = trace.str().find("\"ph\":\"X\"", pos + 1)) {
+        ++n_trace_events;
+    }
+    EXPECT_EQ(n_trace_events, records.size());
+
+    // Everything was collected already.
+    EXPECT_TRUE(prof.collect().empty());
+}
+
+// Test the handling of buffer overflows
+TEST(profiler, overflow) {
+
+    profiler& prof = profiler::instance();
+    prof.reset();
+    prof.enable(8u);
+
+    // Use a new thread, so that it would get a buffer of the requested size.
+    std::thread thread([]() {
+        for (unsigned int i = 0; i < 20u; ++i) {
+            profiling_scope scope{"Overflow"};
+        }
+    });
+    thread.join();
+    prof.disable();
+
+    const profiling_summary summary{prof.collect(), prof.dropped()};
+    EXPECT_EQ(summary.get("Overflow").count, 8u);
+    EXPECT_EQ(summary.dropped, 12u);
+    prof.reset();
+}
+
+// Test the (optional) sampling of hardware counters
+TEST(profiler, hardware_counters) {
+
+    // Measure a simple loop directly.
+    const counter_group group;
+    hardware_counters counters;
+    volatile double sum = 0.;
+    {
+        counter_scope scope{group, counters};
+        for (int i = 0; i < 100000; ++i) {
+            sum = sum + 0.5 * i;
+        }
+    }
+    if (!group.available()) {
+        EXPECT_EQ(counters.available, 0u);
+        EXPECT_LT(counters.ipc(), 0.);
+        GTEST_SKIP() << "Hardware counters not available: " << group.error();
+    }
+    if (counters.has(hardware_counters::instructions)) {
+        EXPECT_GT(counters[hardware_counters::instructions], 100000u);
+    }
+
+    // Measure the same through the profiler.
+    profiler& prof = profiler::instance();
+    prof.reset();
+    prof.enable(profiler::default_buffer_capacity, true);
+    ASSERT_TRUE(profiler::sampling_counters());
+    {
+        profiling_scope scope{"Loop", 100000u};
+        for (int i = 0; i < 100000; ++i) {
+            sum = sum + 0.5 * i;
+        }
+    }
+    prof.disable();
+
+    const profiling_summary summary{prof.collect()};
+    EXPECT_EQ(summary.get("Loop").counters.available, counters.available);
+    std::ostringstream printout;
+    printout << summary;
+    EXPECT_NE(printout.str().find("IPC"), std::string::npos);
+
+    // Stop sampling the counters, while keeping the profiler enabled.
+    prof.enable(profiler::default_buffer_capacity, false);
+    ASSERT_FALSE(profiler::sampling_counters());
+    {
+        profiling_scope scope{"Loop", 100000u};
+        for (int i = 0; i < 100000; ++i) {
+            sum = sum + 0.5 * i;
+        }
+    }
+    prof.disable();
+
+    const profiling_summary time_summary{prof.collect()};
+    EXPECT_EQ(time_summary.get("Loop").counters.available, 0u);
+}
@@ -7,9 +7,16 @@
 
 // Project include(s).
 #include "traccc/definitions/common.hpp"
+#include "traccc/edm/compact_spacepoint.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/region_of_interest.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/layer_link_table.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/seeding_grid_tuner.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/seeding/vertex_z_finding.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -17,6 +24,14 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <thread>
+#include <vector>
+
 using namespace traccc;
 
 namespace {
@@ -28,6 +43,43 @@ vecmem::host_memory_resource host_mr;
 static constexpr vector3 B{0. * unit<scalar>::T, 0. * unit<scalar>::T,
                            2. * unit<scalar>::T};
 
+/// Positions of the spacepoints of the two muons used by most tests. The
+/// first five are from a 16.62 GeV muon, the last five from a 1.85 GeV one.
+const std::vector<point3> muon_positions = {
+    {36.6706f, 10.6472f, 104.131f}, {94.2191f, 29.6699f, 113.628f},
+    {149.805f, 47.9518f, 122.979f}, {218.514f, 70.3049f, 134.029f},
+    {275.359f, 88.668f, 143.378f},  {36.301f, 13.1197f, 106.83f},
+    {93.9366f, 33.7101f, 120.978f}, {149.192f, 52.0562f, 134.678f},
+    {218.398f, 73.1025f, 151.979f}, {275.322f, 89.0663f, 166.229f}};
+
+/// Make spacepoints out of (a range of) the muon positions
+spacepoint_collection_types::host muon_spacepoints(
+    std::size_t begin = 0u, std::size_t end = muon_positions.size()) {
+
+    spacepoint_collection_types::host result{&host_mr};
+    for (std::size_t i = begin; i < end; ++i) {
+        result.push_back({muon_positions[i], {}});
+    }
+    return result;
+}
+
+/// Check that two seed collections hold the same seeds, in any order
+void expect_same_seeds(const seed_collection_types::host& reference,
+                       const seed_collection_types::host& seeds) {
+
+    ASSERT_FALSE(reference.empty());
+    ASSERT_EQ(seeds.size(), reference.size());
+    for (const seed& s : reference) {
+        EXPECT_EQ(std::count_if(seeds.begin(), seeds.end(),
+                                [&s](const seed& other) {
+                                    return (other.spB_link == s.spB_link) &&
+                                           (other.spM_link == s.spM_link) &&
+                                           (other.spT_link == s.spT_link);
+                                }),
+                  1);
+    }
+}
+
 }  // namespace
 
 // Seeding with two muons
@@ -114,3 +166,455 @@ TEST(seeding, case2) {
                 0.1 * unit<scalar>::GeV);
     */
 }
+
+// Seeding of multiple events in one batch
+TEST(seeding, batch) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+    traccc::seeding_algorithm sa(finder_config, grid_config, filter_config,
+                                 host_mr);
+
+    // The spacepoints of the two muons from above, in separate events, with
+    // an empty event in between them.
+    std::vector<spacepoint_collection_types::host> events(3u);
+    events[0] = muon_spacepoints(0u, 5u);
+    events[2] = muon_spacepoints(5u);
+
+    // Run seeding
+    auto batch = sa(events);
+
+    // There should be one seed from each muon, tagged with its event
+    ASSERT_EQ(batch.seeds.size(), 2u);
+    ASSERT_EQ(batch.event_indices.size(), 2u);
+    EXPECT_EQ(batch.event_indices[0], 0u);
+    EXPECT_EQ(batch.event_indices[1], 2u);
+
+    // The seeds should be the same as the ones from single event seeding
+    for (std::size_t i = 0; i < batch.seeds.size(); ++i) {
+        const auto seeds = sa(events[batch.event_indices[i]]);
+        ASSERT_EQ(seeds.size(), 1u);
+        EXPECT_EQ(batch.seeds[i].spB_link, seeds[0].spB_link);
+        EXPECT_EQ(batch.seeds[i].spM_link, seeds[0].spM_link);
+        EXPECT_EQ(batch.seeds[i].spT_link, seeds[0].spT_link);
+    }
+}
+
+// Binning of spacepoints into a flat grid
+TEST(seeding, flat_grid) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::spacepoint_binning sb(finder_config, grid_config, host_mr);
+
+    // Spacepoints from the two muons from above
+    const spacepoint_collection_types::host spacepoints = muon_spacepoints();
+
+    // Bin them into both types of grids. Filling the flat grid twice, to
+    // make sure that it can be re-used.
+    const traccc::sp_grid grid = sb(spacepoints);
+    traccc::flat_sp_grid flat_grid(sb.axes(), host_mr);
+    sb(spacepoints, flat_grid);
+    sb(spacepoints, flat_grid);
+
+    // The two grids should have the same content.
+    ASSERT_EQ(flat_grid.nbins(), grid.nbins());
+    std::size_t n_binned = 0;
+    for (unsigned int i = 0; i < grid.nbins(); ++i) {
+        const auto& bin = grid.bin(i);
+        const auto flat_bin = flat_grid.bin(i);
+        ASSERT_EQ(flat_bin.size(), bin.size());
+        for (std::size_t j = 0; j < bin.size(); ++j) {
+            EXPECT_EQ(flat_bin[j].m_link, bin[j].m_link);
+        }
+        n_binned += bin.size();
+    }
+    EXPECT_EQ(flat_grid.spacepoints().size(), n_binned);
+}
+
+// Seeding with a re-used state, and from multiple threads
+TEST(seeding, state) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+    const traccc::seeding_algorithm sa(finder_config, grid_config,
+                                       filter_config, host_mr);
+
+    // Spacepoints of both muons, and of only the first one
+    const spacepoint_collection_types::host spacepoints = muon_spacepoints();
+    const spacepoint_collection_types::host first_muon =
+        muon_spacepoints(0u, 5u);
+    const auto seeds = sa(spacepoints);
+    const auto first_muon_seeds = sa(first_muon);
+
+    // Re-using a state between events must not change the results.
+    traccc::seeding_algorithm::state_type state = sa.make_state(host_mr);
+    expect_same_seeds(seeds, sa(spacepoints, state));
+    expect_same_seeds(first_muon_seeds, sa(first_muon, state));
+    expect_same_seeds(seeds, sa(spacepoints, state));
+
+    // Neither must using the algorithm from multiple threads at once.
+    std::vector<seed_collection_types::host> thread_seeds(
+        4u, seed_collection_types::host{&host_mr});
+    std::vector<std::thread> threads;
+    for (seed_collection_types::host& result : thread_seeds) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 10; ++i) {
+                result = sa(spacepoints);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const seed_collection_types::host& result : thread_seeds) {
+        expect_same_seeds(seeds, result);
+    }
+}
+
+// Seeding with compact spacepoints, linking to their measurements
+TEST(seeding, compact_spacepoints) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+    traccc::seeding_algorithm sa(finder_config, grid_config, filter_config,
+                                 host_mr);
+    traccc::track_params_estimation tp(host_mr);
+
+    // Create the same spacepoints in both formats, with distinct
+    // measurements.
+    measurement_collection_types::host measurements{&host_mr};
+    spacepoint_collection_types::host spacepoints{&host_mr};
+    compact_spacepoint_collection_types::host compact_spacepoints{&host_mr};
+    for (std::size_t i = 0; i < muon_positions.size(); ++i) {
+        measurement meas;
+        meas.local = {static_cast<scalar>(i), static_cast<scalar>(2 * i)};
+        meas.measurement_id = i;
+        measurements.push_back(meas);
+        spacepoints.push_back({muon_positions[i], meas});
+        compact_spacepoints.push_back(
+            {muon_positions[i], static_cast<unsigned int>(i)});
+    }
+
+    // Run the seeding on both.
+    const auto seeds = sa(spacepoints);
+    const auto compact_seeds = sa(compact_spacepoints);
+    expect_same_seeds(seeds, compact_seeds);
+
+    // Estimate the track parameters with both.
+    const auto params = tp(spacepoints, seeds, B);
+    const auto compact_params =
+        tp(compact_spacepoints, measurements, compact_seeds, B);
+    ASSERT_EQ(compact_params.size(), params.size());
+    for (std::size_t i = 0; i < params.size(); ++i) {
+        EXPECT_EQ(compact_params[i].vector(), params[i].vector());
+        EXPECT_EQ(compact_params[i].surface_link(), params[i].surface_link());
+    }
+}
+
+// Primary vertex z pre-finding
+TEST(seeding, vertex_z_finding) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::vertex_z_finder_config vertex_config;
+    traccc::vertex_z_finding vf(finder_config, vertex_config, host_mr);
+
+    // Straight tracks from two vertices, with more of them coming from the
+    // first one. Using different phi values for the tracks of the two.
+    spacepoint_collection_types::host spacepoints{&host_mr};
+    const std::vector<std::pair<scalar, unsigned int>> vertices = {
+        {37.f * unit<scalar>::mm, 20u}, {-80.f * unit<scalar>::mm, 10u}};
+    for (const auto& [z0, n_tracks] : vertices) {
+        for (unsigned int i = 0; i < n_tracks; ++i) {
+            const scalar phi = (z0 > 0.f ? -3.f : -2.9f) +
+                               6.f * static_cast<scalar>(i) /
+                                   static_cast<scalar>(n_tracks);
+            const scalar cot_theta =
+                -1.5f + 0.1f * static_cast<scalar>(i) + 0.01f * z0;
+            for (scalar r : {33.f, 50.f, 88.f}) {
+                spacepoints.push_back({{r * std::cos(phi), r * std::sin(phi),
+                                        z0 + r * cot_theta},
+                                       {}});
+            }
+        }
+    }
+
+    // Find the vertex candidates.
+    const auto candidates = vf(spacepoints);
+    ASSERT_EQ(candidates.size(), 2u);
+    EXPECT_NEAR(candidates[0], 37.f * unit<scalar>::mm,
+                vertex_config.bin_width);
+    EXPECT_NEAR(candidates[1], -80.f * unit<scalar>::mm,
+                vertex_config.bin_width);
+}
+
+// Seeding with the primary vertex z pre-finding
+TEST(seeding, vertex_z_prefinding) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+    traccc::vertex_z_finder_config vertex_config;
+    vertex_config.enable = true;
+    vertex_config.min_pairs = 1u;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+    traccc::seeding_algorithm sa(finder_config, grid_config, filter_config,
+                                 host_mr);
+    traccc::seeding_algorithm sa_vertex(finder_config, grid_config,
+                                        filter_config, host_mr, vertex_config);
+
+    // Spacepoints from the two muons from above, which come from the same
+    // vertex
+    const spacepoint_collection_types::host spacepoints = muon_spacepoints();
+
+    // The same seeds should be found with, and without the pre-finding.
+    const auto seeds = sa(spacepoints);
+    const auto vertex_seeds = sa_vertex(spacepoints);
+    expect_same_seeds(seeds, vertex_seeds);
+}
+
+// Seeding in regions of interest
+TEST(seeding, region_of_interest) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+    traccc::seeding_algorithm sa(finder_config, grid_config, filter_config,
+                                 host_mr);
+
+    // Spacepoints from the two muons from above
+    const spacepoint_collection_types::host spacepoints = muon_spacepoints();
+
+    // A region containing the muons, and one on the other side of the
+    // detector.
+    region_of_interest muon_roi;
+    muon_roi.eta_min = 0.f;
+    muon_roi.eta_max = 1.f;
+    muon_roi.phi_min = 0.1f;
+    muon_roi.phi_max = 0.6f;
+    muon_roi.z_min = 50.f * unit<scalar>::mm;
+    muon_roi.z_max = 150.f * unit<scalar>::mm;
+    region_of_interest empty_roi = muon_roi;
+    empty_roi.phi_min = -2.5f;
+    empty_roi.phi_max = -2.f;
+    // A narrow region just next to the muons, which should still pick up
+    // their (bent) tracks.
+    region_of_interest narrow_roi = muon_roi;
+    narrow_roi.phi_min = 0.36f;
+    narrow_roi.phi_max = 0.37f;
+
+    // All seeds should be found in the region(s) of the muons, and none in
+    // the other one.
+    const auto seeds = sa(spacepoints);
+    ASSERT_FALSE(seeds.empty());
+    EXPECT_EQ(sa(spacepoints, muon_roi).size(), seeds.size());
+    EXPECT_EQ(sa(spacepoints, narrow_roi).size(), seeds.size());
+    EXPECT_TRUE(sa(spacepoints, empty_roi).empty());
+
+    // The seeds of multiple regions should be tagged with their regions.
+    const std::vector<region_of_interest> rois = {empty_roi, muon_roi,
+                                                  muon_roi};
+    const auto roi_seeds = sa(spacepoints, rois);
+    ASSERT_EQ(roi_seeds.seeds.size(), 2 * seeds.size());
+    ASSERT_EQ(roi_seeds.roi_indices.size(), roi_seeds.seeds.size());
+    for (std::size_t i = 0; i < roi_seeds.roi_indices.size(); ++i) {
+        EXPECT_EQ(roi_seeds.roi_indices[i], (i < seeds.size() ? 1u : 2u));
+    }
+}
+
+// Seeding using the layer links of a (simple) detector
+TEST(seeding, layer_links) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+    traccc::seeding_algorithm sa(finder_config, grid_config, filter_config,
+                                 host_mr);
+
+    // A barrel detector, with one layer per volume, and an extra layer far
+    // away from all the others
+    const std::vector<scalar> radii = {36.5f, 94.f, 149.5f, 218.5f, 275.3f,
+                                       600.f};
+    std::map<geometry_id, transform3> surfaces;
+    for (unsigned int layer = 0; layer < radii.size(); ++layer) {
+        for (unsigned int i = 0; i < 8; ++i) {
+            const scalar phi = static_cast<scalar>(i * 0.25 * M_PI);
+            const scalar z = 100.f * unit<scalar>::mm;
+            surfaces.insert(
+                {detray::geometry::barcode{}
+                     .set_volume(layer + 1u)
+                     .set_index(i)
+                     .value(),
+                 transform3{vector3{radii[layer] * std::cos(phi),
+                                    radii[layer] * std::sin(phi), z}}});
+        }
+    }
+    const layer_link_table links =
+        make_layer_link_table(surfaces, finder_config);
+
+    // Layers should only be linked to the next one out.
+    EXPECT_TRUE(links.compatible(1u, 2u));
+    EXPECT_TRUE(links.compatible(4u, 5u));
+    EXPECT_FALSE(links.compatible(2u, 1u));
+    EXPECT_FALSE(links.compatible(1u, 1u));
+    EXPECT_FALSE(links.compatible(1u, 3u));
+    EXPECT_FALSE(links.compatible(5u, 6u));
+    EXPECT_TRUE(links.linked(1u));
+    EXPECT_FALSE(links.linked(6u));
+
+    // Spacepoints from the two muons from above
+    spacepoint_collection_types::host spacepoints = muon_spacepoints();
+    for (std::size_t i = 0; i < spacepoints.size(); ++i) {
+        spacepoints[i].meas.surface_link =
+            detray::geometry::barcode{}.set_volume(i % 5u + 1u);
+    }
+
+    // The grid should be ordered by layer in every bin.
+    spacepoint_binning sb(finder_config, grid_config, host_mr);
+    flat_sp_grid grid(sb.axes(), host_mr);
+    sb(spacepoints, links, grid);
+    ASSERT_EQ(grid.layer_links(), &links);
+    EXPECT_EQ(grid.spacepoints().size(), spacepoints.size());
+    for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+        const auto layers = grid.bin_layers(bin);
+        EXPECT_TRUE(std::is_sorted(layers.begin(), layers.end()));
+    }
+
+    // The same seeds should be found with, and without the layer links.
+    const auto seeds = sa(spacepoints);
+    const auto layer_seeds = sa(spacepoints, links);
+    expect_same_seeds(seeds, layer_seeds);
+}
+
+// Tuning of the seeding grid configuration
+TEST(seeding, grid_tuning) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+
+    // Spacepoints from the two muons from above
+    const std::vector<spacepoint_collection_types::host> events = {
+        muon_spacepoints()};
+    const spacepoint_collection_types::host& spacepoints = events.front();
+
+    // The z bin size should be taken from the configuration if set.
+    traccc::seedfinder_config z_config = finder_config;
+    z_config.zBinSize = 100.f * unit<scalar>::mm;
+    const spacepoint_binning sb(z_config, {z_config}, host_mr);
+    EXPECT_EQ(sb.axes().second.bins(),
+              static_cast<unsigned int>(
+                  (z_config.zMax - z_config.zMin) / z_config.zBinSize));
+
+    // Search over a few configurations, including the reference one.
+    seeding_grid_tuner::config_type tuner_config;
+    tuner_config.neighbor_scopes = {{0u, 0u}, {1u, 1u}};
+    tuner_config.phi_bin_deflection_coverages = {
+        finder_config.phiBinDeflectionCoverage};
+    tuner_config.z_bin_size_scales = {0.5f, 1.f};
+    tuner_config.equal_occupancy_z_bins = {4u};
+    seeding_grid_tuner tuner(finder_config, filter_config, tuner_config,
+                             host_mr);
+    const auto results = tuner(events);
+    ASSERT_EQ(results.size(), 6u);
+
+    // The best configuration should find all seeds of the reference, and
+    // the results should be ordered by the number of tests per seed.
+    ASSERT_TRUE(results.front().accepted);
+    EXPECT_DOUBLE_EQ(results.front().relative_efficiency, 1.);
+    EXPECT_GT(results.front().n_seeds, 0u);
+    for (std::size_t i = 1; i < results.size(); ++i) {
+        if (results[i].accepted) {
+            EXPECT_LE(results[i - 1].tests_per_seed(),
+                      results[i].tests_per_seed());
+        }
+        EXPECT_LE(results[i].max_bin_occupancy, spacepoints.size());
+    }
+}
+
+// Seeding with variable width z bins
+TEST(seeding, variable_z_bins) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+
+    // Fine z bins around the muons, and wide ones everywhere else.
+    traccc::seedfinder_config variable_config = finder_config;
+    const std::vector<scalar> edges = {-3000.f, -500.f, 0.f,    80.f,  120.f,
+                                       160.f,   200.f,  500.f, 3000.f};
+    std::copy(edges.begin(), edges.end(), variable_config.zBinEdges.begin());
+    variable_config.nZBinEdges = static_cast<unsigned int>(edges.size());
+
+    // Check the mapping onto the grid's z axis.
+    EXPECT_FLOAT_EQ(variable_config.grid_z(-3000.f), 0.f);
+    EXPECT_FLOAT_EQ(variable_config.grid_z(100.f), 3.5f);
+    EXPECT_FLOAT_EQ(variable_config.grid_z(3000.f), 8.f);
+    EXPECT_FLOAT_EQ(finder_config.grid_z(100.f), 100.f);
+    const spacepoint_binning sb(variable_config, {variable_config}, host_mr);
+    EXPECT_EQ(sb.axes().second.bins(), edges.size() - 1u);
+
+    // The per-bin neighbour scopes should only be used when enabled.
+    variable_config.zBinNeighbors[3] = {0u, 2u};
+    EXPECT_EQ(variable_config.z_neighbor_scope(3.5f)[1],
+              variable_config.neighbor_scope[1]);
+    variable_config.useZBinNeighbors = true;
+    EXPECT_EQ(variable_config.z_neighbor_scope(3.5f)[0], 0u);
+    EXPECT_EQ(variable_config.z_neighbor_scope(3.5f)[1], 2u);
+    variable_config.useZBinNeighbors = false;
+
+    traccc::seeding_algorithm sa(finder_config, {finder_config},
+                                 filter_config, host_mr);
+    traccc::seeding_algorithm sa_variable(
+        variable_config, {variable_config}, filter_config, host_mr);
+
+    // Spacepoints from the two muons from above
+    const spacepoint_collection_types::host spacepoints = muon_spacepoints();
+
+    // The same seeds should be found with both binnings.
+    const auto seeds = sa(spacepoints);
+    const auto variable_seeds = sa_variable(spacepoints);
+    expect_same_seeds(seeds, variable_seeds);
+}
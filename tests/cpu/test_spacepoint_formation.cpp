@@ -6,7 +6,12 @@
  */
 
 // Project include(s).
+#include "traccc/clusterization/compact_spacepoint_formation_algorithm.hpp"
+#include "traccc/clusterization/spacepoint_formation_algorithm.hpp"
 #include "traccc/definitions/common.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/compact_spacepoint.hpp"
+#include "traccc/edm/measurement.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/experimental/spacepoint_formation.hpp"
 
@@ -72,3 +77,45 @@ TEST(spacepoint_formation, cpu) {
     EXPECT_FLOAT_EQ(spacepoints[1].global[1], 10.f);
     EXPECT_FLOAT_EQ(spacepoints[1].global[2], 15.f);
 }
+
+TEST(spacepoint_formation, compact) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Two modules, at different positions
+    cell_module_collection_types::host modules{&host_mr};
+    modules.push_back({});
+    modules.back().placement = transform3{vector3{0.f, 0.f, 10.f}};
+    modules.push_back({});
+    modules.back().placement = transform3{vector3{50.f, 0.f, 0.f}};
+
+    // Measurements on both modules
+    measurement_collection_types::host measurements{&host_mr};
+    for (unsigned int i = 0u; i < 4u; ++i) {
+        measurement meas;
+        meas.local = {static_cast<scalar>(i), static_cast<scalar>(2u * i)};
+        meas.module_link = i % 2u;
+        measurements.push_back(meas);
+    }
+
+    // Run both types of spacepoint formation
+    const host::spacepoint_formation_algorithm sp_formation(host_mr);
+    const host::compact_spacepoint_formation_algorithm compact_sp_formation(
+        host_mr);
+    const auto spacepoints = sp_formation(vecmem::get_data(measurements),
+                                          vecmem::get_data(modules));
+    const auto compact_spacepoints = compact_sp_formation(
+        vecmem::get_data(measurements), vecmem::get_data(modules));
+
+    // The compact spacepoints must be at the same positions, and link to
+    // their measurements by index
+    ASSERT_EQ(spacepoints.size(), measurements.size());
+    ASSERT_EQ(compact_spacepoints.size(), measurements.size());
+    for (unsigned int i = 0u; i < measurements.size(); ++i) {
+        EXPECT_EQ(compact_spacepoints[i].measurement_index, i);
+        EXPECT_FLOAT_EQ(compact_spacepoints[i].x(), spacepoints[i].x());
+        EXPECT_FLOAT_EQ(compact_spacepoints[i].y(), spacepoints[i].y());
+        EXPECT_FLOAT_EQ(compact_spacepoints[i].z(), spacepoints[i].z());
+    }
+}
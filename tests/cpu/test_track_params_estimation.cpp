@@ -8,6 +8,7 @@
 // Project include(s).
 #include "traccc/definitions/common.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/batched_track_params_estimation.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 
@@ -20,6 +21,10 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <cmath>
+#include <cstddef>
+
 using namespace traccc;
 
 TEST(track_params_estimation, helix) {
@@ -60,3 +65,78 @@ TEST(track_params_estimation, helix) {
     ASSERT_EQ(bound_params.size(), 1u);
     ASSERT_NEAR(bound_params[0].p(), getter::norm(mom), 2.f * 1e-4);
 }
+
+TEST(track_params_estimation, batched) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Set B field
+    const vector3 B{0. * unit<scalar>::T, 0. * unit<scalar>::T,
+                    2. * unit<scalar>::T};
+
+    // Make seeds out of helices with a range of momenta, directions and
+    // charges. More of them than what fits into a single block.
+    spacepoint_collection_types::host spacepoints;
+    seed_collection_types::host seeds;
+    for (unsigned int i = 0; i < 150u; ++i) {
+
+        const point3 pos{0.f, 0.f, static_cast<scalar>(i % 7) - 3.f};
+        const scalar phi = 0.04f * static_cast<scalar>(i);
+        const scalar pT =
+            (0.5f + 0.1f * static_cast<scalar>(i)) * unit<scalar>::GeV;
+        const vector3 mom{pT * std::cos(phi), pT * std::sin(phi),
+                          (0.01f * static_cast<scalar>(i) - 0.5f) * pT};
+        const scalar q{(i % 2 == 0 ? -1.f : 1.f) * unit<scalar>::e};
+        detray::detail::helix<traccc::default_algebra> hlx(
+            pos, 0.f, vector::normalize(mom), q / getter::norm(mom), &B);
+
+        const unsigned int first =
+            static_cast<unsigned int>(spacepoints.size());
+        spacepoints.push_back({hlx(50 * unit<scalar>::mm), {}});
+        spacepoints.push_back({hlx(100 * unit<scalar>::mm), {}});
+        spacepoints.push_back({hlx(150 * unit<scalar>::mm), {}});
+        seeds.push_back({first, first + 1u, first + 2u, 0.f, 0.f});
+    }
+
+    // Run the reference and the batched track parameter estimation. With
+    // the latter splitting the seeds into two ranges.
+    traccc::track_params_estimation tp(host_mr);
+    const auto reference = tp(spacepoints, seeds, B);
+
+    std::size_t n_ranges = 0;
+    traccc::batched_track_params_estimation::config_type cfg;
+    cfg.parallel_threshold = 100u;
+    traccc::batched_track_params_estimation btp(
+        host_mr, cfg,
+        [&n_ranges](std::size_t n,
+                    const traccc::batched_track_params_estimation::
+                        range_function_type& func) {
+            func(0u, n / 2u);
+            func(n / 2u, n);
+            n_ranges += 2u;
+        });
+    const auto batched = btp(spacepoints, seeds, B);
+
+    // The results should agree.
+    EXPECT_EQ(n_ranges, 2u);
+    ASSERT_EQ(batched.size(), reference.size());
+    for (std::size_t i = 0; i < reference.size(); ++i) {
+        EXPECT_EQ(batched[i].surface_link(), reference[i].surface_link());
+        EXPECT_FLOAT_EQ(batched[i].bound_local()[0],
+                        reference[i].bound_local()[0]);
+        EXPECT_FLOAT_EQ(batched[i].bound_local()[1],
+                        reference[i].bound_local()[1]);
+        EXPECT_NEAR(batched[i].phi(), reference[i].phi(), 1e-4f);
+        EXPECT_NEAR(batched[i].theta(), reference[i].theta(), 1e-4f);
+        EXPECT_NEAR(batched[i].qop(), reference[i].qop(),
+                    1e-4f * std::abs(reference[i].qop()));
+        EXPECT_NEAR(batched[i].time(), reference[i].time(),
+                    1e-4f * std::abs(reference[i].time()) + 1e-4f);
+        for (std::size_t j = 0; j < e_bound_size; ++j) {
+            EXPECT_FLOAT_EQ(
+                getter::element(batched[i].covariance(), j, j),
+                getter::element(reference[i].covariance(), j, j));
+        }
+    }
+}
@@ -0,0 +1,197 @@
+/**
+ * traccc library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "traccc/host_parallel/utils/barrier.hpp"
+#include "traccc/host_parallel/utils/thread_id.hpp"
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+
+namespace {
+
+/// The number of threads in the tested blocks
+constexpr unsigned int block_size = 64;
+
+}  // namespace
+
+TEST(HostParallelBarrier, BarrierAnd) {
+    traccc::host_parallel::thread_pool pool;
+    std::array<bool, 4> out{};
+
+    pool.launch_cooperative(
+        1, block_size,
+        [&out](const traccc::host_parallel::thread_id1& thread_id,
+               traccc::host_parallel::barrier& bar, unsigned int) {
+            const unsigned int tid = thread_id.getLocalThreadIdX();
+
+            bool v = bar.blockAnd(false);
+            if (tid == 0) {
+                out[0] = v;
+            }
+
+            v = bar.blockAnd(true);
+            if (tid == 0) {
+                out[1] = v;
+            }
+
+            v = bar.blockAnd(tid % 2 == 0);
+            if (tid == 0) {
+                out[2] = v;
+            }
+
+            v = bar.blockAnd(tid < 8);
+            if (tid == 0) {
+                out[3] = v;
+            }
+        });
+
+    EXPECT_FALSE(out[0]);
+    EXPECT_TRUE(out[1]);
+    EXPECT_FALSE(out[2]);
+    EXPECT_FALSE(out[3]);
+}
+
+TEST(HostParallelBarrier, BarrierOr) {
+    traccc::host_parallel::thread_pool pool;
+    std::array<bool, 4> out{};
+
+    pool.launch_cooperative(
+        1, block_size,
+        [&out](const traccc::host_parallel::thread_id1& thread_id,
+               traccc::host_parallel::barrier& bar, unsigned int) {
+            const unsigned int tid = thread_id.getLocalThreadIdX();
+
+            bool v = bar.blockOr(false);
+            if (tid == 0) {
+                out[0] = v;
+            }
+
+            v = bar.blockOr(true);
+            if (tid == 0) {
+                out[1] = v;
+            }
+
+            v = bar.blockOr(tid % 2 == 0);
+            if (tid == 0) {
+                out[2] = v;
+            }
+
+            v = bar.blockOr(tid < 8);
+            if (tid == 0) {
+                out[3] = v;
+            }
+        });
+
+    EXPECT_FALSE(out[0]);
+    EXPECT_TRUE(out[1]);
+    EXPECT_TRUE(out[2]);
+    EXPECT_TRUE(out[3]);
+}
+
+TEST(HostParallelBarrier, BarrierCount) {
+    traccc::host_parallel::thread_pool pool;
+    std::array<unsigned int, 4> out{};
+
+    pool.launch_cooperative(
+        1, block_size,
+        [&out](const traccc::host_parallel::thread_id1& thread_id,
+               traccc::host_parallel::barrier& bar, unsigned int) {
+            const unsigned int tid = thread_id.getLocalThreadIdX();
+
+            unsigned int v = bar.blockCount(false);
+            if (tid == 0) {
+                out[0] = v;
+            }
+
+            v = bar.blockCount(true);
+            if (tid == 0) {
+                out[1] = v;
+            }
+
+            v = bar.blockCount(tid % 2 == 0);
+            if (tid == 0) {
+                out[2] = v;
+            }
+
+            v = bar.blockCount(tid < 8);
+            if (tid == 0) {
+                out[3] = v;
+            }
+        });
+
+    EXPECT_EQ(out[0], 0u);
+    EXPECT_EQ(out[1], block_size);
+    EXPECT_EQ(out[2], block_size / 2);
+    EXPECT_EQ(out[3], 8u);
+}
+
+TEST(HostParallelBarrier, BarrierAndEarlyReturn) {
+    traccc::host_parallel::thread_pool pool;
+    std::array<bool, 2> out{};
+
+    pool.launch_cooperative(
+        1, block_size,
+        [&out](const traccc::host_parallel::thread_id1& thread_id,
+               traccc::host_parallel::barrier& bar, unsigned int) {
+            const unsigned int tid = thread_id.getLocalThreadIdX();
+
+            // Half of the threads finish right away.
+            if (tid % 2 == 1) {
+                return;
+            }
+
+            bool v = bar.blockAnd(true);
+            if (tid == 0) {
+                out[0] = v;
+            }
+
+            v = bar.blockAnd(tid != 2);
+            if (tid == 0) {
+                out[1] = v;
+            }
+        });
+
+    EXPECT_TRUE(out[0]);
+    EXPECT_FALSE(out[1]);
+}
+
+TEST(HostParallelBarrier, ConcurrentLaunches) {
+    traccc::host_parallel::thread_pool pool{4};
+    constexpr unsigned int n_blocks = 100;
+    std::array<std::vector<unsigned int>, 4> out;
+
+    // Launch the same kernel from multiple threads at the same time.
+    std::vector<std::thread> threads;
+    for (std::vector<unsigned int>& counts : out) {
+        threads.emplace_back([&pool, &counts]() {
+            counts.resize(n_blocks);
+            pool.launch_cooperative(
+                n_blocks, block_size,
+                [&counts](const traccc::host_parallel::thread_id1& thread_id,
+                          traccc::host_parallel::barrier& bar, unsigned int) {
+                    const unsigned int v = bar.blockCount(true);
+                    if (thread_id.getLocalThreadIdX() == 0) {
+                        counts[thread_id.getBlockIdX()] = v;
+                    }
+                });
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    for (const std::vector<unsigned int>& counts : out) {
+        for (unsigned int v : counts) {
+            EXPECT_EQ(v, block_size);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+#include "tests/cca_test.hpp"
+#include "traccc/host_parallel/clusterization/clusterization_algorithm.hpp"
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+
+namespace {
+
+cca_function_t get_f_with(traccc::clustering_config cfg) {
+    return [cfg](const traccc::cell_collection_types::host& cells,
+                 const traccc::cell_module_collection_types::host& modules) {
+        std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>>
+            result;
+
+        vecmem::host_memory_resource host_mr;
+        vecmem::copy copy;
+        traccc::host_parallel::thread_pool pool;
+
+        traccc::host_parallel::clusterization_algorithm cc({host_mr}, copy,
+                                                           pool, cfg);
+
+        auto measurements_buffer =
+            cc(vecmem::get_data(cells), vecmem::get_data(modules));
+        traccc::measurement_collection_types::host measurements{&host_mr};
+        copy(measurements_buffer, measurements)->wait();
+
+        for (std::size_t i = 0; i < measurements.size(); i++) {
+            result[modules.at(measurements.at(i).module_link)
+                       .surface_link.value()]
+                .push_back(measurements.at(i));
+        }
+
+        return result;
+    };
+}
+}  // namespace
+
+TEST_P(ConnectedComponentAnalysisTests, Run) {
+    test_connected_component_analysis(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    HostParallelFastSvAlgorithm, ConnectedComponentAnalysisTests,
+    ::testing::Combine(
+        ::testing::Values(get_f_with(default_ccl_test_config())),
+        ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
+    ConnectedComponentAnalysisTests::get_test_name);
+
+INSTANTIATE_TEST_SUITE_P(
+    HostParallelFastSvAlgorithmWithScratch, ConnectedComponentAnalysisTests,
+    ::testing::Combine(
+        ::testing::Values(get_f_with(tiny_ccl_test_config())),
+        ::testing::ValuesIn(
+            ConnectedComponentAnalysisTests::get_test_files_short())),
+    ConnectedComponentAnalysisTests::get_test_name);
@@ -0,0 +1,233 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/device/container_d2h_copy_alg.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/host_parallel/finding/finding_algorithm.hpp"
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+#include "traccc/io/event_map2.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/performance/container_comparator.hpp"
+#include "traccc/simulation/simulator.hpp"
+#include "traccc/utils/ranges.hpp"
+
+// Test include(s).
+#include "tests/ckf_toy_detector_test.hpp"
+#include "traccc/utils/seed_generator.hpp"
+
+// detray include(s).
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <filesystem>
+#include <string>
+
+using namespace traccc;
+
+TEST_P(CkfToyDetectorTests, Run) {
+
+    // Get the parameters
+    const std::string name = std::get<0>(GetParam());
+    const unsigned int n_truth_tracks = std::get<7>(GetParam());
+    const unsigned int n_events = std::get<8>(GetParam());
+
+    /*****************************
+     * Build a toy detector
+     *****************************/
+
+    // Memory resources used by the application.
+    vecmem::host_memory_resource host_mr;
+    traccc::memory_resource mr{host_mr, &host_mr};
+
+    // Read back detector file
+    const std::string path = name + "/";
+    detray::io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file(path + "toy_detector_geometry.json")
+        .add_file(path + "toy_detector_homogeneous_material.json")
+        .add_file(path + "toy_detector_surface_grids.json");
+
+    auto [host_det, names] =
+        detray::io::read_detector<host_detector_type>(host_mr, reader_cfg);
+
+    auto field = detray::bfield::create_const_field(B);
+
+    // Detector view object
+    auto det_view = detray::get_data(host_det);
+
+    /***************************
+     * Generate simulation data
+     ***************************/
+
+    // Track generator
+    using generator_type =
+        detray::random_track_generator<traccc::free_track_parameters,
+                                       uniform_gen_t>;
+    generator_type::configuration gen_cfg{};
+    gen_cfg.n_tracks(n_truth_tracks);
+    gen_cfg.origin(std::get<1>(GetParam()));
+    gen_cfg.origin_stddev(std::get<2>(GetParam()));
+    gen_cfg.phi_range(std::get<5>(GetParam()));
+    gen_cfg.eta_range(std::get<4>(GetParam()));
+    gen_cfg.mom_range(std::get<3>(GetParam()));
+    gen_cfg.charge(std::get<6>(GetParam()));
+    gen_cfg.seed(42);
+    generator_type generator(gen_cfg);
+
+    // Smearing value for measurements
+    traccc::measurement_smearer<traccc::default_algebra> meas_smearer(
+        smearing[0], smearing[1]);
+
+    using writer_type = traccc::smearing_writer<
+        traccc::measurement_smearer<traccc::default_algebra>>;
+
+    typename writer_type::config smearer_writer_cfg{meas_smearer};
+
+    // Run simulator
+    const std::string full_path = io::data_directory() + path;
+    std::filesystem::create_directories(full_path);
+    auto sim = traccc::simulator<host_detector_type, b_field_t, generator_type,
+                                 writer_type>(
+        n_events, host_det, field, std::move(generator),
+        std::move(smearer_writer_cfg), full_path);
+    sim.get_config().propagation.stepping.step_constraint = step_constraint;
+    sim.get_config().propagation.navigation.search_window = search_window;
+    sim.run();
+
+    /*****************************
+     * Do the reconstruction
+     *****************************/
+
+    // Thread pool and copy objects
+    traccc::host_parallel::thread_pool pool;
+    vecmem::copy copy;
+
+    traccc::device::container_d2h_copy_alg<
+        traccc::track_candidate_container_types>
+        track_candidate_d2h{mr, copy};
+
+    // Seed generator
+    seed_generator<host_detector_type> sg(host_det, stddevs);
+
+    // Finding algorithm configuration
+    typename traccc::host_parallel::finding_algorithm<
+        rk_stepper_type, device_navigator_type>::config_type cfg;
+    cfg.max_num_branches_per_seed = 500;
+    cfg.navigation_buffer_size_scaler = 1000;
+
+    cfg.propagation.navigation.search_window = search_window;
+
+    // Finding algorithm object
+    traccc::finding_algorithm<rk_stepper_type, host_navigator_type>
+        host_finding(cfg);
+
+    // Finding algorithm object
+    traccc::host_parallel::finding_algorithm<rk_stepper_type,
+                                             device_navigator_type>
+        parallel_finding(cfg, mr, copy, pool);
+
+    // Iterate over events
+    for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
+
+        // Truth Track Candidates
+        traccc::event_map2 evt_map(i_evt, path, path, path);
+
+        traccc::track_candidate_container_types::host truth_track_candidates =
+            evt_map.generate_truth_candidates(sg, host_mr);
+
+        ASSERT_EQ(truth_track_candidates.size(), n_truth_tracks);
+
+        // Prepare truth seeds
+        traccc::bound_track_parameters_collection_types::host seeds(&host_mr);
+        for (unsigned int i_trk = 0; i_trk < n_truth_tracks; i_trk++) {
+            seeds.push_back(truth_track_candidates.at(i_trk).header);
+        }
+        ASSERT_EQ(seeds.size(), n_truth_tracks);
+
+        traccc::bound_track_parameters_collection_types::buffer seeds_buffer{
+            static_cast<unsigned int>(seeds.size()), mr.main};
+        copy.setup(seeds_buffer)->wait();
+        copy(vecmem::get_data(seeds), seeds_buffer)->wait();
+
+        // Read measurements
+        traccc::io::measurement_reader_output readOut(&host_mr);
+        traccc::io::read_measurements(readOut, i_evt, path,
+                                      traccc::data_format::csv);
+        traccc::measurement_collection_types::host& measurements_per_event =
+            readOut.measurements;
+
+        // Navigation buffer
+        auto navigation_buffer = detray::create_candidates_buffer(
+            host_det,
+            parallel_finding.get_config().navigation_buffer_size_scaler *
+                seeds.size(),
+            mr.main, mr.host);
+
+        // Run host finding
+        auto track_candidates =
+            host_finding(host_det, field, measurements_per_event, seeds);
+
+        // Run host_parallel finding
+        traccc::track_candidate_container_types::host parallel_candidates =
+            track_candidate_d2h(parallel_finding(
+                det_view, field, navigation_buffer,
+                vecmem::get_data(measurements_per_event), seeds_buffer));
+
+        // Simple check
+        ASSERT_NEAR(track_candidates.size(), parallel_candidates.size(), 1u);
+        ASSERT_GE(track_candidates.size(), n_truth_tracks);
+
+        // Make sure that the outputs of the two CKFs are equivalent
+        unsigned int n_matches = 0u;
+        for (unsigned int i = 0u; i < track_candidates.size(); i++) {
+            auto iso =
+                traccc::details::is_same_object(track_candidates.at(i).items);
+
+            for (unsigned int j = 0u; j < parallel_candidates.size(); j++) {
+                if (iso(parallel_candidates.at(j).items)) {
+                    n_matches++;
+                    break;
+                }
+            }
+        }
+
+        float matching_rate =
+            float(n_matches) /
+            std::max(track_candidates.size(), parallel_candidates.size());
+        EXPECT_GE(matching_rate, 0.999f);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    HostParallelCkfToyDetectorValidation, CkfToyDetectorTests,
+    ::testing::Values(
+        std::make_tuple("host_parallel_toy_n_particles_1",
+                        std::array<scalar, 3u>{0.f, 0.f, 0.f},
+                        std::array<scalar, 3u>{0.f, 0.f, 0.f},
+                        std::array<scalar, 2u>{1.f, 100.f},
+                        std::array<scalar, 2u>{-4.f, 4.f},
+                        std::array<scalar, 2u>{-detray::constant<scalar>::pi,
+                                               detray::constant<scalar>::pi},
+                        -1.f, 1, 1),
+        std::make_tuple("host_parallel_toy_n_particles_1000",
+                        std::array<scalar, 3u>{0.f, 0.f, 0.f},
+                        std::array<scalar, 3u>{0.f, 0.f, 0.f},
+                        std::array<scalar, 2u>{1.f, 100.f},
+                        std::array<scalar, 2u>{-4.f, 4.f},
+                        std::array<scalar, 2u>{-detray::constant<scalar>::pi,
+                                               detray::constant<scalar>::pi},
+                        -1.f, 1000, 1)));
@@ -0,0 +1,99 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/host_parallel/seeding/seeding_algorithm.hpp"
+#include "traccc/host_parallel/utils/thread_pool.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <string>
+#include <tuple>
+
+class HostParallelSeedingTests
+    : public ::testing::TestWithParam<
+          std::tuple<std::string, std::string, unsigned int>> {};
+
+TEST_P(HostParallelSeedingTests, Run) {
+
+    const std::string detector_file = std::get<0>(GetParam());
+    const std::string hits_dir = std::get<1>(GetParam());
+    const unsigned int event = std::get<2>(GetParam());
+
+    // Memory resources used by the test.
+    vecmem::host_memory_resource host_mr;
+    traccc::memory_resource mr{host_mr, &host_mr};
+
+    // Thread pool and copy objects.
+    traccc::host_parallel::thread_pool pool;
+    vecmem::copy copy;
+
+    // Seeding configuration.
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Seeding algorithms.
+    traccc::seeding_algorithm host_seeding(finder_config, grid_config,
+                                           filter_config, host_mr);
+    traccc::host_parallel::seeding_algorithm parallel_seeding(
+        finder_config, grid_config, filter_config, mr, copy, pool);
+
+    // Read the spacepoints of the event.
+    auto [surface_transforms, _] = traccc::io::read_geometry(detector_file);
+    traccc::io::spacepoint_reader_output reader_output(&host_mr);
+    traccc::io::read_spacepoints(reader_output, event, hits_dir,
+                                 surface_transforms, traccc::data_format::csv);
+    const traccc::spacepoint_collection_types::host& spacepoints =
+        reader_output.spacepoints;
+
+    // Run the two seeding algorithms.
+    const traccc::seed_collection_types::host seeds = host_seeding(spacepoints);
+    traccc::seed_collection_types::host parallel_seeds{&host_mr};
+    copy(parallel_seeding(vecmem::get_data(spacepoints)), parallel_seeds)
+        ->wait();
+
+    // Simple check
+    ASSERT_GT(seeds.size(), 0u);
+
+    // Make sure that the two algorithms find the same seeds. Since they use
+    // the same spacepoints, the seeds can be compared through their links.
+    unsigned int n_matches = 0u;
+    for (const traccc::seed& s : seeds) {
+        if (std::find_if(parallel_seeds.begin(), parallel_seeds.end(),
+                         [&s](const traccc::seed& other) {
+                             return (other.spB_link == s.spB_link) &&
+                                    (other.spM_link == s.spM_link) &&
+                                    (other.spT_link == s.spT_link);
+                         }) != parallel_seeds.end()) {
+            n_matches++;
+        }
+    }
+
+    const float matching_rate = static_cast<float>(n_matches) /
+                                static_cast<float>(std::max(
+                                    seeds.size(), parallel_seeds.size()));
+    EXPECT_GE(matching_rate, 0.99f);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    HostParallelSeedingValidation, HostParallelSeedingTests,
+    ::testing::Values(std::make_tuple("tml_detector/trackml-detector.csv",
+                                      "tml_full/ttbar_mu200/", 0),
+                      std::make_tuple("tml_detector/trackml-detector.csv",
+                                      "tml_full/ttbar_mu200/", 1)));
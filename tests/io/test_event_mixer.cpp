@@ -0,0 +1,111 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/event_mixer.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+/// Create a module with a given surface link
+traccc::cell_module make_module(std::uint64_t barcode) {
+    traccc::cell_module module;
+    module.surface_link = detray::geometry::barcode{barcode};
+    return module;
+}
+
+}  // namespace
+
+// Test the merging of cells from multiple events
+TEST(io_event_mixer, mix) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Set up a library of two events, sharing one module.
+    traccc::demonstrator_input library(&host_mr);
+    library.push_back(traccc::io::cell_reader_output(&host_mr));
+    library.push_back(traccc::io::cell_reader_output(&host_mr));
+
+    library[0].modules.push_back(make_module(20u));
+    library[0].modules.push_back(make_module(10u));
+    library[0].cells.push_back({1u, 1u, 0.5f, 2.f, 0u});
+    library[0].cells.push_back({2u, 1u, 0.5f, 2.f, 0u});
+    library[0].cells.push_back({1u, 1u, 0.5f, 2.f, 1u});
+
+    library[1].modules.push_back(make_module(30u));
+    library[1].modules.push_back(make_module(20u));
+    library[1].cells.push_back({1u, 1u, 0.5f, 1.f, 0u});
+    library[1].cells.push_back({1u, 1u, 0.25f, 1.f, 1u});
+    library[1].cells.push_back({3u, 0u, 0.5f, 1.f, 1u});
+
+    // Mix the two events.
+    const traccc::io::event_mixer mixer(library);
+    traccc::io::cell_reader_output mixed(&host_mr);
+    mixer(mixed, {0u, 1u});
+
+    // The modules should be unique, and ordered by their surface links.
+    ASSERT_EQ(mixed.modules.size(), 3u);
+    EXPECT_EQ(mixed.modules[0].surface_link.value(), 10u);
+    EXPECT_EQ(mixed.modules[1].surface_link.value(), 20u);
+    EXPECT_EQ(mixed.modules[2].surface_link.value(), 30u);
+
+    // The cells on the shared channel should have been merged.
+    ASSERT_EQ(mixed.cells.size(), 5u);
+    EXPECT_EQ(mixed.cells[0].module_link, 0u);
+    EXPECT_EQ(mixed.cells[1].module_link, 1u);
+    EXPECT_EQ(mixed.cells[1].channel0, 3u);
+    EXPECT_EQ(mixed.cells[1].channel1, 0u);
+    EXPECT_EQ(mixed.cells[2].module_link, 1u);
+    EXPECT_EQ(mixed.cells[2].channel0, 1u);
+    EXPECT_FLOAT_EQ(mixed.cells[2].activation, 0.75f);
+    EXPECT_FLOAT_EQ(mixed.cells[2].time, 1.f);
+    EXPECT_EQ(mixed.cells[3].module_link, 1u);
+    EXPECT_EQ(mixed.cells[3].channel0, 2u);
+    EXPECT_EQ(mixed.cells[4].module_link, 2u);
+}
+
+// Test the random choice of library events
+TEST(io_event_mixer, choose) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Set up a library of empty events.
+    traccc::demonstrator_input library(&host_mr);
+    for (std::size_t i = 0; i < 10u; ++i) {
+        library.push_back(traccc::io::cell_reader_output(&host_mr));
+    }
+    const traccc::io::event_mixer mixer(library);
+    traccc::io::event_mixer::generator_type generator(42u);
+
+    // Events should not repeat while the library is not exhausted.
+    std::vector<std::size_t> chosen = mixer.choose(10u, generator);
+    ASSERT_EQ(chosen.size(), 10u);
+    std::sort(chosen.begin(), chosen.end());
+    for (std::size_t i = 0; i < chosen.size(); ++i) {
+        EXPECT_EQ(chosen[i], i);
+    }
+
+    // But they should be re-used beyond that.
+    chosen = mixer.choose(25u, generator);
+    ASSERT_EQ(chosen.size(), 25u);
+    for (std::size_t i = 0; i < 10u; ++i) {
+        EXPECT_GE(std::count(chosen.begin(), chosen.end(), i), 2);
+    }
+}